@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#include "accelerator-pool.h"
+
+#include "ns3/enum.h"
+#include "ns3/log.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("AcceleratorPool");
+
+NS_OBJECT_ENSURE_REGISTERED(AcceleratorPool);
+
+TypeId
+AcceleratorPool::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::AcceleratorPool")
+            .SetParent<Object>()
+            .SetGroupName("Distributed")
+            .AddConstructor<AcceleratorPool>()
+            .AddAttribute("DispatchPolicy",
+                          "Policy used to choose a local device for each task",
+                          EnumValue(AcceleratorPool::LEAST_QUEUE),
+                          MakeEnumAccessor<DispatchPolicy>(&AcceleratorPool::m_dispatchPolicy),
+                          MakeEnumChecker(AcceleratorPool::LEAST_QUEUE,
+                                          "LeastQueue",
+                                          AcceleratorPool::TYPE_MATCH,
+                                          "TypeMatch"));
+    return tid;
+}
+
+AcceleratorPool::AcceleratorPool()
+    : m_dispatchPolicy(LEAST_QUEUE)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+AcceleratorPool::~AcceleratorPool()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+AcceleratorPool::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    m_accelerators.clear();
+    Object::DoDispose();
+}
+
+void
+AcceleratorPool::Add(Ptr<Accelerator> accel)
+{
+    NS_LOG_FUNCTION(this << accel);
+    NS_ASSERT_MSG(accel, "Cannot add null accelerator to pool");
+    m_accelerators.push_back(accel);
+}
+
+uint32_t
+AcceleratorPool::GetN() const
+{
+    return static_cast<uint32_t>(m_accelerators.size());
+}
+
+Ptr<Accelerator>
+AcceleratorPool::Get(uint32_t idx) const
+{
+    NS_ASSERT_MSG(idx < m_accelerators.size(),
+                  "Device index " << idx << " out of range (size=" << m_accelerators.size()
+                                  << ")");
+    return m_accelerators[idx];
+}
+
+int32_t
+AcceleratorPool::Select(Ptr<const Task> task) const
+{
+    NS_LOG_FUNCTION(this << task);
+
+    bool filterByType = false;
+    if (m_dispatchPolicy == TYPE_MATCH && !task->GetRequiredAcceleratorType().empty())
+    {
+        for (const auto& accel : m_accelerators)
+        {
+            if (accel->GetName() == task->GetRequiredAcceleratorType())
+            {
+                filterByType = true;
+                break;
+            }
+        }
+        if (!filterByType)
+        {
+            NS_LOG_DEBUG("No local device of type " << task->GetRequiredAcceleratorType()
+                                                    << ", considering all devices");
+        }
+    }
+
+    int32_t best = -1;
+    uint32_t bestQueue = std::numeric_limits<uint32_t>::max();
+    for (uint32_t i = 0; i < m_accelerators.size(); i++)
+    {
+        if (filterByType && m_accelerators[i]->GetName() != task->GetRequiredAcceleratorType())
+        {
+            continue;
+        }
+        uint32_t queue = m_accelerators[i]->GetQueueLength();
+        if (queue < bestQueue)
+        {
+            bestQueue = queue;
+            best = static_cast<int32_t>(i);
+        }
+    }
+
+    return best;
+}
+
+uint32_t
+AcceleratorPool::GetQueueLength() const
+{
+    uint32_t total = 0;
+    for (const auto& accel : m_accelerators)
+    {
+        total += accel->GetQueueLength();
+    }
+    return total;
+}
+
+bool
+AcceleratorPool::IsBusy() const
+{
+    for (const auto& accel : m_accelerators)
+    {
+        if (accel->IsBusy())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+double
+AcceleratorPool::GetFrequency() const
+{
+    if (m_accelerators.empty())
+    {
+        return 0.0;
+    }
+    double sum = 0.0;
+    for (const auto& accel : m_accelerators)
+    {
+        sum += accel->GetFrequency();
+    }
+    return sum / m_accelerators.size();
+}
+
+double
+AcceleratorPool::GetVoltage() const
+{
+    if (m_accelerators.empty())
+    {
+        return 0.0;
+    }
+    double sum = 0.0;
+    for (const auto& accel : m_accelerators)
+    {
+        sum += accel->GetVoltage();
+    }
+    return sum / m_accelerators.size();
+}
+
+double
+AcceleratorPool::GetCurrentPower() const
+{
+    double total = 0.0;
+    for (const auto& accel : m_accelerators)
+    {
+        total += accel->GetCurrentPower();
+    }
+    return total;
+}
+
+double
+AcceleratorPool::GetTotalEnergy() const
+{
+    double total = 0.0;
+    for (const auto& accel : m_accelerators)
+    {
+        total += accel->GetTotalEnergy();
+    }
+    return total;
+}
+
+Time
+AcceleratorPool::GetBusyTime() const
+{
+    Time total = Seconds(0);
+    for (const auto& accel : m_accelerators)
+    {
+        total += accel->GetBusyTime();
+    }
+    return total;
+}
+
+double
+AcceleratorPool::GetTemperature() const
+{
+    double hottest = 0.0;
+    for (const auto& accel : m_accelerators)
+    {
+        hottest = std::max(hottest, accel->GetTemperature());
+    }
+    return hottest;
+}
+
+bool
+AcceleratorPool::IsThrottled() const
+{
+    for (const auto& accel : m_accelerators)
+    {
+        if (accel->IsThrottled())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace ns3
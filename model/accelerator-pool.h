@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#ifndef ACCELERATOR_POOL_H
+#define ACCELERATOR_POOL_H
+
+#include "accelerator.h"
+#include "task.h"
+
+#include "ns3/object.h"
+#include "ns3/ptr.h"
+
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @ingroup distributed
+ * @brief Node-level pool of accelerators sharing one backend address.
+ *
+ * ns-3 aggregation allows only one Accelerator per node, so a multi-GPU
+ * server is modelled by aggregating an AcceleratorPool instead. The pool
+ * holds the local devices and picks one for each incoming task. PeriodicServer
+ * uses the pool when present and falls back to the single aggregated
+ * Accelerator otherwise.
+ *
+ * Example usage:
+ * @code
+ * Ptr<AcceleratorPool> pool = CreateObject<AcceleratorPool>();
+ * pool->Add(gpu0);
+ * pool->Add(gpu1);
+ * serverNode->AggregateObject(pool);
+ * @endcode
+ */
+class AcceleratorPool : public Object
+{
+  public:
+    /**
+     * @brief Local dispatch policy for choosing a device.
+     */
+    enum DispatchPolicy
+    {
+        LEAST_QUEUE, //!< Shortest queue across all devices
+        TYPE_MATCH   //!< Shortest queue among devices matching the required type
+    };
+
+    /**
+     * @brief Get the type ID.
+     * @return The object TypeId.
+     */
+    static TypeId GetTypeId();
+
+    AcceleratorPool();
+    ~AcceleratorPool() override;
+
+    /**
+     * @brief Add an accelerator to the pool.
+     * @param accel The accelerator to add.
+     */
+    void Add(Ptr<Accelerator> accel);
+
+    /**
+     * @brief Get the number of accelerators in the pool.
+     * @return Number of accelerators.
+     */
+    uint32_t GetN() const;
+
+    /**
+     * @brief Get an accelerator by index.
+     * @param idx The device index.
+     * @return The accelerator.
+     */
+    Ptr<Accelerator> Get(uint32_t idx) const;
+
+    /**
+     * @brief Choose the device that should execute a task.
+     *
+     * With TYPE_MATCH, devices whose GetName() equals the task's required
+     * accelerator type are preferred; if none match, all devices are
+     * considered. Ties are broken by lowest index.
+     *
+     * @param task The task to place.
+     * @return The chosen device index, or -1 if the pool is empty.
+     */
+    int32_t Select(Ptr<const Task> task) const;
+
+    /**
+     * @brief Get the total queue length across all devices.
+     * @return Sum of per-device queue lengths.
+     */
+    uint32_t GetQueueLength() const;
+
+    /**
+     * @brief Check if any device is busy.
+     * @return True if at least one device is executing a task.
+     */
+    bool IsBusy() const;
+
+    /**
+     * @brief Get the mean frequency across devices.
+     * @return Mean operating frequency in Hz, or 0 if empty.
+     */
+    double GetFrequency() const;
+
+    /**
+     * @brief Get the mean voltage across devices.
+     * @return Mean operating voltage in Volts, or 0 if empty.
+     */
+    double GetVoltage() const;
+
+    /**
+     * @brief Get the total current power across devices.
+     * @return Sum of per-device power in Watts.
+     */
+    double GetCurrentPower() const;
+
+    /**
+     * @brief Get the total energy consumed across devices.
+     * @return Sum of per-device energy in Joules.
+     */
+    double GetTotalEnergy() const;
+
+    /**
+     * @brief Get the total busy time across devices.
+     * @return Sum of per-device busy time.
+     */
+    Time GetBusyTime() const;
+
+    /**
+     * @brief Get the hottest device temperature.
+     * @return Maximum per-device temperature in degrees Celsius, or 0 if empty.
+     */
+    double GetTemperature() const;
+
+    /**
+     * @brief Check if any device is thermally throttled.
+     * @return True if at least one device is throttled.
+     */
+    bool IsThrottled() const;
+
+  protected:
+    void DoDispose() override;
+
+  private:
+    std::vector<Ptr<Accelerator>> m_accelerators; //!< Devices in the pool
+    DispatchPolicy m_dispatchPolicy;              //!< Local dispatch policy
+};
+
+} // namespace ns3
+
+#endif // ACCELERATOR_POOL_H
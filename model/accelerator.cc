@@ -8,8 +8,7 @@
 
 #include "accelerator.h"
 
-#include "energy-model.h"
-
+#include "ns3/double.h"
 #include "ns3/log.h"
 #include "ns3/node.h"
 #include "ns3/pointer.h"
@@ -17,6 +16,7 @@
 #include "ns3/uinteger.h"
 
 #include <algorithm>
+#include <limits>
 
 namespace ns3
 {
@@ -37,6 +37,26 @@ Accelerator::GetTypeId()
                           PointerValue(),
                           MakePointerAccessor(&Accelerator::m_energyModel),
                           MakePointerChecker<EnergyModel>())
+            .AddAttribute("TransitionLatency",
+                          "Default time to complete a DVFS frequency transition",
+                          TimeValue(Seconds(0)),
+                          MakeTimeAccessor(&Accelerator::m_transitionLatency),
+                          MakeTimeChecker(Seconds(0)))
+            .AddAttribute("TransitionEnergy",
+                          "Energy overhead of one DVFS frequency transition in Joules",
+                          DoubleValue(0.0),
+                          MakeDoubleAccessor(&Accelerator::m_transitionEnergy),
+                          MakeDoubleChecker<double>(0.0))
+            .AddAttribute("ThermalModel",
+                          "Thermal model for temperature tracking and throttling",
+                          PointerValue(),
+                          MakePointerAccessor(&Accelerator::m_thermalModel),
+                          MakePointerChecker<ThermalModel>())
+            .AddAttribute("BootDelay",
+                          "Time from PowerOn() until the accelerator can accept work",
+                          TimeValue(Seconds(0)),
+                          MakeTimeAccessor(&Accelerator::m_bootDelay),
+                          MakeTimeChecker(Seconds(0)))
             .AddTraceSource("TaskStarted",
                             "Trace fired when a task starts execution.",
                             MakeTraceSourceAccessor(&Accelerator::m_taskStartedTrace),
@@ -60,7 +80,15 @@ Accelerator::GetTypeId()
             .AddTraceSource("TaskEnergy",
                             "Trace fired when a task completes with its energy consumption.",
                             MakeTraceSourceAccessor(&Accelerator::m_taskEnergyTrace),
-                            "ns3::Accelerator::TaskEnergyTracedCallback");
+                            "ns3::Accelerator::TaskEnergyTracedCallback")
+            .AddTraceSource("IdleStateResidency",
+                            "Trace fired when the accelerator leaves an idle state.",
+                            MakeTraceSourceAccessor(&Accelerator::m_idleStateResidencyTrace),
+                            "ns3::Accelerator::IdleStateResidencyTracedCallback")
+            .AddTraceSource("ThermalThrottle",
+                            "Trace fired when thermal throttling engages, steps or releases.",
+                            MakeTraceSourceAccessor(&Accelerator::m_thermalThrottleTrace),
+                            "ns3::Accelerator::ThermalThrottleTracedCallback");
     return tid;
 }
 
@@ -70,7 +98,18 @@ Accelerator::Accelerator()
       m_lastEnergyUpdateTime(Seconds(-1)), // Sentinel value: not yet initialized
       m_totalEnergy(0.0),
       m_currentPower(0.0),
-      m_taskStartEnergy(0.0)
+      m_taskStartEnergy(0.0),
+      m_transitionLatency(Seconds(0)),
+      m_transitionEnergy(0.0),
+      m_pendingTransitions(0),
+      m_idle(false),
+      m_idleState(0),
+      m_thermalModel(nullptr),
+      m_thermalCap(std::numeric_limits<double>::infinity()),
+      m_requestedFrequency(-1),
+      m_applyingThermalCap(false),
+      m_bootDelay(Seconds(0)),
+      m_poweredOn(true)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -86,12 +125,30 @@ Accelerator::GetQueueLength() const
     return 0;
 }
 
+Ptr<Task>
+Accelerator::StealQueuedTask()
+{
+    return nullptr;
+}
+
+Ptr<Task>
+Accelerator::RemoveQueuedTask(uint64_t taskId)
+{
+    return nullptr;
+}
+
 bool
 Accelerator::IsBusy() const
 {
     return false;
 }
 
+Time
+Accelerator::GetBusyTime() const
+{
+    return Seconds(0);
+}
+
 double
 Accelerator::GetVoltage() const
 {
@@ -116,11 +173,31 @@ Accelerator::SetVoltage(double voltage)
     NS_LOG_FUNCTION(this << voltage);
 }
 
+uint64_t
+Accelerator::GetMemoryCapacity() const
+{
+    return 0;
+}
+
+bool
+Accelerator::IsModelResident(const std::string& modelId) const
+{
+    NS_LOG_FUNCTION(this << modelId);
+    return true;
+}
+
 void
 Accelerator::AddOperatingPoint(double frequency, double voltage)
 {
     NS_LOG_FUNCTION(this << frequency << voltage);
-    OperatingPoint opp{frequency, voltage};
+    AddOperatingPoint(frequency, voltage, Seconds(0));
+}
+
+void
+Accelerator::AddOperatingPoint(double frequency, double voltage, Time transitionLatency)
+{
+    NS_LOG_FUNCTION(this << frequency << voltage << transitionLatency);
+    OperatingPoint opp{frequency, voltage, transitionLatency};
     auto it = std::lower_bound(
         m_operatingPoints.begin(),
         m_operatingPoints.end(),
@@ -135,6 +212,19 @@ Accelerator::GetOperatingPoints() const
     return m_operatingPoints;
 }
 
+Time
+Accelerator::GetTransitionLatency(double frequency) const
+{
+    for (const auto& opp : m_operatingPoints)
+    {
+        if (opp.frequency == frequency && opp.transitionLatency.IsStrictlyPositive())
+        {
+            return opp.transitionLatency;
+        }
+    }
+    return m_transitionLatency;
+}
+
 Ptr<Node>
 Accelerator::GetNode() const
 {
@@ -153,16 +243,15 @@ Accelerator::GetTotalEnergy() const
     return m_totalEnergy;
 }
 
-void
-Accelerator::UpdateEnergyState(bool active, double utilization)
+Ptr<EnergyModel>
+Accelerator::GetEnergyModel() const
 {
-    NS_LOG_FUNCTION(this << active << utilization);
-
-    if (!m_energyModel)
-    {
-        return;
-    }
+    return m_energyModel;
+}
 
+void
+Accelerator::AccumulateEnergy()
+{
     Time now = Simulator::Now();
 
     if (m_lastEnergyUpdateTime.IsStrictlyNegative())
@@ -171,36 +260,38 @@ Accelerator::UpdateEnergyState(bool active, double utilization)
         if (idleState.valid)
         {
             m_currentPower = idleState.GetTotalPower();
-            // Accumulate idle energy from simulation start to now
-            if (now > Seconds(0))
-            {
-                m_totalEnergy = m_currentPower * now.GetSeconds();
-            }
         }
-        m_lastEnergyUpdateTime = now;
+        // Accumulate idle energy from simulation start to now
+        m_totalEnergy = 0.0;
+        m_lastEnergyUpdateTime = Seconds(0);
     }
 
     // Accumulate energy from previous state
     if (m_lastEnergyUpdateTime < now)
     {
-        double elapsed = (now - m_lastEnergyUpdateTime).GetSeconds();
-        if (elapsed > 0)
+        Time elapsed = now - m_lastEnergyUpdateTime;
+        m_totalEnergy += m_currentPower * elapsed.GetSeconds();
+
+        // Power is constant between update points, so the RC model advances exactly
+        if (m_thermalModel)
         {
-            m_totalEnergy += m_currentPower * elapsed;
+            m_thermalModel->Update(m_currentPower, elapsed);
         }
     }
 
-    // Calculate new power state
-    EnergyModel::PowerState powerState;
-    if (active)
+    // Charge fixed DVFS transition overheads
+    if (m_pendingTransitions > 0)
     {
-        powerState = m_energyModel->CalculateActivePower(this, utilization);
-    }
-    else
-    {
-        powerState = m_energyModel->CalculateIdlePower(this);
+        m_totalEnergy += m_pendingTransitions * m_transitionEnergy;
+        m_pendingTransitions = 0;
     }
 
+    m_lastEnergyUpdateTime = now;
+}
+
+void
+Accelerator::SetPowerState(const EnergyModel::PowerState& powerState)
+{
     if (powerState.valid)
     {
         m_currentPower = powerState.GetTotalPower();
@@ -210,8 +301,321 @@ Accelerator::UpdateEnergyState(bool active, double utilization)
         NS_LOG_DEBUG("Energy state updated: power=" << m_currentPower
                                                     << "W, totalEnergy=" << m_totalEnergy << "J");
     }
+    ScheduleThermalEvent();
+}
 
-    m_lastEnergyUpdateTime = now;
+void
+Accelerator::UpdateEnergyState(bool active, double utilization)
+{
+    NS_LOG_FUNCTION(this << active << utilization);
+
+    if (!m_energyModel)
+    {
+        return;
+    }
+
+    AccumulateEnergy();
+
+    if (!m_poweredOn)
+    {
+        return;
+    }
+
+    if (active)
+    {
+        LeaveIdle();
+        SetPowerState(m_energyModel->CalculateActivePower(this, utilization));
+        return;
+    }
+
+    if (!m_idle)
+    {
+        m_idle = true;
+        m_idleState = 0;
+        m_idleStart = Simulator::Now();
+        m_idleStateEntry = m_idleStart;
+        ScheduleNextIdleState();
+    }
+    SetPowerState(m_energyModel->CalculateIdleStatePower(this, m_idleState));
+}
+
+uint32_t
+Accelerator::GetIdleState() const
+{
+    return m_idleState;
+}
+
+void
+Accelerator::PowerOff()
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT_MSG(!IsBusy(), "Cannot power off a busy accelerator");
+
+    if (!m_poweredOn)
+    {
+        return;
+    }
+    m_poweredOn = false;
+
+    if (m_energyModel)
+    {
+        AccumulateEnergy();
+        LeaveIdle();
+        SetPowerState(EnergyModel::PowerState(0.0, 0.0));
+    }
+}
+
+Time
+Accelerator::PowerOn()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (m_poweredOn)
+    {
+        return Seconds(0);
+    }
+    m_poweredOn = true;
+
+    // Booting draws idle power
+    UpdateEnergyState(false, 0.0);
+    return m_bootDelay;
+}
+
+bool
+Accelerator::IsPoweredOn() const
+{
+    return m_poweredOn;
+}
+
+Time
+Accelerator::WakeFromIdle()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (!m_energyModel || !m_idle || m_idleState == 0)
+    {
+        return Seconds(0);
+    }
+
+    Time latency = m_energyModel->GetIdleState(m_idleState).wakeLatency;
+    NS_LOG_DEBUG("Waking from idle state " << m_idleState << " in " << latency);
+
+    AccumulateEnergy();
+    LeaveIdle();
+    // Power up at shallow idle power until the first task starts
+    SetPowerState(m_energyModel->CalculateIdlePower(this));
+    return latency;
+}
+
+void
+Accelerator::ScheduleNextIdleState()
+{
+    uint32_t next = m_idleState + 1;
+    if (next >= m_energyModel->GetNIdleStates())
+    {
+        return;
+    }
+    Time enterAt = m_idleStart + m_energyModel->GetIdleState(next).residency;
+    Time delay = std::max(enterAt - Simulator::Now(), Seconds(0));
+    m_idleStateEvent = Simulator::Schedule(delay, &Accelerator::EnterIdleState, this, next);
+}
+
+void
+Accelerator::EnterIdleState(uint32_t state)
+{
+    NS_LOG_FUNCTION(this << state);
+
+    AccumulateEnergy();
+    m_idleStateResidencyTrace(m_idleState, Simulator::Now() - m_idleStateEntry);
+    m_idleState = state;
+    m_idleStateEntry = Simulator::Now();
+    SetPowerState(m_energyModel->CalculateIdleStatePower(this, m_idleState));
+    ScheduleNextIdleState();
+}
+
+void
+Accelerator::LeaveIdle()
+{
+    if (!m_idle)
+    {
+        return;
+    }
+    Simulator::Cancel(m_idleStateEvent);
+    m_idleStateResidencyTrace(m_idleState, Simulator::Now() - m_idleStateEntry);
+    m_idle = false;
+    m_idleState = 0;
+}
+
+double
+Accelerator::GetTemperature() const
+{
+    if (!m_thermalModel)
+    {
+        return 0.0;
+    }
+    if (m_lastEnergyUpdateTime.IsStrictlyNegative())
+    {
+        return m_thermalModel->GetTemperature();
+    }
+    return m_thermalModel->Project(m_currentPower, Simulator::Now() - m_lastEnergyUpdateTime);
+}
+
+bool
+Accelerator::IsThrottled() const
+{
+    return m_thermalCap < std::numeric_limits<double>::infinity();
+}
+
+double
+Accelerator::ClampFrequencyToThermalCap(double frequency)
+{
+    if (!m_applyingThermalCap)
+    {
+        m_requestedFrequency = frequency;
+    }
+    return std::min(frequency, m_thermalCap);
+}
+
+double
+Accelerator::ClampVoltageToThermalCap(double voltage) const
+{
+    if (!IsThrottled() || m_applyingThermalCap)
+    {
+        return voltage;
+    }
+    for (const auto& opp : m_operatingPoints)
+    {
+        if (opp.frequency == m_thermalCap)
+        {
+            return std::min(voltage, opp.voltage);
+        }
+    }
+    return voltage;
+}
+
+double
+Accelerator::GetNextLowerFrequency() const
+{
+    double current = std::min(GetFrequency(), m_thermalCap);
+    auto it = std::lower_bound(
+        m_operatingPoints.begin(),
+        m_operatingPoints.end(),
+        current,
+        [](const OperatingPoint& opp, double freq) { return opp.frequency < freq; });
+    return it == m_operatingPoints.begin() ? -1.0 : std::prev(it)->frequency;
+}
+
+void
+Accelerator::ScheduleThermalEvent()
+{
+    if (!m_thermalModel || m_operatingPoints.empty())
+    {
+        return;
+    }
+
+    double temperature = m_thermalModel->GetTemperature();
+    bool hot = temperature >= m_thermalModel->GetThrottleTemperature() - THERMAL_TOLERANCE;
+    bool canStepDown = GetNextLowerFrequency() > 0;
+    bool canStepUp = IsThrottled() &&
+                     temperature <= m_thermalModel->GetReleaseTemperature() + THERMAL_TOLERANCE;
+
+    // Step through the OPP table at the poll interval while a step is possible
+    if ((hot && canStepDown) || canStepUp)
+    {
+        if (!m_thermalEvent.IsPending())
+        {
+            m_thermalEvent = Simulator::Schedule(m_thermalModel->GetPollInterval(),
+                                                 &Accelerator::ThermalEvent,
+                                                 this);
+        }
+        return;
+    }
+
+    // Otherwise wake up when the current power drives the die across a threshold
+    Simulator::Cancel(m_thermalEvent);
+    double threshold = IsThrottled() ? m_thermalModel->GetReleaseTemperature()
+                                     : m_thermalModel->GetThrottleTemperature();
+    Time crossing = m_thermalModel->GetTimeToReach(m_currentPower, threshold);
+    if (crossing != Time::Max() && (!hot || IsThrottled()))
+    {
+        m_thermalEvent = Simulator::Schedule(crossing, &Accelerator::ThermalEvent, this);
+    }
+}
+
+void
+Accelerator::ThermalEvent()
+{
+    NS_LOG_FUNCTION(this);
+
+    AccumulateEnergy();
+    double temperature = m_thermalModel->GetTemperature();
+
+    if (temperature >= m_thermalModel->GetThrottleTemperature() - THERMAL_TOLERANCE)
+    {
+        double lower = GetNextLowerFrequency();
+        if (lower > 0)
+        {
+            if (m_requestedFrequency < 0)
+            {
+                m_requestedFrequency = GetFrequency();
+            }
+            m_thermalCap = lower;
+            NS_LOG_INFO("Thermal throttle at " << temperature << " C, cap " << m_thermalCap);
+            m_thermalThrottleTrace(true, temperature, m_thermalCap);
+            ApplyThermalCap();
+        }
+    }
+    else if (IsThrottled() &&
+             temperature <= m_thermalModel->GetReleaseTemperature() + THERMAL_TOLERANCE)
+    {
+        // Step the cap back up one OPP, releasing it at the top of the table
+        auto it = std::upper_bound(
+            m_operatingPoints.begin(),
+            m_operatingPoints.end(),
+            m_thermalCap,
+            [](double freq, const OperatingPoint& opp) { return freq < opp.frequency; });
+        if (it == m_operatingPoints.end() || std::next(it) == m_operatingPoints.end())
+        {
+            m_thermalCap = std::numeric_limits<double>::infinity();
+            NS_LOG_INFO("Thermal throttle released at " << temperature << " C");
+            m_thermalThrottleTrace(false, temperature, m_requestedFrequency);
+        }
+        else
+        {
+            m_thermalCap = it->frequency;
+            NS_LOG_INFO("Thermal cap raised to " << m_thermalCap << " at " << temperature << " C");
+            m_thermalThrottleTrace(true, temperature, m_thermalCap);
+        }
+        ApplyThermalCap();
+    }
+
+    ScheduleThermalEvent();
+}
+
+void
+Accelerator::ApplyThermalCap()
+{
+    NS_LOG_FUNCTION(this);
+
+    double target = std::min(m_requestedFrequency, m_thermalCap);
+    m_applyingThermalCap = true;
+    SetFrequency(target);
+    for (const auto& opp : m_operatingPoints)
+    {
+        if (opp.frequency == target)
+        {
+            SetVoltage(opp.voltage);
+            break;
+        }
+    }
+    m_applyingThermalCap = false;
+}
+
+void
+Accelerator::NotifyFrequencyTransition()
+{
+    NS_LOG_FUNCTION(this);
+    m_pendingTransitions++;
 }
 
 void
@@ -232,6 +636,10 @@ Accelerator::DoDispose()
 {
     NS_LOG_FUNCTION(this);
 
+    Simulator::Cancel(m_idleStateEvent);
+    Simulator::Cancel(m_thermalEvent);
+    m_thermalModel = nullptr;
+
     // Final energy update if we have an active energy model
     if (m_energyModel)
     {
@@ -9,8 +9,11 @@
 #ifndef ACCELERATOR_H
 #define ACCELERATOR_H
 
+#include "energy-model.h"
 #include "task.h"
+#include "thermal-model.h"
 
+#include "ns3/event-id.h"
 #include "ns3/nstime.h"
 #include "ns3/object.h"
 #include "ns3/ptr.h"
@@ -22,7 +25,6 @@ namespace ns3
 {
 
 class Node;
-class EnergyModel;
 
 /**
  * @ingroup distributed
@@ -33,8 +35,9 @@ class EnergyModel;
  */
 struct OperatingPoint
 {
-    double frequency; //!< Operating frequency in Hz
-    double voltage;   //!< Operating voltage in Volts
+    double frequency;          //!< Operating frequency in Hz
+    double voltage;            //!< Operating voltage in Volts
+    Time transitionLatency{0}; //!< Latency to switch into this point (0 = device default)
 };
 
 /**
@@ -111,6 +114,27 @@ class Accelerator : public Object
      */
     virtual uint32_t GetQueueLength() const;
 
+    /**
+     * @brief Remove a queued task that has not started, to run it elsewhere.
+     *
+     * Default implementation returns nullptr. Override in subclasses that
+     * maintain a task queue.
+     *
+     * @return The task that would have started last, or nullptr if none.
+     */
+    virtual Ptr<Task> StealQueuedTask();
+
+    /**
+     * @brief Withdraw a queued task that has not started.
+     *
+     * Default implementation returns nullptr. Override in subclasses that
+     * maintain a task queue.
+     *
+     * @param taskId The task ID.
+     * @return The task, or nullptr if it is not queued (e.g. already running).
+     */
+    virtual Ptr<Task> RemoveQueuedTask(uint64_t taskId);
+
     /**
      * @brief Check if accelerator is currently busy.
      *
@@ -121,6 +145,16 @@ class Accelerator : public Object
      */
     virtual bool IsBusy() const;
 
+    /**
+     * @brief Get the cumulative time spent executing tasks.
+     *
+     * Default implementation returns 0. Override in subclasses that
+     * track execution state.
+     *
+     * @return Total busy time since the simulation started.
+     */
+    virtual Time GetBusyTime() const;
+
     /**
      * @brief Get the current operating voltage.
      *
@@ -161,6 +195,27 @@ class Accelerator : public Object
      */
     virtual void SetVoltage(double voltage);
 
+    /**
+     * @brief Get the device memory capacity.
+     *
+     * Default implementation returns 0, meaning the accelerator does not
+     * model device memory. Override in subclasses with a model cache.
+     *
+     * @return Device memory capacity in bytes.
+     */
+    virtual uint64_t GetMemoryCapacity() const;
+
+    /**
+     * @brief Check whether a model's weights are resident in device memory.
+     *
+     * Default implementation returns true: accelerators without a memory
+     * model never pay a cold-start penalty.
+     *
+     * @param modelId The model identifier.
+     * @return True if the model can run without loading weights.
+     */
+    virtual bool IsModelResident(const std::string& modelId) const;
+
     /**
      * @brief Add a discrete operating point (frequency-voltage pair).
      *
@@ -173,12 +228,32 @@ class Accelerator : public Object
      */
     void AddOperatingPoint(double frequency, double voltage);
 
+    /**
+     * @brief Add an operating point with its own transition latency.
+     *
+     * @param frequency Operating frequency in Hz.
+     * @param voltage Operating voltage in Volts.
+     * @param transitionLatency Time needed to switch into this point.
+     */
+    void AddOperatingPoint(double frequency, double voltage, Time transitionLatency);
+
     /**
      * @brief Get the operating point table.
      * @return Const reference to the OPP table, sorted by frequency ascending.
      */
     const std::vector<OperatingPoint>& GetOperatingPoints() const;
 
+    /**
+     * @brief Get the latency of a DVFS transition to a target frequency.
+     *
+     * Uses the matching OPP's transition latency when it is set, otherwise
+     * the TransitionLatency attribute.
+     *
+     * @param frequency The target frequency in Hz.
+     * @return The transition latency.
+     */
+    Time GetTransitionLatency(double frequency) const;
+
     /**
      * @brief Get the node this accelerator is aggregated to.
      * @return Pointer to the node, or nullptr if not aggregated.
@@ -199,6 +274,59 @@ class Accelerator : public Object
      */
     double GetTotalEnergy() const;
 
+    /**
+     * @brief Get the configured energy model.
+     *
+     * @return The energy model, or nullptr if none is configured.
+     */
+    Ptr<EnergyModel> GetEnergyModel() const;
+
+    /**
+     * @brief Get the current device temperature.
+     *
+     * @return Temperature in degrees Celsius, or 0 if no ThermalModel is configured.
+     */
+    double GetTemperature() const;
+
+    /**
+     * @brief Check if the accelerator is thermally throttled.
+     *
+     * While throttled, requested frequencies above the thermal cap are
+     * clamped to it.
+     *
+     * @return True if the frequency is capped by the thermal model.
+     */
+    bool IsThrottled() const;
+
+    /**
+     * @brief Get the current idle state.
+     * @return The idle state index (0 = active or shallow idle).
+     */
+    uint32_t GetIdleState() const;
+
+    /**
+     * @brief Power the accelerator down to a zero-power state.
+     *
+     * The accelerator must be idle. No energy is consumed until PowerOn().
+     */
+    void PowerOff();
+
+    /**
+     * @brief Power the accelerator back up.
+     *
+     * The accelerator draws idle power from now on, but should not be given
+     * work until the returned boot delay has elapsed.
+     *
+     * @return The boot delay (zero if already powered on).
+     */
+    Time PowerOn();
+
+    /**
+     * @brief Check whether the accelerator is powered on.
+     * @return True unless PowerOff() was called without a later PowerOn().
+     */
+    bool IsPoweredOn() const;
+
     /**
      * @brief TracedCallback signature for task events.
      * @param task The task.
@@ -238,6 +366,23 @@ class Accelerator : public Object
      */
     typedef void (*TaskEnergyTracedCallback)(Ptr<const Task> task, double energy);
 
+    /**
+     * @brief TracedCallback signature for idle state residency.
+     * @param state The idle state being left (0 = shallow idle).
+     * @param residency Time spent in the state.
+     */
+    typedef void (*IdleStateResidencyTracedCallback)(uint32_t state, Time residency);
+
+    /**
+     * @brief TracedCallback signature for thermal throttling changes.
+     * @param throttled Whether the accelerator is throttled after the change.
+     * @param temperature Temperature at the change in degrees Celsius.
+     * @param frequency The frequency cap, or the restored frequency when released.
+     */
+    typedef void (*ThermalThrottleTracedCallback)(bool throttled,
+                                                  double temperature,
+                                                  double frequency);
+
   protected:
     void DoDispose() override;
     void NotifyNewAggregate() override;
@@ -247,14 +392,51 @@ class Accelerator : public Object
      *
      * This method should be called by subclasses when the accelerator's
      * activity state changes (e.g., starting or completing a task).
-     * It accumulates energy from the previous state and calculates the
-     * new power consumption.
+     * It accumulates energy from the previous state, including any pending
+     * DVFS transition overhead, and calculates the new power consumption.
      *
      * @param active Whether the accelerator is currently active.
      * @param utilization Current utilization level [0.0, 1.0].
      */
     void UpdateEnergyState(bool active, double utilization);
 
+    /**
+     * @brief Charge the fixed energy overhead of one DVFS transition.
+     *
+     * The TransitionEnergy cost is added to the total on the next
+     * UpdateEnergyState() call. Subclasses call this whenever they begin
+     * a frequency change.
+     */
+    void NotifyFrequencyTransition();
+
+    /**
+     * @brief Leave a deep idle state ahead of new work.
+     *
+     * Subclasses call this when a task arrives at an idle accelerator and
+     * delay its start by the returned latency.
+     *
+     * @return The wake-up latency of the current idle state (zero if not in deep idle).
+     */
+    Time WakeFromIdle();
+
+    /**
+     * @brief Record a requested frequency and clamp it to the thermal cap.
+     *
+     * Subclasses call this at the start of SetFrequency(). The requested
+     * frequency is restored once throttling is released.
+     *
+     * @param frequency The requested frequency in Hz.
+     * @return The frequency to apply in Hz.
+     */
+    double ClampFrequencyToThermalCap(double frequency);
+
+    /**
+     * @brief Clamp a requested voltage to the thermal cap's operating point.
+     * @param voltage The requested voltage in Volts.
+     * @return The voltage to apply in Volts.
+     */
+    double ClampVoltageToThermalCap(double voltage) const;
+
     /**
      * @brief Record the current energy as baseline for task energy tracking.
      *
@@ -280,12 +462,87 @@ class Accelerator : public Object
     TracedCallback<Ptr<const Task>, double> m_taskEnergyTrace;      //!< Per-task energy
 
   private:
+    /**
+     * @brief Slack in Kelvin when comparing against thermal thresholds, so
+     * that events scheduled at a predicted crossing are not lost to rounding.
+     */
+    static constexpr double THERMAL_TOLERANCE = 1e-6;
+
+    /**
+     * @brief Accumulate energy at the current power since the last update.
+     */
+    void AccumulateEnergy();
+
+    /**
+     * @brief Adopt a new power state and fire the power and energy traces.
+     * @param powerState The new power state (ignored if invalid).
+     */
+    void SetPowerState(const EnergyModel::PowerState& powerState);
+
+    /**
+     * @brief Schedule entry into the next deeper idle state, if any.
+     */
+    void ScheduleNextIdleState();
+
+    /**
+     * @brief Enter a deeper idle state once its residency threshold is reached.
+     * @param state The idle state index.
+     */
+    void EnterIdleState(uint32_t state);
+
+    /**
+     * @brief Leave idle, recording residency in the current idle state.
+     */
+    void LeaveIdle();
+
+    /**
+     * @brief Get the highest OPP frequency below the current clock and cap.
+     * @return The frequency in Hz, or -1 if already at the bottom of the table.
+     */
+    double GetNextLowerFrequency() const;
+
+    /**
+     * @brief Schedule the next thermal throttling evaluation.
+     *
+     * While cool, the event is placed at the predicted threshold crossing
+     * under the current power; while hot or throttled, it polls.
+     */
+    void ScheduleThermalEvent();
+
+    /**
+     * @brief Step the thermal cap down or up the OPP table.
+     */
+    void ThermalEvent();
+
+    /**
+     * @brief Apply min(requested, cap) through SetFrequency()/SetVoltage().
+     */
+    void ApplyThermalCap();
+
     Ptr<EnergyModel> m_energyModel;                //!< Energy model for power calculation
     Time m_lastEnergyUpdateTime;                   //!< Time of last energy state update
     double m_totalEnergy;                          //!< Total energy consumed in Joules
     double m_currentPower;                         //!< Current power consumption in Watts
     double m_taskStartEnergy;                      //!< Energy at task start for per-task tracking
     std::vector<OperatingPoint> m_operatingPoints; //!< OPP table sorted by frequency
+    Time m_transitionLatency;                      //!< Default DVFS transition latency
+    double m_transitionEnergy;                     //!< Energy per DVFS transition in Joules
+    uint32_t m_pendingTransitions;                 //!< Transitions not yet charged
+    bool m_idle;                                   //!< Accelerator is idle
+    uint32_t m_idleState;                          //!< Current idle state (0 = shallow)
+    Time m_idleStart;                              //!< When the current idle period began
+    Time m_idleStateEntry;                         //!< When the current idle state was entered
+    EventId m_idleStateEvent;                      //!< Pending entry into a deeper idle state
+    Ptr<ThermalModel> m_thermalModel;              //!< Thermal model driving throttling
+    double m_thermalCap;                           //!< Frequency cap in Hz (infinity if none)
+    double m_requestedFrequency;                   //!< Last requested frequency (-1 if unset)
+    bool m_applyingThermalCap;                     //!< SetFrequency() call is from throttling
+    EventId m_thermalEvent;                        //!< Pending throttling evaluation
+    Time m_bootDelay;                              //!< Delay from PowerOn() until usable
+    bool m_poweredOn;                              //!< Not in the zero-power off state
+
+    TracedCallback<uint32_t, Time> m_idleStateResidencyTrace; //!< Idle state residency
+    TracedCallback<bool, double, double> m_thermalThrottleTrace; //!< Throttling changes
 };
 
 } // namespace ns3
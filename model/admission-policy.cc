@@ -35,6 +35,36 @@ AdmissionPolicy::~AdmissionPolicy()
     NS_LOG_FUNCTION(this);
 }
 
+bool
+AdmissionPolicy::ShouldAdmitFrom(const Address& client,
+                                 Ptr<DagTask> dag,
+                                 const Cluster& cluster,
+                                 const ClusterState& state)
+{
+    return ShouldAdmit(dag, cluster, state);
+}
+
+bool
+AdmissionPolicy::CheckClient(const Address& client, Ptr<DagTask> dag)
+{
+    NS_LOG_FUNCTION(this << client);
+    return true;
+}
+
+void
+AdmissionPolicy::NotifyAdmitted(const Address& client, Ptr<DagTask> dag)
+{
+    NS_LOG_FUNCTION(this << client);
+    // Default: no-op. Policies with per-client state override this.
+}
+
+const std::vector<int32_t>&
+AdmissionPolicy::GetPlacement() const
+{
+    static const std::vector<int32_t> none;
+    return none;
+}
+
 void
 AdmissionPolicy::DoDispose()
 {
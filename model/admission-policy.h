@@ -11,10 +11,12 @@
 
 #include "cluster.h"
 
+#include "ns3/address.h"
 #include "ns3/object.h"
 #include "ns3/ptr.h"
 
 #include <cstdint>
+#include <vector>
 
 namespace ns3
 {
@@ -27,11 +29,20 @@ class DagTask;
  * @brief Abstract base class for admission control policies.
  *
  * AdmissionPolicy determines whether a workload should be accepted for execution.
-
- * Implementations are stateless - the orchestrator tracks active workloads
- * and passes the count to ShouldAdmit(). This follows real-world patterns
+ *
+ * Capacity checks are stateless - the orchestrator tracks active workloads
+ * in ClusterState and passes it to ShouldAdmit(). Workloads admitted but
+ * still awaiting their data are reserved in ClusterState (see
+ * ClusterState::Reserve), so policies should count the backends' reserved
+ * work alongside their active work. This follows real-world patterns
  * from Kubernetes and Spark where admission controllers are stateless.
  *
+ * Policies may still keep state per client, such as a rate limit. The
+ * orchestrator therefore evaluates each request in three steps:
+ * CheckClient() once, ShouldAdmitFrom() for the workload and each cheaper
+ * variant tried after it, and NotifyAdmitted() once for the workload it
+ * finally admits. Only the first and last steps may change such state.
+ *
  * Example usage:
  * @code
  * Ptr<AdmissionPolicy> policy = CreateObject<AlwaysAdmitPolicy>();
@@ -69,12 +80,66 @@ class AdmissionPolicy : public Object
                              const Cluster& cluster,
                              const ClusterState& state) = 0;
 
+    /**
+     * @brief Check if a workload from a given client should be admitted.
+     *
+     * The orchestrator admits through this method so that policies can
+     * treat clients differently. The default ignores the client and defers
+     * to ShouldAdmit().
+     *
+     * @param client Address of the requesting client
+     * @param dag The workload DAG
+     * @param cluster Current cluster state with available backends
+     * @param state Per-backend load and device metrics
+     * @return true if the workload should be admitted, false if rejected
+     */
+    virtual bool ShouldAdmitFrom(const Address& client,
+                                 Ptr<DagTask> dag,
+                                 const Cluster& cluster,
+                                 const ClusterState& state);
+
+    /**
+     * @brief Check whether a client may submit a workload at all.
+     *
+     * Called once per request, before ShouldAdmitFrom() is tried on the
+     * workload and its variants, so that per-client limits are applied and
+     * reported once however many variants are tried. The default admits
+     * every client.
+     *
+     * @param client Address of the requesting client
+     * @param dag The workload DAG as requested
+     * @return true if the client's workload may be considered
+     */
+    virtual bool CheckClient(const Address& client, Ptr<DagTask> dag);
+
+    /**
+     * @brief Notify the policy that a client's workload was admitted.
+     *
+     * Called once, with the variant that was admitted. The default does
+     * nothing.
+     *
+     * @param client Address of the requesting client
+     * @param dag The admitted workload DAG
+     */
+    virtual void NotifyAdmitted(const Address& client, Ptr<DagTask> dag);
+
     /**
      * @brief Get the policy name for logging and debugging.
      * @return A string identifying this policy type.
      */
     virtual std::string GetName() const = 0;
 
+    /**
+     * @brief Get where the last admitted workload is expected to run.
+     *
+     * Policies that plan a placement while checking a workload return it
+     * here, indexed by DAG task, so that the orchestrator can reserve that
+     * capacity until the workload's data arrives. The default plans nothing.
+     *
+     * @return Backend index per DAG task (-1 = unplanned), or empty.
+     */
+    virtual const std::vector<int32_t>& GetPlacement() const;
+
   protected:
     void DoDispose() override;
 };
@@ -0,0 +1,371 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#include "backend-autoscaler.h"
+
+#include "accelerator-pool.h"
+
+#include "ns3/double.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/trace-source-accessor.h"
+#include "ns3/uinteger.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("BackendAutoscaler");
+
+NS_OBJECT_ENSURE_REGISTERED(BackendAutoscaler);
+
+TypeId
+BackendAutoscaler::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::BackendAutoscaler")
+            .SetParent<Object>()
+            .SetGroupName("Distributed")
+            .AddConstructor<BackendAutoscaler>()
+            .AddAttribute("EvaluationInterval",
+                          "Time between sizing decisions",
+                          TimeValue(Seconds(1)),
+                          MakeTimeAccessor(&BackendAutoscaler::m_evaluationInterval),
+                          MakeTimeChecker(NanoSeconds(1)))
+            .AddAttribute("ServiceRate",
+                          "Tasks per second one backend can serve",
+                          DoubleValue(10.0),
+                          MakeDoubleAccessor(&BackendAutoscaler::m_serviceRate),
+                          MakeDoubleChecker<double>(1e-9))
+            .AddAttribute("TargetUtilization",
+                          "Per-backend utilization to size for; the remainder is SLO headroom",
+                          DoubleValue(0.7),
+                          MakeDoubleAccessor(&BackendAutoscaler::m_targetUtilization),
+                          MakeDoubleChecker<double>(1e-9, 1.0))
+            .AddAttribute("MinBackends",
+                          "Number of backends never powered down",
+                          UintegerValue(1),
+                          MakeUintegerAccessor(&BackendAutoscaler::m_minBackends),
+                          MakeUintegerChecker<uint32_t>(1))
+            .AddAttribute("RateSmoothing",
+                          "EWMA weight of the newest arrival rate sample (1 = no smoothing)",
+                          DoubleValue(0.5),
+                          MakeDoubleAccessor(&BackendAutoscaler::m_rateSmoothing),
+                          MakeDoubleChecker<double>(1e-9, 1.0))
+            .AddTraceSource("ActiveBackends",
+                            "Number of backends ON or BOOTING",
+                            MakeTraceSourceAccessor(&BackendAutoscaler::m_activeBackends),
+                            "ns3::TracedValueCallback::Uint32")
+            .AddTraceSource("BackendPower",
+                            "Trace fired when a backend is powered on or off",
+                            MakeTraceSourceAccessor(&BackendAutoscaler::m_backendPowerTrace),
+                            "ns3::BackendAutoscaler::BackendPowerTracedCallback")
+            .AddTraceSource("BackendAvailable",
+                            "Trace fired when a backend becomes available for new tasks",
+                            MakeTraceSourceAccessor(&BackendAutoscaler::m_backendAvailableTrace),
+                            "ns3::BackendAutoscaler::BackendAvailableTracedCallback");
+    return tid;
+}
+
+BackendAutoscaler::BackendAutoscaler()
+    : m_evaluationInterval(Seconds(1)),
+      m_serviceRate(10.0),
+      m_targetUtilization(0.7),
+      m_minBackends(1),
+      m_rateSmoothing(0.5),
+      m_cluster(nullptr),
+      m_clusterState(nullptr),
+      m_lastDispatched(0),
+      m_arrivalRate(0.0),
+      m_rateInitialized(false),
+      m_activeBackends(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+BackendAutoscaler::~BackendAutoscaler()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+BackendAutoscaler::Start(Cluster& cluster, const ClusterState& state)
+{
+    NS_LOG_FUNCTION(this);
+    m_cluster = &cluster;
+    m_clusterState = &state;
+
+    m_states.assign(cluster.GetN(), ON);
+    m_bootEvents.resize(cluster.GetN());
+    m_activeBackends = cluster.GetN();
+
+    m_lastDispatched = 0;
+    for (uint32_t i = 0; i < state.GetN(); i++)
+    {
+        m_lastDispatched += state.Get(i).totalDispatched;
+    }
+    m_arrivalRate = 0.0;
+    m_rateInitialized = false;
+
+    m_evaluateEvent =
+        Simulator::Schedule(m_evaluationInterval, &BackendAutoscaler::Evaluate, this);
+}
+
+void
+BackendAutoscaler::Stop()
+{
+    NS_LOG_FUNCTION(this);
+    m_evaluateEvent.Cancel();
+    for (auto& event : m_bootEvents)
+    {
+        event.Cancel();
+    }
+}
+
+void
+BackendAutoscaler::NotifyTaskCompleted(uint32_t backendIdx)
+{
+    NS_LOG_FUNCTION(this << backendIdx);
+    if (backendIdx < m_states.size() && m_states[backendIdx] == DRAINING)
+    {
+        TryPowerOff(backendIdx);
+    }
+}
+
+BackendAutoscaler::PowerState
+BackendAutoscaler::GetPowerState(uint32_t backendIdx) const
+{
+    NS_ASSERT_MSG(backendIdx < m_states.size(), "Backend " << backendIdx << " out of range");
+    return m_states[backendIdx];
+}
+
+uint32_t
+BackendAutoscaler::GetActiveBackendCount() const
+{
+    return m_activeBackends;
+}
+
+double
+BackendAutoscaler::GetArrivalRate() const
+{
+    return m_arrivalRate;
+}
+
+void
+BackendAutoscaler::Evaluate()
+{
+    NS_LOG_FUNCTION(this);
+
+    uint64_t dispatched = 0;
+    for (uint32_t i = 0; i < m_clusterState->GetN(); i++)
+    {
+        dispatched += m_clusterState->Get(i).totalDispatched;
+    }
+    double sample = (dispatched - m_lastDispatched) / m_evaluationInterval.GetSeconds();
+    m_lastDispatched = dispatched;
+    m_arrivalRate = m_rateInitialized
+                        ? m_rateSmoothing * sample + (1 - m_rateSmoothing) * m_arrivalRate
+                        : sample;
+    m_rateInitialized = true;
+
+    // Retry draining backends whose work was cancelled rather than completed
+    for (uint32_t i = 0; i < m_states.size(); i++)
+    {
+        if (m_states[i] == DRAINING)
+        {
+            TryPowerOff(i);
+        }
+    }
+
+    uint32_t n = m_states.size();
+    double needed = std::ceil(m_arrivalRate / (m_serviceRate * m_targetUtilization));
+    uint32_t desired = static_cast<uint32_t>(std::min<double>(needed, n));
+    desired = std::max(desired, std::min(m_minBackends, n));
+
+    NS_LOG_DEBUG("Arrival rate " << m_arrivalRate << " tasks/s, active " << m_activeBackends
+                                 << ", desired " << desired);
+
+    // A quarantined backend is powered but takes no tasks, so it adds no capacity
+    uint32_t quarantined = 0;
+    for (uint32_t i = 0; i < m_states.size(); i++)
+    {
+        quarantined += (m_states[i] == ON && m_cluster->IsQuarantined(i)) ? 1 : 0;
+    }
+
+    while (m_activeBackends - quarantined < desired)
+    {
+        if (!ScaleUp())
+        {
+            break;
+        }
+    }
+    if (m_activeBackends - quarantined > desired)
+    {
+        ScaleDown();
+    }
+
+    m_evaluateEvent =
+        Simulator::Schedule(m_evaluationInterval, &BackendAutoscaler::Evaluate, this);
+}
+
+bool
+BackendAutoscaler::ScaleUp()
+{
+    NS_LOG_FUNCTION(this);
+
+    // A draining backend is still powered, so it can serve again immediately
+    for (uint32_t i = 0; i < m_states.size(); i++)
+    {
+        if (m_states[i] == DRAINING && !m_cluster->IsQuarantined(i))
+        {
+            NS_LOG_INFO("Backend " << i << " returned to service while draining");
+            m_states[i] = ON;
+            m_cluster->SetAvailable(i, true);
+            m_activeBackends = m_activeBackends + 1;
+            m_backendAvailableTrace(i);
+            return true;
+        }
+    }
+
+    for (uint32_t i = 0; i < m_states.size(); i++)
+    {
+        if (m_states[i] == OFF && !m_cluster->IsQuarantined(i))
+        {
+            Time bootDelay = Seconds(0);
+            for (Ptr<Accelerator> accel : GetAccelerators(i))
+            {
+                bootDelay = std::max(bootDelay, accel->PowerOn());
+            }
+            NS_LOG_INFO("Powering on backend " << i << ", available in " << bootDelay);
+            m_states[i] = BOOTING;
+            m_activeBackends = m_activeBackends + 1;
+            m_backendPowerTrace(i, true);
+            m_bootEvents[i] =
+                Simulator::Schedule(bootDelay, &BackendAutoscaler::CompleteBoot, this, i);
+            return true;
+        }
+    }
+    return false;
+}
+
+void
+BackendAutoscaler::ScaleDown()
+{
+    NS_LOG_FUNCTION(this);
+
+    // Drain the least-loaded removable backend, preferring higher indices on ties. A
+    // quarantined backend looks idle only because it is given no tasks, so it is kept.
+    int32_t victim = -1;
+    uint32_t victimLoad = UINT32_MAX;
+    for (uint32_t i = 0; i < m_states.size(); i++)
+    {
+        if (m_states[i] != ON || m_cluster->IsQuarantined(i) ||
+            m_cluster->GetAvailableBackendsByType(m_cluster->Get(i).acceleratorType).size() <= 1)
+        {
+            continue;
+        }
+        uint32_t load = m_clusterState->Get(i).activeTasks;
+        if (load <= victimLoad)
+        {
+            victim = static_cast<int32_t>(i);
+            victimLoad = load;
+        }
+    }
+    if (victim < 0)
+    {
+        NS_LOG_DEBUG("No backend can be powered down");
+        return;
+    }
+
+    uint32_t idx = static_cast<uint32_t>(victim);
+    NS_LOG_INFO("Draining backend " << idx << " (" << victimLoad << " active tasks)");
+    m_states[idx] = DRAINING;
+    m_cluster->SetAvailable(idx, false);
+    m_activeBackends = m_activeBackends - 1;
+    TryPowerOff(idx);
+}
+
+void
+BackendAutoscaler::TryPowerOff(uint32_t backendIdx)
+{
+    NS_LOG_FUNCTION(this << backendIdx);
+
+    if (m_clusterState->Get(backendIdx).activeTasks > 0)
+    {
+        return;
+    }
+
+    std::vector<Ptr<Accelerator>> accels = GetAccelerators(backendIdx);
+    for (Ptr<Accelerator> accel : accels)
+    {
+        if (accel->IsBusy())
+        {
+            NS_LOG_DEBUG("Backend " << backendIdx << " drained but still busy");
+            return;
+        }
+    }
+
+    for (Ptr<Accelerator> accel : accels)
+    {
+        accel->PowerOff();
+    }
+    NS_LOG_INFO("Powered off backend " << backendIdx);
+    m_states[backendIdx] = OFF;
+    m_backendPowerTrace(backendIdx, false);
+}
+
+void
+BackendAutoscaler::CompleteBoot(uint32_t backendIdx)
+{
+    NS_LOG_FUNCTION(this << backendIdx);
+    NS_LOG_INFO("Backend " << backendIdx << " booted");
+    m_states[backendIdx] = ON;
+    m_cluster->SetAvailable(backendIdx, true);
+    m_backendAvailableTrace(backendIdx);
+}
+
+std::vector<Ptr<Accelerator>>
+BackendAutoscaler::GetAccelerators(uint32_t backendIdx) const
+{
+    std::vector<Ptr<Accelerator>> accels;
+    Ptr<Node> node = m_cluster->Get(backendIdx).node;
+    if (!node)
+    {
+        return accels;
+    }
+
+    Ptr<Accelerator> accel = node->GetObject<Accelerator>();
+    if (accel)
+    {
+        accels.push_back(accel);
+        return accels;
+    }
+
+    Ptr<AcceleratorPool> pool = node->GetObject<AcceleratorPool>();
+    for (uint32_t i = 0; pool && i < pool->GetN(); i++)
+    {
+        accels.push_back(pool->Get(i));
+    }
+    return accels;
+}
+
+void
+BackendAutoscaler::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    Stop();
+    m_bootEvents.clear();
+    m_states.clear();
+    m_cluster = nullptr;
+    m_clusterState = nullptr;
+    Object::DoDispose();
+}
+
+} // namespace ns3
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#ifndef BACKEND_AUTOSCALER_H
+#define BACKEND_AUTOSCALER_H
+
+#include "accelerator.h"
+#include "cluster-state.h"
+#include "cluster.h"
+
+#include "ns3/event-id.h"
+#include "ns3/nstime.h"
+#include "ns3/object.h"
+#include "ns3/traced-callback.h"
+#include "ns3/traced-value.h"
+
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @ingroup distributed
+ * @brief Powers backends off and on to match the offered load.
+ *
+ * BackendAutoscaler is an optional component of EdgeOrchestrator. Every
+ * EvaluationInterval it measures the task arrival rate (dispatches per
+ * second, smoothed by an EWMA) and sizes the active set so that each
+ * backend runs at no more than TargetUtilization of its ServiceRate:
+ *
+ * active = ceil(rate / (ServiceRate * TargetUtilization))
+ *
+ * The headroom left by TargetUtilization < 1 bounds queueing delay and so
+ * protects latency SLOs. Scale-up is immediate; scale-down removes one
+ * backend per interval. Backends quarantined by the orchestrator (see
+ * Cluster::SetQuarantined) serve no tasks, so they are not counted towards
+ * the active set, chosen for power-down or powered up.
+ *
+ * Backends move through four states. An ON backend is available to the
+ * schedulers. Scaling down marks the least-loaded ON backend unavailable
+ * (DRAINING) and powers its accelerators off (OFF, zero power) once its
+ * outstanding tasks have completed. Scaling up re-enables a DRAINING backend
+ * if there is one, otherwise powers an OFF backend on (BOOTING) and makes it
+ * available once the accelerators' BootDelay has elapsed. Either way the
+ * BackendAvailable trace fires, so that work held for capacity can be
+ * released. The last available backend of each accelerator type is never
+ * powered down, so every task that could be scheduled before remains
+ * schedulable.
+ *
+ * Power is switched by calling the backend accelerators directly, modelling
+ * out-of-band management (e.g. a BMC) rather than the task protocol.
+ */
+class BackendAutoscaler : public Object
+{
+  public:
+    /**
+     * @brief Power state of a backend.
+     */
+    enum PowerState
+    {
+        ON,       //!< Powered and available for new tasks
+        DRAINING, //!< Powered, finishing outstanding tasks before power-off
+        OFF,      //!< Powered off (zero power)
+        BOOTING   //!< Powering on, available once the boot delay elapses
+    };
+
+    /**
+     * @brief Get the type ID.
+     * @return The object TypeId.
+     */
+    static TypeId GetTypeId();
+
+    BackendAutoscaler();
+    ~BackendAutoscaler() override;
+
+    /**
+     * @brief Start periodic evaluation with every backend ON.
+     *
+     * @param cluster The orchestrator's cluster, whose backend availability is
+     *                changed in place. It must outlive the autoscaler's use.
+     * @param state The cluster state. It must outlive the autoscaler's use.
+     */
+    void Start(Cluster& cluster, const ClusterState& state);
+
+    /**
+     * @brief Stop periodic evaluation and cancel pending boots.
+     */
+    void Stop();
+
+    /**
+     * @brief Notify that a task completed on a backend.
+     *
+     * Powers a DRAINING backend off as soon as its last task completes.
+     *
+     * @param backendIdx The backend index.
+     */
+    void NotifyTaskCompleted(uint32_t backendIdx);
+
+    /**
+     * @brief Get the power state of a backend.
+     * @param backendIdx The backend index.
+     * @return The power state.
+     */
+    PowerState GetPowerState(uint32_t backendIdx) const;
+
+    /**
+     * @brief Get the number of backends that are ON or BOOTING.
+     * @return The active backend count.
+     */
+    uint32_t GetActiveBackendCount() const;
+
+    /**
+     * @brief Get the smoothed task arrival rate.
+     * @return Arrival rate in tasks per second.
+     */
+    double GetArrivalRate() const;
+
+    /**
+     * @brief TracedCallback signature for backend power changes.
+     * @param backendIdx The backend index.
+     * @param poweredOn True when powered on, false when powered off.
+     */
+    typedef void (*BackendPowerTracedCallback)(uint32_t backendIdx, bool poweredOn);
+
+    /**
+     * @brief TracedCallback signature for a backend returning to service.
+     * @param backendIdx The backend index.
+     */
+    typedef void (*BackendAvailableTracedCallback)(uint32_t backendIdx);
+
+  protected:
+    void DoDispose() override;
+
+  private:
+    /**
+     * @brief Measure the arrival rate and resize the active set.
+     */
+    void Evaluate();
+
+    /**
+     * @brief Bring one more backend into service.
+     * @return False if every backend is already ON or BOOTING.
+     */
+    bool ScaleUp();
+
+    /**
+     * @brief Start draining the least-loaded ON backend that may be removed.
+     */
+    void ScaleDown();
+
+    /**
+     * @brief Power a DRAINING backend off if it has no outstanding work.
+     * @param backendIdx The backend index.
+     */
+    void TryPowerOff(uint32_t backendIdx);
+
+    /**
+     * @brief Make a BOOTING backend available.
+     * @param backendIdx The backend index.
+     */
+    void CompleteBoot(uint32_t backendIdx);
+
+    /**
+     * @brief Get the accelerators installed on a backend.
+     * @param backendIdx The backend index.
+     * @return The node's accelerator, or every device of its pool.
+     */
+    std::vector<Ptr<Accelerator>> GetAccelerators(uint32_t backendIdx) const;
+
+    Time m_evaluationInterval;  //!< Time between sizing decisions
+    double m_serviceRate;       //!< Tasks per second one backend can serve
+    double m_targetUtilization; //!< Per-backend utilization to size for
+    uint32_t m_minBackends;     //!< Backends never powered down below this count
+    double m_rateSmoothing;     //!< EWMA weight of the newest rate sample
+
+    Cluster* m_cluster;                 //!< Cluster passed to Start()
+    const ClusterState* m_clusterState; //!< Cluster state passed to Start()
+    std::vector<PowerState> m_states;   //!< Per-backend power state
+    std::vector<EventId> m_bootEvents;  //!< Per-backend pending boot completion
+    EventId m_evaluateEvent;            //!< Next periodic evaluation
+    uint64_t m_lastDispatched;          //!< Dispatch count at the last evaluation
+    double m_arrivalRate;               //!< Smoothed arrival rate in tasks/s
+    bool m_rateInitialized;             //!< A rate sample has been taken
+
+    TracedValue<uint32_t> m_activeBackends;             //!< Backends ON or BOOTING
+    TracedCallback<uint32_t, bool> m_backendPowerTrace; //!< Backend powered on/off
+    TracedCallback<uint32_t> m_backendAvailableTrace;   //!< Backend available for new tasks
+};
+
+} // namespace ns3
+
+#endif // BACKEND_AUTOSCALER_H
@@ -11,6 +11,8 @@
 #include "ns3/log.h"
 #include "ns3/uinteger.h"
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -57,7 +59,7 @@ void
 BatchingQueueScheduler::Enqueue(Ptr<Task> task)
 {
     NS_LOG_FUNCTION(this << task);
-    m_queue.push(task);
+    m_queue.push_back(task);
     NS_LOG_DEBUG("Enqueued task " << task->GetTaskId() << ", queue length: " << m_queue.size());
 }
 
@@ -73,7 +75,7 @@ BatchingQueueScheduler::Dequeue()
     }
 
     Ptr<Task> task = m_queue.front();
-    m_queue.pop();
+    m_queue.pop_front();
     NS_LOG_DEBUG("Dequeued task " << task->GetTaskId() << ", queue length: " << m_queue.size());
     return task;
 }
@@ -103,7 +105,7 @@ BatchingQueueScheduler::DequeueBatch(uint32_t maxBatch)
     for (uint32_t i = 0; i < count; i++)
     {
         batch.push_back(m_queue.front());
-        m_queue.pop();
+        m_queue.pop_front();
     }
 
     NS_LOG_DEBUG("Dequeued batch of " << batch.size()
@@ -124,6 +126,41 @@ BatchingQueueScheduler::Peek() const
     return m_queue.front();
 }
 
+Ptr<Task>
+BatchingQueueScheduler::RemoveLast()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (m_queue.empty())
+    {
+        return nullptr;
+    }
+
+    Ptr<Task> task = m_queue.back();
+    m_queue.pop_back();
+    NS_LOG_DEBUG("Removed task " << task->GetTaskId() << ", queue length: " << m_queue.size());
+    return task;
+}
+
+Ptr<Task>
+BatchingQueueScheduler::Remove(uint64_t taskId)
+{
+    NS_LOG_FUNCTION(this << taskId);
+
+    auto it = std::find_if(m_queue.begin(), m_queue.end(), [taskId](const Ptr<Task>& task) {
+        return task->GetTaskId() == taskId;
+    });
+    if (it == m_queue.end())
+    {
+        return nullptr;
+    }
+
+    Ptr<Task> task = *it;
+    m_queue.erase(it);
+    NS_LOG_DEBUG("Removed task " << taskId << ", queue length: " << m_queue.size());
+    return task;
+}
+
 bool
 BatchingQueueScheduler::IsEmpty() const
 {
@@ -152,10 +189,7 @@ void
 BatchingQueueScheduler::Clear()
 {
     NS_LOG_FUNCTION(this);
-    while (!m_queue.empty())
-    {
-        m_queue.pop();
-    }
+    m_queue.clear();
 }
 
 } // namespace ns3
@@ -11,7 +11,7 @@
 
 #include "queue-scheduler.h"
 
-#include <queue>
+#include <deque>
 #include <vector>
 
 namespace ns3
@@ -92,6 +92,8 @@ class BatchingQueueScheduler : public QueueScheduler
     void Enqueue(Ptr<Task> task) override;
     Ptr<Task> Dequeue() override;
     Ptr<Task> Peek() const override;
+    Ptr<Task> RemoveLast() override;
+    Ptr<Task> Remove(uint64_t taskId) override;
     bool IsEmpty() const override;
     uint32_t GetLength() const override;
     std::string GetName() const override;
@@ -101,7 +103,7 @@ class BatchingQueueScheduler : public QueueScheduler
     void DoDispose() override;
 
   private:
-    std::queue<Ptr<Task>> m_queue; //!< Internal FIFO queue
+    std::deque<Ptr<Task>> m_queue; //!< Internal FIFO queue
     uint32_t m_maxBatchSize;       //!< Maximum batch size for DequeueBatch()
 };
 
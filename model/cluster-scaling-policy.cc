@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#include "cluster-scaling-policy.h"
+
+#include "ns3/log.h"
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("ClusterScalingPolicy");
+
+NS_OBJECT_ENSURE_REGISTERED(ClusterScalingPolicy);
+
+TypeId
+ClusterScalingPolicy::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::ClusterScalingPolicy").SetParent<Object>().SetGroupName("Distributed");
+    return tid;
+}
+
+ClusterScalingPolicy::~ClusterScalingPolicy()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+} // namespace ns3
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#ifndef CLUSTER_SCALING_POLICY_H
+#define CLUSTER_SCALING_POLICY_H
+
+#include "accelerator.h"
+#include "cluster-state.h"
+#include "dvfs-energy-model.h"
+#include "scaling-policy.h"
+
+#include "ns3/object.h"
+#include "ns3/ptr.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @ingroup distributed
+ * @brief Abstract base class for DVFS policies that decide for the whole cluster.
+ *
+ * Unlike ScalingPolicy, which decides each backend in isolation, a
+ * ClusterScalingPolicy sees every backend at once so that it can enforce
+ * cluster-wide constraints such as a shared power budget. The DeviceManager
+ * calls Decide() whenever any backend's state changed.
+ */
+class ClusterScalingPolicy : public Object
+{
+  public:
+    /**
+     * @brief Static description of a backend, extracted by DeviceManager at startup.
+     */
+    struct BackendProfile
+    {
+        std::vector<OperatingPoint> operatingPoints; //!< OPP table sorted by frequency ascending
+        Ptr<DvfsEnergyModel> energyModel;            //!< Power model (nullptr = unknown)
+        uint32_t deviceCount{1};                     //!< Devices commanded together
+    };
+
+    /**
+     * @brief Get the type ID.
+     * @return The object TypeId.
+     */
+    static TypeId GetTypeId();
+
+    ~ClusterScalingPolicy() override;
+
+    /**
+     * @brief Decide on scaling actions for every backend.
+     *
+     * @param state The cluster state with per-backend load and metrics.
+     * @param profiles Per-backend OPP tables and power models, indexed like state.
+     * @return One decision per backend, nullptr where no change is needed.
+     */
+    virtual std::vector<Ptr<ScalingDecision>> Decide(
+        const ClusterState& state,
+        const std::vector<BackendProfile>& profiles) = 0;
+
+    /**
+     * @brief Get the name of this scaling policy.
+     * @return A string identifying the policy.
+     */
+    virtual std::string GetName() const = 0;
+};
+
+} // namespace ns3
+
+#endif // CLUSTER_SCALING_POLICY_H
@@ -46,9 +46,9 @@ ClusterScheduler::CanScheduleTask(Ptr<Task> task,
     std::string required = task->GetRequiredAcceleratorType();
     if (required.empty())
     {
-        return cluster.GetN() > 0;
+        return cluster.GetNAvailable() > 0;
     }
-    return !cluster.GetBackendsByType(required).empty();
+    return !cluster.GetAvailableBackendsByType(required).empty();
 }
 
 void
@@ -58,6 +58,13 @@ ClusterScheduler::NotifyTaskCompleted(uint32_t backendIdx, Ptr<Task> task)
     // Default: no-op. Stateful schedulers override this.
 }
 
+void
+ClusterScheduler::NotifyTaskCancelled(Ptr<Task> task)
+{
+    NS_LOG_FUNCTION(this << task);
+    // Default: no-op. Stateful schedulers override this.
+}
+
 void
 ClusterScheduler::DoDispose()
 {
@@ -25,6 +25,9 @@ class ClusterState;
  * @brief Abstract base class for task scheduling policies.
  *
  * ClusterScheduler determines which backend in a cluster should execute a given task.
+ * Implementations must only select backends that are currently available
+ * (Cluster::GetAvailableBackends()), since backends may be powered down at
+ * runtime.
  *
  * ClusterScheduler is used by EdgeOrchestrator for task placement decisions during
  * DAG execution.
@@ -98,6 +101,17 @@ class ClusterScheduler : public Object
      */
     virtual void NotifyTaskCompleted(uint32_t backendIdx, Ptr<Task> task);
 
+    /**
+     * @brief Notify scheduler that a scheduled task will never complete.
+     *
+     * Called for each task of a cancelled workload, whether or not it was
+     * dispatched. Schedulers that keep per-task state should release it here.
+     * Default implementation does nothing.
+     *
+     * @param task The task that was cancelled.
+     */
+    virtual void NotifyTaskCancelled(Ptr<Task> task);
+
     /**
      * @brief Get the scheduler name for logging and debugging.
      * @return A string identifying this scheduler type.
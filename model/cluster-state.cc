@@ -8,10 +8,15 @@
 
 #include "cluster-state.h"
 
+#include "cluster.h"
+#include "dag-task.h"
 #include "scaling-policy.h"
+#include "task.h"
 
 #include "ns3/log.h"
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -22,6 +27,13 @@ ClusterState::Resize(uint32_t n)
 {
     NS_LOG_FUNCTION(this << n);
     m_backends.resize(n);
+    m_dirty.assign(n, false);
+    m_dirtyBackends.clear();
+    m_indexedCluster = nullptr;
+    for (uint32_t i = 0; i < n; i++)
+    {
+        MarkDirty(i);
+    }
 }
 
 uint32_t
@@ -47,6 +59,8 @@ ClusterState::NotifyTaskDispatched(uint32_t backendIdx)
                                    << ")");
     m_backends[backendIdx].activeTasks++;
     m_backends[backendIdx].totalDispatched++;
+    UpdateLoadIndex(backendIdx);
+    MarkDirty(backendIdx);
 }
 
 void
@@ -60,6 +74,45 @@ ClusterState::NotifyTaskCompleted(uint32_t backendIdx)
                   "activeTasks underflow for backend " << backendIdx);
     m_backends[backendIdx].activeTasks--;
     m_backends[backendIdx].totalCompleted++;
+    UpdateLoadIndex(backendIdx);
+    MarkDirty(backendIdx);
+}
+
+void
+ClusterState::NotifyTaskDispatched(uint32_t backendIdx, Ptr<const Task> task)
+{
+    NS_LOG_FUNCTION(this << backendIdx << task->GetTaskId());
+    NotifyTaskDispatched(backendIdx);
+
+    BackendState& backend = m_backends[backendIdx];
+    OutstandingTask& entry = backend.outstandingTasks[task->GetTaskId()];
+    entry.computeDemand = task->GetComputeDemand();
+    entry.bytes = task->GetInputSize() + task->GetOutputSize();
+    entry.deadline = task->GetDeadline();
+    backend.outstandingFlops += entry.computeDemand;
+    backend.outstandingBytes += entry.bytes;
+}
+
+void
+ClusterState::NotifyTaskCompleted(uint32_t backendIdx, uint64_t taskId)
+{
+    NS_LOG_FUNCTION(this << backendIdx << taskId);
+    NotifyTaskCompleted(backendIdx);
+
+    BackendState& backend = m_backends[backendIdx];
+    auto it = backend.outstandingTasks.find(taskId);
+    if (it == backend.outstandingTasks.end())
+    {
+        return;
+    }
+    backend.outstandingFlops -= it->second.computeDemand;
+    backend.outstandingBytes -= it->second.bytes;
+    backend.outstandingTasks.erase(it);
+    if (backend.outstandingTasks.empty())
+    {
+        // Avoid accumulating floating-point residue across many tasks
+        backend.outstandingFlops = 0;
+    }
 }
 
 void
@@ -69,7 +122,23 @@ ClusterState::SetDeviceMetrics(uint32_t backendIdx, Ptr<DeviceMetrics> metrics)
     NS_ASSERT_MSG(backendIdx < m_backends.size(),
                   "Backend index " << backendIdx << " out of range (size=" << m_backends.size()
                                    << ")");
-    m_backends[backendIdx].deviceMetrics = metrics;
+    MarkDirty(backendIdx);
+
+    BackendState& backend = m_backends[backendIdx];
+    if (metrics->aggregate)
+    {
+        backend.deviceMetrics = metrics;
+        return;
+    }
+
+    if (backend.perDeviceMetrics.size() != metrics->deviceCount)
+    {
+        backend.perDeviceMetrics.resize(metrics->deviceCount);
+    }
+    if (metrics->deviceIndex < backend.perDeviceMetrics.size())
+    {
+        backend.perDeviceMetrics[metrics->deviceIndex] = metrics;
+    }
 }
 
 void
@@ -82,6 +151,423 @@ ClusterState::SetCommandedFrequency(uint32_t backendIdx, double frequency)
     m_backends[backendIdx].commandedFrequency = frequency;
 }
 
+void
+ClusterState::SetDeviceRates(uint32_t backendIdx,
+                             double computeRate,
+                             double referenceFrequency,
+                             double memoryBandwidth,
+                             uint32_t deviceCount)
+{
+    NS_LOG_FUNCTION(this << backendIdx << computeRate << referenceFrequency << memoryBandwidth
+                         << deviceCount);
+    NS_ASSERT_MSG(backendIdx < m_backends.size(),
+                  "Backend index " << backendIdx << " out of range (size=" << m_backends.size()
+                                   << ")");
+    BackendState& backend = m_backends[backendIdx];
+    backend.computeRate = computeRate;
+    backend.referenceFrequency = referenceFrequency;
+    backend.memoryBandwidth = memoryBandwidth;
+    backend.deviceCount = std::max(deviceCount, 1U);
+}
+
+void
+ClusterState::NotifyTransfer(uint32_t backendIdx, uint64_t bytes, Time duration)
+{
+    NS_LOG_FUNCTION(this << backendIdx << bytes << duration);
+    NS_ASSERT_MSG(backendIdx < m_backends.size(),
+                  "Backend index " << backendIdx << " out of range (size=" << m_backends.size()
+                                   << ")");
+    if (bytes == 0 || !duration.IsStrictlyPositive())
+    {
+        return;
+    }
+
+    BackendState& backend = m_backends[backendIdx];
+    if (!backend.linkLatency.IsStrictlyPositive() || duration < backend.linkLatency)
+    {
+        backend.linkLatency = duration;
+        return;
+    }
+
+    Time excess = duration - backend.linkLatency;
+    if (excess < backend.linkLatency)
+    {
+        return;
+    }
+
+    // Weight of a new sample in the moving average
+    constexpr double gain = 0.25;
+
+    double sample = static_cast<double>(bytes) / excess.GetSeconds();
+    backend.linkRate =
+        backend.linkRate > 0 ? (1 - gain) * backend.linkRate + gain * sample : sample;
+}
+
+bool
+ClusterState::NotifyResponse(uint32_t backendIdx,
+                             Ptr<const Task> task,
+                             Time dispatchTime,
+                             Time responseTime)
+{
+    NS_LOG_FUNCTION(this << backendIdx << task << dispatchTime << responseTime);
+    NS_ASSERT_MSG(backendIdx < m_backends.size(),
+                  "Backend index " << backendIdx << " out of range (size=" << m_backends.size()
+                                   << ")");
+
+    BackendState& backend = m_backends[backendIdx];
+    Time service = responseTime - std::max(dispatchTime, backend.lastResponse);
+    backend.lastResponse = responseTime;
+    if (!service.IsStrictlyPositive())
+    {
+        return false;
+    }
+
+    // Weight of a new sample in the moving averages
+    constexpr double gain = 0.25;
+
+    backend.serviceTime = backend.serviceTime.IsStrictlyPositive()
+                              ? Seconds((1 - gain) * backend.serviceTime.GetSeconds() +
+                                        gain * service.GetSeconds())
+                              : service;
+
+    double cost = service.GetSeconds() / std::max(task->GetComputeDemand(), 1.0);
+    if (backend.commandedFrequency > 0 && backend.referenceFrequency > 0)
+    {
+        cost *= backend.commandedFrequency / backend.referenceFrequency;
+    }
+
+    if (m_outlierFactor > 0 && backend.serviceCost > 0 &&
+        cost > m_outlierFactor * backend.serviceCost)
+    {
+        backend.slowResponses++;
+        NS_LOG_DEBUG("Backend " << backendIdx << " response took " << service << ", "
+                                << cost / backend.serviceCost << "x its healthy cost ("
+                                << backend.slowResponses << " in a row)");
+        return true;
+    }
+
+    backend.slowResponses = 0;
+    backend.serviceCost =
+        backend.serviceCost > 0 ? (1 - gain) * backend.serviceCost + gain * cost : cost;
+    return false;
+}
+
+void
+ClusterState::SetOutlierFactor(double factor)
+{
+    NS_LOG_FUNCTION(this << factor);
+    m_outlierFactor = factor;
+}
+
+void
+ClusterState::Reserve(uint64_t id,
+                      Ptr<DagTask> dag,
+                      const Cluster& cluster,
+                      const std::vector<int32_t>& placement)
+{
+    NS_LOG_FUNCTION(this << id << dag->GetTaskCount());
+    NS_ASSERT_MSG(m_reservations.find(id) == m_reservations.end(),
+                  "Reservation " << id << " already exists");
+
+    auto& entries = m_reservations[id];
+    for (uint32_t i = 0; i < dag->GetTaskCount(); i++)
+    {
+        Ptr<Task> task = dag->GetTask(i);
+        if (!task)
+        {
+            continue;
+        }
+
+        int32_t backendIdx = i < placement.size() ? placement[i] : -1;
+        if (backendIdx < 0 || static_cast<uint32_t>(backendIdx) >= m_backends.size())
+        {
+            std::string type = task->GetRequiredAcceleratorType();
+            const std::vector<uint32_t>& pool = type.empty()
+                                                    ? cluster.GetAvailableBackends()
+                                                    : cluster.GetAvailableBackendsByType(type);
+            backendIdx = -1;
+            uint32_t fewest = 0;
+            for (uint32_t b : pool)
+            {
+                uint32_t load = m_backends[b].activeTasks + m_backends[b].reservedTasks;
+                if (backendIdx < 0 || load < fewest)
+                {
+                    backendIdx = static_cast<int32_t>(b);
+                    fewest = load;
+                }
+            }
+            if (backendIdx < 0)
+            {
+                continue;
+            }
+        }
+
+        OutstandingTask work;
+        work.computeDemand = task->GetComputeDemand();
+        work.bytes = task->GetInputSize() + task->GetOutputSize();
+        work.deadline = task->GetDeadline();
+
+        BackendState& backend = m_backends[backendIdx];
+        backend.reservedTasks++;
+        backend.reservedFlops += work.computeDemand;
+        backend.reservedBytes += work.bytes;
+        entries.emplace_back(static_cast<uint32_t>(backendIdx), work);
+    }
+}
+
+void
+ClusterState::Release(uint64_t id)
+{
+    NS_LOG_FUNCTION(this << id);
+    auto it = m_reservations.find(id);
+    if (it == m_reservations.end())
+    {
+        return;
+    }
+
+    for (const auto& [backendIdx, work] : it->second)
+    {
+        if (backendIdx >= m_backends.size())
+        {
+            continue;
+        }
+        BackendState& backend = m_backends[backendIdx];
+        backend.reservedTasks--;
+        backend.reservedFlops -= work.computeDemand;
+        backend.reservedBytes -= work.bytes;
+        if (backend.reservedTasks == 0)
+        {
+            // Avoid accumulating floating-point residue across many reservations
+            backend.reservedFlops = 0;
+        }
+    }
+    m_reservations.erase(it);
+}
+
+uint32_t
+ClusterState::GetReservationCount() const
+{
+    return static_cast<uint32_t>(m_reservations.size());
+}
+
+void
+ClusterState::SetModelCacheCapacity(uint32_t backendIdx, uint64_t capacity)
+{
+    NS_LOG_FUNCTION(this << backendIdx << capacity);
+    NS_ASSERT_MSG(backendIdx < m_backends.size(),
+                  "Backend index " << backendIdx << " out of range (size=" << m_backends.size()
+                                   << ")");
+    m_backends[backendIdx].modelCacheCapacity = capacity;
+
+    // Tracking changes move the backend between indexes; rebuild on next use
+    m_indexedCluster = nullptr;
+}
+
+void
+ClusterState::NotifyModelUsed(uint32_t backendIdx, const std::string& modelId, uint64_t modelSize)
+{
+    NS_LOG_FUNCTION(this << backendIdx << modelId << modelSize);
+    NS_ASSERT_MSG(backendIdx < m_backends.size(),
+                  "Backend index " << backendIdx << " out of range (size=" << m_backends.size()
+                                   << ")");
+
+    BackendState& backend = m_backends[backendIdx];
+    if (modelId.empty() || backend.modelCacheCapacity == 0)
+    {
+        return;
+    }
+
+    for (auto it = backend.warmModels.begin(); it != backend.warmModels.end(); ++it)
+    {
+        if (it->first == modelId)
+        {
+            backend.warmModels.splice(backend.warmModels.begin(), backend.warmModels, it);
+            return;
+        }
+    }
+
+    if (modelSize > backend.modelCacheCapacity)
+    {
+        return;
+    }
+
+    auto groups = GetIndexGroups(backendIdx);
+    while (backend.modelCacheUsed + modelSize > backend.modelCacheCapacity)
+    {
+        const std::string& evicted = backend.warmModels.back().first;
+        for (LoadGroup* group : {groups.first, groups.second})
+        {
+            if (group)
+            {
+                auto it = group->models.find(evicted);
+                it->second.Remove(backendIdx);
+                if (it->second.IsEmpty())
+                {
+                    group->models.erase(it);
+                }
+            }
+        }
+        backend.modelCacheUsed -= backend.warmModels.back().second;
+        backend.warmModels.pop_back();
+    }
+
+    backend.warmModels.emplace_front(modelId, modelSize);
+    backend.modelCacheUsed += modelSize;
+    for (LoadGroup* group : {groups.first, groups.second})
+    {
+        if (group)
+        {
+            group->models[modelId].Insert(backendIdx, backend.activeTasks);
+        }
+    }
+}
+
+bool
+ClusterState::IsModelWarm(uint32_t backendIdx, const std::string& modelId) const
+{
+    NS_ASSERT_MSG(backendIdx < m_backends.size(),
+                  "Backend index " << backendIdx << " out of range (size=" << m_backends.size()
+                                   << ")");
+
+    const BackendState& backend = m_backends[backendIdx];
+    if (modelId.empty() || backend.modelCacheCapacity == 0)
+    {
+        return true;
+    }
+
+    for (const auto& entry : backend.warmModels)
+    {
+        if (entry.first == modelId)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void
+ClusterState::IndexLoad(const Cluster& cluster)
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT_MSG(cluster.GetN() == m_backends.size(),
+                  "Cluster has " << cluster.GetN() << " backends but state has "
+                                 << m_backends.size());
+
+    m_allGroup = LoadGroup();
+    m_typeGroups.clear();
+    m_backendGroup.assign(m_backends.size(), nullptr);
+
+    for (uint32_t idx : cluster.GetAvailableBackends())
+    {
+        LoadGroup* typeGroup = &m_typeGroups[cluster.Get(idx).acceleratorType];
+        m_backendGroup[idx] = typeGroup;
+
+        const BackendState& backend = m_backends[idx];
+        for (LoadGroup* group : {&m_allGroup, typeGroup})
+        {
+            group->backends.Insert(idx, backend.activeTasks);
+            if (backend.modelCacheCapacity == 0)
+            {
+                group->untracked.Insert(idx, backend.activeTasks);
+                continue;
+            }
+            for (const auto& entry : backend.warmModels)
+            {
+                group->models[entry.first].Insert(idx, backend.activeTasks);
+            }
+        }
+    }
+
+    m_indexedCluster = &cluster;
+    m_indexedGeneration = cluster.GetGeneration();
+    NS_LOG_DEBUG("Indexed load of " << m_allGroup.backends.GetSize() << " available backends in "
+                                    << m_typeGroups.size() << " accelerator types");
+}
+
+bool
+ClusterState::IsLoadIndexed(const Cluster& cluster) const
+{
+    return m_indexedCluster == &cluster && m_indexedGeneration == cluster.GetGeneration();
+}
+
+const ClusterState::LoadGroup*
+ClusterState::GetLoadGroup() const
+{
+    return m_indexedCluster ? &m_allGroup : nullptr;
+}
+
+const ClusterState::LoadGroup*
+ClusterState::GetLoadGroup(const std::string& acceleratorType) const
+{
+    if (!m_indexedCluster)
+    {
+        return nullptr;
+    }
+    auto it = m_typeGroups.find(acceleratorType);
+    return it != m_typeGroups.end() ? &it->second : nullptr;
+}
+
+std::pair<ClusterState::LoadGroup*, ClusterState::LoadGroup*>
+ClusterState::GetIndexGroups(uint32_t backendIdx)
+{
+    if (!m_indexedCluster || !m_backendGroup[backendIdx])
+    {
+        return {nullptr, nullptr};
+    }
+    return {&m_allGroup, m_backendGroup[backendIdx]};
+}
+
+void
+ClusterState::UpdateLoadIndex(uint32_t backendIdx)
+{
+    auto groups = GetIndexGroups(backendIdx);
+    if (!groups.first)
+    {
+        return;
+    }
+
+    const BackendState& backend = m_backends[backendIdx];
+    for (LoadGroup* group : {groups.first, groups.second})
+    {
+        group->backends.Update(backendIdx, backend.activeTasks);
+        if (backend.modelCacheCapacity == 0)
+        {
+            group->untracked.Update(backendIdx, backend.activeTasks);
+            continue;
+        }
+        for (const auto& entry : backend.warmModels)
+        {
+            group->models[entry.first].Update(backendIdx, backend.activeTasks);
+        }
+    }
+}
+
+void
+ClusterState::MarkDirty(uint32_t backendIdx)
+{
+    NS_ASSERT_MSG(backendIdx < m_backends.size(),
+                  "Backend index " << backendIdx << " out of range (size=" << m_backends.size()
+                                   << ")");
+    if (!m_dirty[backendIdx])
+    {
+        m_dirty[backendIdx] = true;
+        m_dirtyBackends.push_back(backendIdx);
+    }
+}
+
+std::vector<uint32_t>
+ClusterState::TakeDirtyBackends()
+{
+    NS_LOG_FUNCTION(this);
+    std::vector<uint32_t> dirty;
+    dirty.swap(m_dirtyBackends);
+    for (uint32_t idx : dirty)
+    {
+        m_dirty[idx] = false;
+    }
+    return dirty;
+}
+
 void
 ClusterState::SetActiveWorkloadCount(uint32_t count)
 {
@@ -101,6 +587,13 @@ ClusterState::Clear()
     NS_LOG_FUNCTION(this);
     m_backends.clear();
     m_activeWorkloads = 0;
+    m_reservations.clear();
+    m_dirty.clear();
+    m_dirtyBackends.clear();
+    m_indexedCluster = nullptr;
+    m_allGroup = LoadGroup();
+    m_typeGroups.clear();
+    m_backendGroup.clear();
 }
 
 } // namespace ns3
@@ -9,15 +9,25 @@
 #ifndef CLUSTER_STATE_H
 #define CLUSTER_STATE_H
 
+#include "load-index.h"
+
+#include "ns3/nstime.h"
 #include "ns3/ptr.h"
 
 #include <cstdint>
+#include <list>
+#include <map>
+#include <string>
+#include <utility>
 #include <vector>
 
 namespace ns3
 {
 
+class Cluster;
+class DagTask;
 class DeviceMetrics;
+class Task;
 
 /**
  * @ingroup distributed
@@ -27,10 +37,25 @@ class DeviceMetrics;
  * orchestrator-tracked dispatch/completion counts and device-reported metrics
  * into a single object that is passed to ScalingPolicy, ClusterScheduler, and
  * AdmissionPolicy on each call.
+ *
+ * Once IndexLoad() has been called, ClusterState also keeps the available
+ * backends in LoadIndex bucket queues (one over all backends and one per
+ * accelerator type) that follow every dispatch and completion, so that
+ * schedulers can find the least-loaded backends without scanning the cluster.
  */
 class ClusterState
 {
   public:
+    /**
+     * @brief Work the orchestrator has dispatched to a backend but not seen complete.
+     */
+    struct OutstandingTask
+    {
+        double computeDemand{0}; //!< Compute demand in FLOPS
+        uint64_t bytes{0};       //!< Input plus output size in bytes
+        Time deadline{-1};       //!< Absolute deadline (negative = none)
+    };
+
     /**
      * @brief Per-backend state combining orchestrator-tracked load and device metrics.
      */
@@ -41,6 +66,43 @@ class ClusterState
         uint32_t totalCompleted{0};       //!< Lifetime completion count
         double commandedFrequency{0.0};   //!< Last frequency commanded by DeviceManager
         Ptr<DeviceMetrics> deviceMetrics; //!< Latest device-reported metrics (nullable)
+        std::vector<Ptr<DeviceMetrics>>
+            perDeviceMetrics; //!< Latest per-device metrics for multi-accelerator backends
+        uint64_t modelCacheCapacity{0}; //!< Device memory for model weights (0 = untracked)
+        uint64_t modelCacheUsed{0};     //!< Bytes of weights expected resident
+        std::list<std::pair<std::string, uint64_t>>
+            warmModels; //!< Models expected resident (id, size), most recently used first
+        double outstandingFlops{0};   //!< Compute demand of outstanding tasks in FLOPS
+        uint64_t outstandingBytes{0}; //!< Input and output bytes of outstanding tasks
+        std::map<uint64_t, OutstandingTask>
+            outstandingTasks;         //!< Outstanding tasks by task ID (tracked dispatches only)
+        double computeRate{0};        //!< FLOPS of one device at referenceFrequency (0 = unknown)
+        double referenceFrequency{0}; //!< Frequency at which computeRate applies, in Hz
+        double memoryBandwidth{0};    //!< Memory bandwidth of one device in bytes/s (0 = unknown)
+        uint32_t deviceCount{1};      //!< Devices serving tasks in parallel
+        double linkRate{0};           //!< Measured network transfer rate in bytes/s (0 = unknown)
+        Time linkLatency;             //!< Minimum measured transfer round trip (0 = unknown)
+        uint32_t reservedTasks{0};    //!< Tasks of admitted workloads not yet dispatched
+        double reservedFlops{0};      //!< Compute demand of reserved tasks in FLOPS
+        uint64_t reservedBytes{0};    //!< Input and output bytes of reserved tasks
+        Time serviceTime;             //!< Moving average of per-task service time (0 = unknown)
+        double serviceCost{0};        //!< Healthy service seconds per FLOP at reference clock
+        uint32_t slowResponses{0};    //!< Consecutive responses slower than the outlier factor
+        Time lastResponse;            //!< When the backend last responded
+    };
+
+    /**
+     * @brief Load indexes over a set of available backends.
+     *
+     * Backends without model tracking are warm for every model, so the
+     * least-loaded warm backends for a model are found in the union of the
+     * untracked index and that model's index.
+     */
+    struct LoadGroup
+    {
+        LoadIndex backends;                      //!< Backends by active tasks
+        LoadIndex untracked;                     //!< Backends without model tracking
+        std::map<std::string, LoadIndex> models; //!< Backends holding each model
     };
 
     /**
@@ -74,8 +136,31 @@ class ClusterState
      */
     void NotifyTaskCompleted(uint32_t backendIdx);
 
+    /**
+     * @brief Record that a task was dispatched to a backend, tracking its work.
+     *
+     * In addition to the load counters, the task's compute demand and deadline
+     * are kept until completion so that decision-makers can reason about the
+     * outstanding work on each backend.
+     *
+     * @param backendIdx The backend index.
+     * @param task The dispatched task.
+     */
+    void NotifyTaskDispatched(uint32_t backendIdx, Ptr<const Task> task);
+
+    /**
+     * @brief Record that a tracked task completed (or was cancelled) on a backend.
+     * @param backendIdx The backend index.
+     * @param taskId The task ID passed to NotifyTaskDispatched.
+     */
+    void NotifyTaskCompleted(uint32_t backendIdx, uint64_t taskId);
+
     /**
      * @brief Store device metrics for a backend.
+     *
+     * Aggregate reports replace deviceMetrics; per-device reports from
+     * multi-accelerator backends are stored in perDeviceMetrics.
+     *
      * @param backendIdx The backend index.
      * @param metrics The device metrics.
      */
@@ -88,6 +173,192 @@ class ClusterState
      */
     void SetCommandedFrequency(uint32_t backendIdx, double frequency);
 
+    /**
+     * @brief Set a backend's nominal device rates.
+     *
+     * Compute rate is assumed to scale linearly with the core clock, so
+     * decision-makers can derive the rate at the commanded frequency.
+     *
+     * The rates are those of one device, which runs a task on its own. A
+     * backend with several devices drains its queue deviceCount times as fast.
+     *
+     * @param backendIdx The backend index.
+     * @param computeRate Compute rate of one device in FLOPS at the reference frequency.
+     * @param referenceFrequency Frequency at which computeRate applies, in Hz.
+     * @param memoryBandwidth Memory bandwidth of one device in bytes/s.
+     * @param deviceCount Devices serving tasks in parallel.
+     */
+    void SetDeviceRates(uint32_t backendIdx,
+                        double computeRate,
+                        double referenceFrequency,
+                        double memoryBandwidth,
+                        uint32_t deviceCount);
+
+    /**
+     * @brief Record a measured transfer to or from a backend.
+     *
+     * The shortest transfer seen is the backend's link latency: the
+     * propagation and per-message delay that every transfer pays whatever
+     * its size. Only the time beyond it is spent moving bytes, so a
+     * sample's rate is bytes / (duration - linkLatency). Samples whose
+     * excess is shorter than the latency itself are dominated by jitter
+     * and teach nothing about bandwidth; small frames thus set the latency
+     * and large ones the rate. The backend's link rate is an exponentially
+     * weighted moving average of the rate samples, so a single congested
+     * transfer does not dominate.
+     *
+     * @param backendIdx The backend index.
+     * @param bytes Bytes transferred.
+     * @param duration Time the transfer took.
+     */
+    void NotifyTransfer(uint32_t backendIdx, uint64_t bytes, Time duration);
+
+    /**
+     * @brief Record a task's response and update the backend's service time.
+     *
+     * A task's service time runs from its dispatch, or from the backend's
+     * previous response if that came later, to its response, so time spent
+     * queued behind earlier tasks is not counted. The backend's serviceTime
+     * is a moving average of these samples.
+     *
+     * Each sample is also turned into a cost in seconds per FLOP at the
+     * backend's reference clock, so that task size and DVFS slowdowns are
+     * factored out. A sample costing more than the outlier factor times the
+     * backend's healthy serviceCost is an outlier: it extends the backend's
+     * run of slowResponses and is kept out of serviceCost. Any other sample
+     * ends the run and is averaged into serviceCost.
+     *
+     * @param backendIdx The backend index.
+     * @param task The completed task.
+     * @param dispatchTime When the task was sent to the backend.
+     * @param responseTime When its response arrived.
+     * @return True if the response was an outlier.
+     */
+    bool NotifyResponse(uint32_t backendIdx,
+                        Ptr<const Task> task,
+                        Time dispatchTime,
+                        Time responseTime);
+
+    /**
+     * @brief Set the slowdown over a backend's healthy cost that makes a response an outlier.
+     * @param factor Ratio of sample to healthy cost (0 = no response is an outlier).
+     */
+    void SetOutlierFactor(double factor);
+
+    /**
+     * @brief Reserve capacity for an admitted workload whose data has not arrived.
+     *
+     * Each task is charged to the backend given in @p placement or, where
+     * the placement has no entry for it, to the available matching backend
+     * with the fewest active plus reserved tasks. The work stays in the
+     * backends' reserved counters until Release(), so admission decisions
+     * taken in the meantime see it.
+     *
+     * @param id Reservation ID, unique among outstanding reservations.
+     * @param dag The admitted workload.
+     * @param cluster The cluster of backends.
+     * @param placement Backend index per DAG task (may be empty).
+     */
+    void Reserve(uint64_t id,
+                 Ptr<DagTask> dag,
+                 const Cluster& cluster,
+                 const std::vector<int32_t>& placement);
+
+    /**
+     * @brief Release a reservation made by Reserve().
+     * @param id The reservation ID (unknown IDs are ignored).
+     */
+    void Release(uint64_t id);
+
+    /**
+     * @brief Get the number of outstanding reservations.
+     * @return Number of reservations not yet released.
+     */
+    uint32_t GetReservationCount() const;
+
+    /**
+     * @brief Set the device memory available for model weights on a backend.
+     *
+     * A capacity of 0 disables model tracking for the backend, in which case
+     * every model is considered warm.
+     *
+     * @param backendIdx The backend index.
+     * @param capacity Device memory capacity in bytes.
+     */
+    void SetModelCacheCapacity(uint32_t backendIdx, uint64_t capacity);
+
+    /**
+     * @brief Record that a task using a model was dispatched to a backend.
+     *
+     * Mirrors the device's LRU model cache so decision-makers can prefer
+     * backends that already hold a model's weights.
+     *
+     * @param backendIdx The backend index.
+     * @param modelId The model identifier (ignored if empty).
+     * @param modelSize The model weight size in bytes.
+     */
+    void NotifyModelUsed(uint32_t backendIdx, const std::string& modelId, uint64_t modelSize);
+
+    /**
+     * @brief Check whether a backend is expected to hold a model's weights.
+     * @param backendIdx The backend index.
+     * @param modelId The model identifier.
+     * @return True if the model is empty, untracked, or expected resident.
+     */
+    bool IsModelWarm(uint32_t backendIdx, const std::string& modelId) const;
+
+    /**
+     * @brief Build the load indexes from the cluster's available backends.
+     *
+     * The indexes are then kept up to date by dispatch, completion and model
+     * notifications until the cluster's generation changes, the state is
+     * resized, or a model cache capacity changes.
+     *
+     * @param cluster The cluster this state describes.
+     */
+    void IndexLoad(const Cluster& cluster);
+
+    /**
+     * @brief Check whether the load indexes are current for a cluster.
+     * @param cluster The cluster this state describes.
+     * @return True if IndexLoad() was called for this cluster at its current generation.
+     */
+    bool IsLoadIndexed(const Cluster& cluster) const;
+
+    /**
+     * @brief Get the load indexes over all available backends.
+     * @return The group, or nullptr if the load is not indexed.
+     */
+    const LoadGroup* GetLoadGroup() const;
+
+    /**
+     * @brief Get the load indexes over the available backends of one accelerator type.
+     * @param acceleratorType The accelerator type.
+     * @return The group, or nullptr if the load is not indexed or no such backend is available.
+     */
+    const LoadGroup* GetLoadGroup(const std::string& acceleratorType) const;
+
+    /**
+     * @brief Mark a backend as changed since the last scaling evaluation.
+     *
+     * Dispatches, completions and metrics reports mark their backend
+     * automatically; this is for callers that need a backend re-evaluated
+     * without a state change (e.g. after a deferred decision).
+     *
+     * @param backendIdx The backend index.
+     */
+    void MarkDirty(uint32_t backendIdx);
+
+    /**
+     * @brief Return and clear the backends changed since the last call.
+     *
+     * Backends are returned once each, in the order they were first marked.
+     * All backends start dirty after Resize().
+     *
+     * @return Indices of the changed backends.
+     */
+    std::vector<uint32_t> TakeDirtyBackends();
+
     /**
      * @brief Set the active workload count.
      * @param count Number of active workloads.
@@ -106,8 +377,32 @@ class ClusterState
     void Clear();
 
   private:
-    std::vector<BackendState> m_backends; //!< Per-backend state
-    uint32_t m_activeWorkloads{0};        //!< Number of active workloads
+    /**
+     * @brief Move a backend to its current load in every index it belongs to.
+     * @param backendIdx The backend index.
+     */
+    void UpdateLoadIndex(uint32_t backendIdx);
+
+    /**
+     * @brief Get the groups whose indexes include a backend.
+     * @param backendIdx The backend index.
+     * @return The all-backends and type groups, or nullptrs if the backend is not indexed.
+     */
+    std::pair<LoadGroup*, LoadGroup*> GetIndexGroups(uint32_t backendIdx);
+
+    std::vector<BackendState> m_backends;  //!< Per-backend state
+    uint32_t m_activeWorkloads{0};         //!< Number of active workloads
+    double m_outlierFactor{3.0};           //!< Slowdown at which a response is an outlier
+    std::vector<bool> m_dirty;             //!< Per-backend changed-since-evaluation flag
+    std::vector<uint32_t> m_dirtyBackends; //!< Changed backends in marking order
+    std::map<uint64_t, std::vector<std::pair<uint32_t, OutstandingTask>>>
+        m_reservations; //!< Reservation ID → (backend, work) per reserved task
+
+    const Cluster* m_indexedCluster{nullptr};      //!< Cluster the indexes were built for
+    uint64_t m_indexedGeneration{0};               //!< Cluster generation at IndexLoad()
+    LoadGroup m_allGroup;                          //!< Indexes over all available backends
+    std::map<std::string, LoadGroup> m_typeGroups; //!< Indexes per accelerator type
+    std::vector<LoadGroup*> m_backendGroup;        //!< Per-backend type group (null = none)
 };
 
 } // namespace ns3
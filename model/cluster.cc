@@ -11,6 +11,8 @@
 #include "ns3/assert.h"
 #include "ns3/log.h"
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -34,6 +36,9 @@ Cluster::AddBackend(Ptr<Node> node, const Address& address, const std::string& a
 
     m_typeIndex[acceleratorType].push_back(idx);
     m_addrIndex[address] = idx;
+    m_available.push_back(idx);
+    m_availableTypeIndex[acceleratorType].push_back(idx);
+    m_generation++;
 
     NS_LOG_DEBUG("Added backend " << idx << " with accelerator type '" << acceleratorType
                                   << "' to cluster");
@@ -89,6 +94,9 @@ Cluster::Clear()
     m_backends.clear();
     m_typeIndex.clear();
     m_addrIndex.clear();
+    m_available.clear();
+    m_availableTypeIndex.clear();
+    m_generation++;
 }
 
 const std::vector<uint32_t>&
@@ -121,4 +129,108 @@ Cluster::GetBackendIndex(const Address& address) const
     return -1;
 }
 
+void
+Cluster::SetAvailable(uint32_t i, bool available)
+{
+    NS_LOG_FUNCTION(this << i << available);
+    NS_ASSERT_MSG(i < m_backends.size(),
+                  "Index " << i << " out of range (size=" << m_backends.size() << ")");
+
+    Backend& backend = m_backends[i];
+    if (backend.available == available)
+    {
+        return;
+    }
+    backend.available = available;
+    if (!backend.quarantined)
+    {
+        UpdateAvailable(i, available);
+    }
+}
+
+bool
+Cluster::IsAvailable(uint32_t i) const
+{
+    return Get(i).available && !Get(i).quarantined;
+}
+
+void
+Cluster::SetQuarantined(uint32_t i, bool quarantined)
+{
+    NS_LOG_FUNCTION(this << i << quarantined);
+    NS_ASSERT_MSG(i < m_backends.size(),
+                  "Index " << i << " out of range (size=" << m_backends.size() << ")");
+
+    Backend& backend = m_backends[i];
+    if (backend.quarantined == quarantined)
+    {
+        return;
+    }
+    backend.quarantined = quarantined;
+    if (backend.available)
+    {
+        UpdateAvailable(i, !quarantined);
+    }
+}
+
+bool
+Cluster::IsQuarantined(uint32_t i) const
+{
+    return Get(i).quarantined;
+}
+
+uint32_t
+Cluster::GetNAvailable() const
+{
+    return m_available.size();
+}
+
+const std::vector<uint32_t>&
+Cluster::GetAvailableBackends() const
+{
+    return m_available;
+}
+
+const std::vector<uint32_t>&
+Cluster::GetAvailableBackendsByType(const std::string& acceleratorType) const
+{
+    static const std::vector<uint32_t> empty;
+    auto it = m_availableTypeIndex.find(acceleratorType);
+    if (it != m_availableTypeIndex.end())
+    {
+        return it->second;
+    }
+    return empty;
+}
+
+uint64_t
+Cluster::GetGeneration() const
+{
+    return m_generation;
+}
+
+void
+Cluster::UpdateAvailable(uint32_t i, bool accepting)
+{
+    // Keep the indexes sorted so that schedulers see backends in index order
+    auto update = [i, accepting](std::vector<uint32_t>& indices) {
+        auto it = std::lower_bound(indices.begin(), indices.end(), i);
+        if (accepting)
+        {
+            indices.insert(it, i);
+        }
+        else
+        {
+            indices.erase(it);
+        }
+    };
+    update(m_available);
+    update(m_availableTypeIndex[m_backends[i].acceleratorType]);
+    m_generation++;
+
+    NS_LOG_DEBUG("Backend " << i << (accepting ? " available" : " unavailable") << ", "
+                            << m_available.size() << " of " << m_backends.size()
+                            << " available");
+}
+
 } // namespace ns3
@@ -33,6 +33,18 @@ namespace ns3
  * - A pointer to the server Node (which may have a GpuAccelerator aggregated)
  * - The network Address (InetSocketAddress with IP and port) for TCP connections
  *
+ * Membership is fixed once the simulation starts, but backends can be made
+ * unavailable at runtime (e.g. while powered down by BackendAutoscaler).
+ * Backend indices never change; schedulers and admission policies select
+ * among GetAvailableBackends() / GetAvailableBackendsByType(), while the
+ * type and address lookups keep covering every backend so that responses
+ * from a draining backend still resolve.
+ *
+ * A backend can also be quarantined (e.g. by EdgeOrchestrator when it
+ * turns slow). Quarantine is kept apart from availability, so that powering
+ * a backend on does not lift it: a backend accepts new tasks only while it
+ * is both available and not quarantined.
+ *
  * Example usage:
  * @code
  * Cluster cluster;
@@ -58,6 +70,8 @@ class Cluster
         Ptr<Node> node;  //!< The backend server node (may have GpuAccelerator aggregated)
         Address address; //!< Server address (InetSocketAddress with IP and port)
         std::string acceleratorType; //!< Type of accelerator (e.g., "GPU", "TPU"). Empty = any.
+        bool available{true};        //!< Accepting new tasks (false while powered down)
+        bool quarantined{false};     //!< Withheld from new tasks while it misbehaves
     };
 
     /// Iterator type for traversing backends
@@ -165,11 +179,87 @@ class Cluster
      */
     int32_t GetBackendIndex(const Address& address) const;
 
+    /**
+     * @brief Mark a backend as available or unavailable for new tasks.
+     *
+     * @param i The index of the backend (0 to GetN()-1).
+     * @param available Whether the backend accepts new tasks.
+     */
+    void SetAvailable(uint32_t i, bool available);
+
+    /**
+     * @brief Check whether a backend is available for new tasks.
+     *
+     * @param i The index of the backend (0 to GetN()-1).
+     * @return true if the backend is available and not quarantined.
+     */
+    bool IsAvailable(uint32_t i) const;
+
+    /**
+     * @brief Withhold a backend from new tasks, or return it to service.
+     *
+     * @param i The index of the backend (0 to GetN()-1).
+     * @param quarantined Whether the backend is quarantined.
+     */
+    void SetQuarantined(uint32_t i, bool quarantined);
+
+    /**
+     * @brief Check whether a backend is quarantined.
+     *
+     * @param i The index of the backend (0 to GetN()-1).
+     * @return true if the backend is quarantined.
+     */
+    bool IsQuarantined(uint32_t i) const;
+
+    /**
+     * @brief Get the number of available backends.
+     *
+     * @return The number of backends accepting new tasks.
+     */
+    uint32_t GetNAvailable() const;
+
+    /**
+     * @brief Get the indices of all available backends.
+     *
+     * @return Vector of available backend indices, sorted ascending.
+     */
+    const std::vector<uint32_t>& GetAvailableBackends() const;
+
+    /**
+     * @brief Get available backend indices for a specific accelerator type.
+     *
+     * @param acceleratorType The accelerator type to filter by (e.g., "GPU", "TPU").
+     * @return Vector of available backend indices matching the type, sorted ascending.
+     */
+    const std::vector<uint32_t>& GetAvailableBackendsByType(
+        const std::string& acceleratorType) const;
+
+    /**
+     * @brief Get a counter that changes whenever membership or availability changes.
+     *
+     * Lets derived indexes (e.g. ClusterState's load index) detect that they
+     * need rebuilding without comparing backend lists.
+     *
+     * @return The current generation.
+     */
+    uint64_t GetGeneration() const;
+
   private:
+    /**
+     * @brief Add or remove a backend in the available indexes.
+     * @param i The index of the backend.
+     * @param accepting Whether the backend now accepts new tasks.
+     */
+    void UpdateAvailable(uint32_t i, bool accepting);
+
     std::vector<Backend> m_backends; //!< The collection of backend servers
     std::map<std::string, std::vector<uint32_t>>
         m_typeIndex;                         //!< accelerator type → backend indices
     std::map<Address, uint32_t> m_addrIndex; //!< address → backend index
+    std::vector<uint32_t> m_available;       //!< Available backend indices
+    std::map<std::string, std::vector<uint32_t>>
+        m_availableTypeIndex; //!< accelerator type → available backend indices
+    uint64_t m_generation{0}; //!< Bumped on every membership or availability change
 };
 
 } // namespace ns3
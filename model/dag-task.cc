@@ -11,6 +11,7 @@
 #include "ns3/log.h"
 
 #include <algorithm>
+#include <cstring>
 #include <deque>
 #include <set>
 
@@ -291,6 +292,27 @@ DagTask::GetTaskCount() const
     return static_cast<uint32_t>(m_nodes.size());
 }
 
+uint32_t
+DagTask::GetVariantCount() const
+{
+    uint32_t variants = 0;
+    for (const auto& node : m_nodes)
+    {
+        variants = std::max(variants, node.task->GetVariantCount());
+    }
+    return variants;
+}
+
+void
+DagTask::ApplyVariant(uint32_t variant)
+{
+    NS_LOG_FUNCTION(this << variant);
+    for (const auto& node : m_nodes)
+    {
+        node.task->ApplyVariant(variant);
+    }
+}
+
 bool
 DagTask::IsComplete() const
 {
@@ -426,6 +448,48 @@ DagTask::SerializeInternal(bool metadataOnly) const
         }
     }
 
+    // Variants trail the edges only when present, so DAGs without them keep their size
+    uint32_t variantCount = 0;
+    for (const auto& node : m_nodes)
+    {
+        variantCount += node.task->GetVariantCount();
+    }
+    if (!metadataOnly || variantCount == 0)
+    {
+        return result;
+    }
+
+    uint8_t variantCountBuf[4];
+    variantCountBuf[0] = (variantCount >> 24) & 0xFF;
+    variantCountBuf[1] = (variantCount >> 16) & 0xFF;
+    variantCountBuf[2] = (variantCount >> 8) & 0xFF;
+    variantCountBuf[3] = variantCount & 0xFF;
+    result->AddAtEnd(Create<Packet>(variantCountBuf, 4));
+
+    for (uint32_t idx = 0; idx < m_nodes.size(); idx++)
+    {
+        Ptr<Task> task = m_nodes[idx].task;
+        for (uint32_t v = 1; v <= task->GetVariantCount(); v++)
+        {
+            double flops = task->GetVariantComputeDemand(v);
+            uint64_t flopsBits;
+            std::memcpy(&flopsBits, &flops, sizeof(flopsBits));
+            uint64_t outputBytes = task->GetVariantOutputSize(v);
+
+            uint8_t variantBuf[20];
+            variantBuf[0] = (idx >> 24) & 0xFF;
+            variantBuf[1] = (idx >> 16) & 0xFF;
+            variantBuf[2] = (idx >> 8) & 0xFF;
+            variantBuf[3] = idx & 0xFF;
+            for (uint32_t b = 0; b < 8; b++)
+            {
+                variantBuf[4 + b] = (flopsBits >> (56 - 8 * b)) & 0xFF;
+                variantBuf[12 + b] = (outputBytes >> (56 - 8 * b)) & 0xFF;
+            }
+            result->AddAtEnd(Create<Packet>(variantBuf, 20));
+        }
+    }
+
     return result;
 }
 
@@ -546,6 +610,55 @@ DagTask::DeserializeInternal(Ptr<Packet> packet,
         offset += 9;
     }
 
+    // Optional variants section
+    if (packet->GetSize() >= offset + 4)
+    {
+        uint8_t variantCountBuf[4];
+        Ptr<Packet> variantCountFragment = packet->CreateFragment(offset, 4);
+        variantCountFragment->CopyData(variantCountBuf, 4);
+        uint32_t variantCount = (static_cast<uint32_t>(variantCountBuf[0]) << 24) |
+                                (static_cast<uint32_t>(variantCountBuf[1]) << 16) |
+                                (static_cast<uint32_t>(variantCountBuf[2]) << 8) |
+                                static_cast<uint32_t>(variantCountBuf[3]);
+        offset += 4;
+
+        for (uint32_t i = 0; i < variantCount; i++)
+        {
+            if (packet->GetSize() < offset + 20)
+            {
+                NS_LOG_WARN("Not enough data for variant " << i);
+                return nullptr;
+            }
+
+            uint8_t variantBuf[20];
+            Ptr<Packet> variantFragment = packet->CreateFragment(offset, 20);
+            variantFragment->CopyData(variantBuf, 20);
+
+            uint32_t idx = (static_cast<uint32_t>(variantBuf[0]) << 24) |
+                           (static_cast<uint32_t>(variantBuf[1]) << 16) |
+                           (static_cast<uint32_t>(variantBuf[2]) << 8) |
+                           static_cast<uint32_t>(variantBuf[3]);
+            uint64_t flopsBits = 0;
+            uint64_t outputBytes = 0;
+            for (uint32_t b = 4; b < 12; b++)
+            {
+                flopsBits = (flopsBits << 8) | variantBuf[b];
+                outputBytes = (outputBytes << 8) | variantBuf[b + 8];
+            }
+            double flops;
+            std::memcpy(&flops, &flopsBits, sizeof(flops));
+
+            if (idx >= taskCount)
+            {
+                NS_LOG_WARN("Invalid variant task index: " << idx);
+                return nullptr;
+            }
+
+            dag->GetTask(idx)->AddVariant(flops, outputBytes);
+            offset += 20;
+        }
+    }
+
     consumedBytes = offset;
     return dag;
 }
@@ -178,6 +178,22 @@ class DagTask : public Object
      */
     uint32_t GetTaskCount() const;
 
+    /**
+     * @brief Get the number of degraded variants the DAG can run as.
+     * @return The largest variant count of any task (0 = none).
+     */
+    uint32_t GetVariantCount() const;
+
+    /**
+     * @brief Run every task as one of its variants.
+     *
+     * Tasks with fewer variants run as their cheapest one, and tasks without
+     * variants are unchanged.
+     *
+     * @param variant The variant (0 = original).
+     */
+    void ApplyVariant(uint32_t variant);
+
     /**
      * @brief Check if all tasks are completed.
      * @return true if all tasks are completed.
@@ -196,7 +212,8 @@ class DagTask : public Object
     /**
      * @brief Serialize DAG metadata for admission request (Phase 1).
      *
-     * Serializes task headers (no payload data) and graph edges.
+     * Serializes task headers (no payload data) and graph edges, followed
+     * by the task variants if any task has them.
      *
      * @return Packet containing the serialized DAG metadata.
      */
@@ -215,7 +232,7 @@ class DagTask : public Object
      * @brief Deserialize DAG metadata from a packet (Phase 1).
      *
      * Reconstructs a DagTask from metadata-only serialization.
-     * Tasks will have metadata but no payload data.
+     * Tasks will have metadata and variants but no payload data.
      *
      * @param packet The packet containing the serialized DAG metadata.
      * @param deserializer Callback to deserialize individual task headers.
@@ -15,7 +15,9 @@
 #include "ns3/log.h"
 #include "ns3/simulator.h"
 
-#include <vector>
+#include <algorithm>
+#include <map>
+#include <set>
 
 namespace ns3
 {
@@ -32,15 +34,29 @@ DeadlineAwareAdmissionPolicy::GetTypeId()
             .SetGroupName("Distributed")
             .AddConstructor<DeadlineAwareAdmissionPolicy>()
             .AddAttribute("ComputeRate",
-                          "Assumed backend processing rate in FLOPS",
+                          "Compute rate in FLOPS at ReferenceFrequency, for backends whose "
+                          "rates are not recorded in ClusterState",
                           DoubleValue(1e12),
                           MakeDoubleAccessor(&DeadlineAwareAdmissionPolicy::m_computeRate),
+                          MakeDoubleChecker<double>(0.0))
+            .AddAttribute("ReferenceFrequency",
+                          "Frequency in Hz at which ComputeRate applies",
+                          DoubleValue(1.5e9),
+                          MakeDoubleAccessor(&DeadlineAwareAdmissionPolicy::m_referenceFrequency),
+                          MakeDoubleChecker<double>(0.0))
+            .AddAttribute("LinkRate",
+                          "Network transfer rate in bytes/s for backends whose link rate has "
+                          "not been measured (0 = ignore transfer time)",
+                          DoubleValue(0.0),
+                          MakeDoubleAccessor(&DeadlineAwareAdmissionPolicy::m_linkRate),
                           MakeDoubleChecker<double>(0.0));
     return tid;
 }
 
 DeadlineAwareAdmissionPolicy::DeadlineAwareAdmissionPolicy()
-    : m_computeRate(1e12)
+    : m_computeRate(1e12),
+      m_referenceFrequency(1.5e9),
+      m_linkRate(0.0)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -50,6 +66,25 @@ DeadlineAwareAdmissionPolicy::~DeadlineAwareAdmissionPolicy()
     NS_LOG_FUNCTION(this);
 }
 
+double
+DeadlineAwareAdmissionPolicy::GetComputeRate(const ClusterState::BackendState& backend) const
+{
+    bool known = backend.computeRate > 0 && backend.referenceFrequency > 0;
+    double computeRate = known ? backend.computeRate : m_computeRate;
+    double referenceFrequency = known ? backend.referenceFrequency : m_referenceFrequency;
+    if (referenceFrequency <= 0 || backend.commandedFrequency <= 0)
+    {
+        return computeRate;
+    }
+    return computeRate * backend.commandedFrequency / referenceFrequency;
+}
+
+double
+DeadlineAwareAdmissionPolicy::GetLinkRate(const ClusterState::BackendState& backend) const
+{
+    return backend.linkRate > 0 ? backend.linkRate : m_linkRate;
+}
+
 bool
 DeadlineAwareAdmissionPolicy::ShouldAdmit(Ptr<DagTask> dag,
                                           const Cluster& cluster,
@@ -58,64 +93,109 @@ DeadlineAwareAdmissionPolicy::ShouldAdmit(Ptr<DagTask> dag,
     NS_LOG_FUNCTION(this << dag->GetTaskCount() << state.GetActiveWorkloadCount());
 
     uint32_t n = dag->GetTaskCount();
+    Time now = Simulator::Now();
+
+    m_placement.assign(n, -1);
+    m_finishTimes.assign(n, now);
+
+    // Predecessors must finish before a task's input is sent
+    std::vector<Time> ready(n, now);
 
-    std::vector<Time> earliestStart(n, Simulator::Now());
-    std::vector<uint32_t> topoOrder = dag->GetTopologicalOrder();
+    // When each backend is expected to finish the tracked outstanding work
+    // plus the tasks of this DAG placed on it so far
+    std::map<uint32_t, Time> busyUntil;
+    std::set<uint32_t> used;
 
-    for (uint32_t curr : topoOrder)
+    for (uint32_t curr : dag->GetTopologicalOrder())
     {
-        double execTime = dag->GetTask(curr)->GetComputeDemand() / m_computeRate;
-        Time currCompletion = earliestStart[curr] + Seconds(execTime);
+        Ptr<Task> task = dag->GetTask(curr);
 
-        for (uint32_t s : dag->GetSuccessors(curr))
+        m_finishTimes[curr] = ready[curr];
+
+        std::string reqType = task->GetRequiredAcceleratorType();
+        const std::vector<uint32_t>& pool = reqType.empty()
+                                                ? cluster.GetAvailableBackends()
+                                                : cluster.GetAvailableBackendsByType(reqType);
+
+        double demand = task->GetComputeDemand();
+        double inputBytes = static_cast<double>(task->GetInputSize());
+        double outputBytes = static_cast<double>(task->GetOutputSize());
+
+        int32_t bestIdx = -1;
+        Time bestFinish;
+        Time bestExecEnd;
+        for (uint32_t b : pool)
         {
-            if (currCompletion > earliestStart[s])
+            const ClusterState::BackendState& backend = state.Get(b);
+            double rate = GetComputeRate(backend);
+            double linkRate = GetLinkRate(backend);
+            if (rate <= 0)
             {
-                earliestStart[s] = currCompletion;
+                continue;
             }
-        }
-    }
 
-    for (uint32_t i = 0; i < n; ++i)
-    {
-        Ptr<Task> task = dag->GetTask(i);
+            // Work queued ahead drains on every device of the backend
+            double drainRate = rate * backend.deviceCount;
+            auto it = busyUntil.find(b);
+            if (it == busyUntil.end())
+            {
+                double flops = backend.outstandingFlops + backend.reservedFlops;
+                it = busyUntil.emplace(b, now + Seconds(flops / drainRate)).first;
+            }
 
-        if (!task->HasDeadline())
-        {
-            continue;
-        }
+            // Dispatches made without a task carry no size; assume they are
+            // as large as the first task of this DAG to queue behind them
+            Time queue = it->second;
+            uint32_t tracked = static_cast<uint32_t>(backend.outstandingTasks.size());
+            if (backend.activeTasks > tracked && used.count(b) == 0)
+            {
+                queue += Seconds((backend.activeTasks - tracked) * demand / drainRate);
+            }
 
-        std::string reqType = task->GetRequiredAcceleratorType();
-        bool feasible = false;
+            // Half the measured round trip is paid each way
+            Time latency = backend.linkLatency / 2;
+            Time arrival =
+                ready[curr] + latency + Seconds(linkRate > 0 ? inputBytes / linkRate : 0);
+            Time execEnd = std::max(arrival, queue) + Seconds(demand / rate);
+            Time finish = execEnd + latency + Seconds(linkRate > 0 ? outputBytes / linkRate : 0);
 
-        if (reqType.empty())
-        {
-            for (uint32_t b = 0; b < state.GetN(); ++b)
+            if (bestIdx < 0 || finish < bestFinish)
             {
-                if (CanMeetDeadline(task, state.Get(b), earliestStart[i]))
-                {
-                    feasible = true;
-                    break;
-                }
+                bestIdx = static_cast<int32_t>(b);
+                bestFinish = finish;
+                bestExecEnd = execEnd;
             }
         }
-        else
+
+        if (bestIdx < 0)
         {
-            const auto& indices = cluster.GetBackendsByType(reqType);
-            for (uint32_t idx : indices)
+            if (task->HasDeadline())
             {
-                if (CanMeetDeadline(task, state.Get(idx), earliestStart[i]))
-                {
-                    feasible = true;
-                    break;
-                }
+                NS_LOG_DEBUG("DeadlineAware: rejecting workload, no backend for task "
+                             << task->GetTaskId());
+                return false;
             }
         }
+        else
+        {
+            // Later tasks of this DAG queue behind this one on the same backend
+            busyUntil[bestIdx] = bestExecEnd;
+            used.insert(bestIdx);
+            m_placement[curr] = bestIdx;
+            m_finishTimes[curr] = bestFinish;
+        }
+
+        for (uint32_t s : dag->GetSuccessors(curr))
+        {
+            ready[s] = std::max(ready[s], m_finishTimes[curr]);
+        }
 
-        if (!feasible)
+        if (task->HasDeadline() && bestFinish > task->GetDeadline())
         {
-            NS_LOG_DEBUG("DeadlineAware: rejecting workload, task " << task->GetTaskId()
-                                                                    << " cannot meet deadline");
+            NS_LOG_DEBUG("DeadlineAware: rejecting workload, task "
+                         << task->GetTaskId() << " would finish at " << bestFinish
+                         << " on backend " << bestIdx << ", after its deadline "
+                         << task->GetDeadline());
             return false;
         }
     }
@@ -130,15 +210,16 @@ DeadlineAwareAdmissionPolicy::GetName() const
     return "DeadlineAware";
 }
 
-bool
-DeadlineAwareAdmissionPolicy::CanMeetDeadline(Ptr<Task> task,
-                                              const ClusterState::BackendState& backend,
-                                              Time earliestStart) const
+const std::vector<int32_t>&
+DeadlineAwareAdmissionPolicy::GetPlacement() const
+{
+    return m_placement;
+}
+
+const std::vector<Time>&
+DeadlineAwareAdmissionPolicy::GetFinishTimes() const
 {
-    double wait = backend.activeTasks * (task->GetComputeDemand() / m_computeRate);
-    double exec = task->GetComputeDemand() / m_computeRate;
-    Time estimatedCompletion = earliestStart + Seconds(wait + exec);
-    return estimatedCompletion <= task->GetDeadline();
+    return m_finishTimes;
 }
 
 } // namespace ns3
@@ -15,6 +15,8 @@
 
 #include "ns3/nstime.h"
 
+#include <vector>
+
 namespace ns3
 {
 
@@ -22,13 +24,27 @@ namespace ns3
  * @ingroup distributed
  * @brief Admission policy that rejects workloads with infeasible deadlines.
  *
- * Estimates whether each task in the DAG can complete before its deadline
- * given current backend load and DAG dependency structure. A task cannot
- * start until all its predecessors complete, so the earliest start time
- * accounts for the critical path through the DAG.
+ * Admission plans a placement of the whole DAG. Tasks are visited in
+ * topological order and each is placed on the available backend matching
+ * its accelerator type that would finish it first, given:
+ *
+ * - the backend's outstanding work, queued ahead of the task: the compute
+ *   demand of tracked dispatches and of reserved workloads still awaiting
+ *   their data, with each untracked dispatch assumed to be as large as the
+ *   task itself, drained by all of the backend's devices together;
+ * - the compute rate of one device at the frequency commanded in
+ *   ClusterState, scaled linearly from its reference frequency, since the
+ *   task itself runs on one device;
+ * - the backend's measured link latency, plus the input and output bytes
+ *   over its measured link rate;
+ * - the finish times of the task's predecessors, which must complete
+ *   before the task's input can be sent;
+ * - the tasks of this DAG already placed on the backend.
  *
- * Tasks without deadlines are always feasible. If any task cannot meet
- * its deadline on any matching backend, the entire workload is rejected.
+ * Backends whose rates are not recorded in ClusterState use this policy's
+ * attributes. Tasks without deadlines are always feasible but still take
+ * their share of the backend they are placed on. If any task would finish
+ * after its deadline, the entire workload is rejected.
  */
 class DeadlineAwareAdmissionPolicy : public AdmissionPolicy
 {
@@ -43,7 +59,7 @@ class DeadlineAwareAdmissionPolicy : public AdmissionPolicy
     ~DeadlineAwareAdmissionPolicy() override;
 
     /**
-     * @brief Admit if all tasks with deadlines can be met on at least one backend.
+     * @brief Admit if a placement exists that meets every task's deadline.
      *
      * @param dag The workload DAG
      * @param cluster Current cluster state
@@ -58,20 +74,42 @@ class DeadlineAwareAdmissionPolicy : public AdmissionPolicy
      */
     std::string GetName() const override;
 
-  private:
     /**
-     * @brief Check if a task can meet its deadline on a given backend.
+     * @brief Get the placement planned by the last admission check.
+     *
+     * Entries are indexed by DAG task index. Tasks with no matching
+     * backend, and tasks not reached before a rejection, are -1.
      *
-     * @param task The task to check
+     * @return Backend index per task.
+     */
+    const std::vector<int32_t>& GetPlacement() const override;
+
+    /**
+     * @brief Get the finish times planned by the last admission check.
+     * @return Estimated finish time per DAG task index.
+     */
+    const std::vector<Time>& GetFinishTimes() const;
+
+  private:
+    /**
+     * @brief Get the compute rate of one of a backend's devices at its commanded frequency.
+     * @param backend The backend state
+     * @return Compute rate in FLOPS
+     */
+    double GetComputeRate(const ClusterState::BackendState& backend) const;
+
+    /**
+     * @brief Get a backend's link rate.
      * @param backend The backend state
-     * @param earliestStart The earliest time this task can begin (after predecessors complete)
-     * @return true if estimated completion time is within deadline
+     * @return Link rate in bytes/s (0 = transfers are not modelled)
      */
-    bool CanMeetDeadline(Ptr<Task> task,
-                         const ClusterState::BackendState& backend,
-                         Time earliestStart) const;
+    double GetLinkRate(const ClusterState::BackendState& backend) const;
 
-    double m_computeRate; //!< Backend processing rate in FLOPS
+    double m_computeRate;             //!< Default compute rate in FLOPS
+    double m_referenceFrequency;      //!< Frequency at which m_computeRate applies, in Hz
+    double m_linkRate;                //!< Default link rate in bytes/s
+    std::vector<int32_t> m_placement; //!< Backend per DAG task from the last check
+    std::vector<Time> m_finishTimes;  //!< Estimated finish per DAG task from the last check
 };
 
 } // namespace ns3
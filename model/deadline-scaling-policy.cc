@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#include "deadline-scaling-policy.h"
+
+#include "ns3/double.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+
+#include <algorithm>
+#include <limits>
+#include <tuple>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("DeadlineScalingPolicy");
+
+NS_OBJECT_ENSURE_REGISTERED(DeadlineScalingPolicy);
+
+TypeId
+DeadlineScalingPolicy::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::DeadlineScalingPolicy")
+            .SetParent<ScalingPolicy>()
+            .SetGroupName("Distributed")
+            .AddConstructor<DeadlineScalingPolicy>()
+            .AddAttribute("ComputeRate",
+                          "Compute rate in FLOPS at ReferenceFrequency, for backends whose "
+                          "rates are not recorded in ClusterState",
+                          DoubleValue(1e12),
+                          MakeDoubleAccessor(&DeadlineScalingPolicy::m_computeRate),
+                          MakeDoubleChecker<double>(0.0))
+            .AddAttribute("ReferenceFrequency",
+                          "Frequency in Hz at which ComputeRate applies",
+                          DoubleValue(1.5e9),
+                          MakeDoubleAccessor(&DeadlineScalingPolicy::m_referenceFrequency),
+                          MakeDoubleChecker<double>(0.0));
+    return tid;
+}
+
+DeadlineScalingPolicy::DeadlineScalingPolicy()
+    : m_computeRate(1e12),
+      m_referenceFrequency(1.5e9)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+DeadlineScalingPolicy::~DeadlineScalingPolicy()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+Ptr<ScalingDecision>
+DeadlineScalingPolicy::Decide(const ClusterState::BackendState& backend,
+                              const std::vector<OperatingPoint>& opps)
+{
+    NS_LOG_FUNCTION(this);
+
+    if (opps.empty())
+    {
+        return nullptr;
+    }
+
+    size_t targetIdx = 0;
+    if (backend.activeTasks > 0)
+    {
+        double required = GetRequiredFrequency(backend);
+        targetIdx = opps.size() - 1;
+        for (size_t i = 0; i < opps.size(); i++)
+        {
+            if (opps[i].frequency >= required)
+            {
+                targetIdx = i;
+                break;
+            }
+        }
+        NS_LOG_DEBUG("Required frequency " << required << " Hz, selecting "
+                                           << opps[targetIdx].frequency << " Hz");
+    }
+
+    if (opps[targetIdx].frequency == backend.commandedFrequency)
+    {
+        return nullptr;
+    }
+
+    Ptr<ScalingDecision> decision = Create<ScalingDecision>();
+    decision->targetFrequency = opps[targetIdx].frequency;
+    decision->targetVoltage = opps[targetIdx].voltage;
+    return decision;
+}
+
+double
+DeadlineScalingPolicy::GetRequiredFrequency(const ClusterState::BackendState& backend) const
+{
+    std::vector<std::tuple<Time, double, uint64_t>> work;
+    work.reserve(backend.outstandingTasks.size());
+    for (const auto& entry : backend.outstandingTasks)
+    {
+        const ClusterState::OutstandingTask& task = entry.second;
+        Time deadline = task.deadline.IsStrictlyNegative() ? Time::Max() : task.deadline;
+        work.emplace_back(deadline, task.computeDemand, task.bytes);
+    }
+    std::sort(work.begin(), work.end());
+
+    bool known = backend.computeRate > 0 && backend.referenceFrequency > 0;
+    double computeRate = known ? backend.computeRate : m_computeRate;
+    double referenceFrequency = known ? backend.referenceFrequency : m_referenceFrequency;
+
+    // Work ahead of a task drains on every device; the task itself runs on one
+    double devices = static_cast<double>(backend.deviceCount);
+    Time now = Simulator::Now();
+    double aheadFlops = 0;
+    double aheadBytes = 0;
+    double required = 0;
+    for (const auto& [deadline, flops, bytes] : work)
+    {
+        if (deadline == Time::Max())
+        {
+            break;
+        }
+
+        // Transfers take as long at any clock, leaving less time for compute
+        double slack = (deadline - now).GetSeconds();
+        if (backend.memoryBandwidth > 0)
+        {
+            slack -= (aheadBytes / devices + static_cast<double>(bytes)) / backend.memoryBandwidth;
+        }
+        if (slack <= 0)
+        {
+            return std::numeric_limits<double>::infinity();
+        }
+
+        double demand = aheadFlops / devices + flops;
+        double frequency = referenceFrequency * demand / (computeRate * slack);
+        required = std::max(required, frequency);
+        aheadFlops += flops;
+        aheadBytes += static_cast<double>(bytes);
+    }
+    return required;
+}
+
+std::string
+DeadlineScalingPolicy::GetName() const
+{
+    return "DeadlineScaling";
+}
+
+} // namespace ns3
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#ifndef DEADLINE_SCALING_POLICY_H
+#define DEADLINE_SCALING_POLICY_H
+
+#include "scaling-policy.h"
+
+namespace ns3
+{
+
+/**
+ * @ingroup distributed
+ * @brief DVFS scaling policy that runs at the slowest OPP meeting all deadlines.
+ *
+ * The policy uses the outstanding tasks the orchestrator has dispatched to
+ * the backend (ClusterState::BackendState::outstandingTasks). Taking the
+ * tasks in earliest-deadline-first order, the k-th deadline requires
+ *
+ * f >= referenceFrequency * (sum(FLOPs of tasks 1..k-1) / N + FLOPs of task k)
+ *      / (computeRate * s_k)
+ *
+ * since the compute rate scales linearly with frequency. The work ahead of
+ * task k drains on all N devices of the backend, while task k runs on one.
+ * The slack s_k is d_k - now, less the bytes of the same work over
+ * memoryBandwidth when the backend's memory bandwidth is known, as
+ * transfers take as long at any clock. The rates are those of one of the
+ * backend's devices (see ClusterState::SetDeviceRates);
+ * backends whose compute rate was not recorded use this policy's
+ * attributes.
+ *
+ * The lowest OPP satisfying every constraint is selected; tasks without a
+ * deadline add to the work ahead of later deadlines but impose no
+ * constraint of their own.
+ * Once a deadline can no longer be met the highest OPP is selected, and an
+ * idle backend drops to the lowest OPP.
+ */
+class DeadlineScalingPolicy : public ScalingPolicy
+{
+  public:
+    /**
+     * @brief Get the type ID.
+     * @return The object TypeId.
+     */
+    static TypeId GetTypeId();
+
+    DeadlineScalingPolicy();
+    ~DeadlineScalingPolicy() override;
+
+    Ptr<ScalingDecision> Decide(const ClusterState::BackendState& backend,
+                                const std::vector<OperatingPoint>& opps) override;
+    std::string GetName() const override;
+
+    /**
+     * @brief Compute the lowest frequency that meets every outstanding deadline.
+     * @param backend The backend state.
+     * @return Required frequency in Hz, or infinity if a deadline is unreachable.
+     */
+    double GetRequiredFrequency(const ClusterState::BackendState& backend) const;
+
+  private:
+    double m_computeRate;        //!< Default compute rate in FLOPS at the reference frequency
+    double m_referenceFrequency; //!< Frequency at which m_computeRate applies, in Hz
+};
+
+} // namespace ns3
+
+#endif // DEADLINE_SCALING_POLICY_H
@@ -8,10 +8,14 @@
 
 #include "device-manager.h"
 
+#include "accelerator-pool.h"
 #include "device-metrics-header.h"
+#include "metrics-trailer-header.h"
 
+#include "ns3/boolean.h"
 #include "ns3/log.h"
 #include "ns3/pointer.h"
+#include "ns3/simulator.h"
 
 namespace ns3
 {
@@ -33,11 +37,33 @@ DeviceManager::GetTypeId()
                           PointerValue(),
                           MakePointerAccessor(&DeviceManager::m_scalingPolicy),
                           MakePointerChecker<ScalingPolicy>())
+            .AddAttribute("ClusterScalingPolicy",
+                          "Cluster-wide scaling strategy; replaces ScalingPolicy when set",
+                          PointerValue(),
+                          MakePointerAccessor(&DeviceManager::m_clusterScalingPolicy),
+                          MakePointerChecker<ClusterScalingPolicy>())
             .AddAttribute("DeviceProtocol",
                           "Protocol for metrics/command serialization",
                           PointerValue(),
                           MakePointerAccessor(&DeviceManager::m_deviceProtocol),
                           MakePointerChecker<DeviceProtocol>())
+            .AddAttribute("MinCommandInterval",
+                          "Minimum time between scaling commands to the same backend",
+                          TimeValue(Seconds(0)),
+                          MakeTimeAccessor(&DeviceManager::m_minCommandInterval),
+                          MakeTimeChecker(Seconds(0)))
+            .AddAttribute("ScaleDownDelay",
+                          "Time the policy must keep requesting a lower frequency before "
+                          "it is applied (scale-up is immediate)",
+                          TimeValue(Seconds(0)),
+                          MakeTimeAccessor(&DeviceManager::m_scaleDownDelay),
+                          MakeTimeChecker(Seconds(0)))
+            .AddAttribute("PiggybackCommands",
+                          "Attach scaling decisions made on dispatch to the task message "
+                          "instead of sending a separate scaling command",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&DeviceManager::m_piggybackCommands),
+                          MakeBooleanChecker())
             .AddTraceSource("FrequencyChanged",
                             "Trace fired when a backend frequency is changed",
                             MakeTraceSourceAccessor(&DeviceManager::m_frequencyChangedTrace),
@@ -47,7 +73,12 @@ DeviceManager::GetTypeId()
 
 DeviceManager::DeviceManager()
     : m_scalingPolicy(nullptr),
-      m_deviceProtocol(nullptr)
+      m_clusterScalingPolicy(nullptr),
+      m_deviceProtocol(nullptr),
+      m_minCommandInterval(Seconds(0)),
+      m_scaleDownDelay(Seconds(0)),
+      m_piggybackCommands(false),
+      m_clusterState(nullptr)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -63,14 +94,33 @@ DeviceManager::Start(const Cluster& cluster, Ptr<ConnectionManager> backendCm, C
     NS_LOG_FUNCTION(this);
     m_cluster = cluster;
     m_backendConnMgr = backendCm;
+    m_clusterState = &state;
 
     m_operatingPoints.resize(cluster.GetN());
+    m_backendProfiles.assign(cluster.GetN(), ClusterScalingPolicy::BackendProfile());
+    m_lastCommandTime.assign(cluster.GetN(), Seconds(-1));
+    m_scaleDownSince.assign(cluster.GetN(), Seconds(-1));
+    m_reevaluateEvents.resize(cluster.GetN());
     for (uint32_t i = 0; i < cluster.GetN(); i++)
     {
         Ptr<Accelerator> accel = cluster.Get(i).node->GetObject<Accelerator>();
+        if (!accel)
+        {
+            // Multi-accelerator backends are commanded as one node, so the
+            // first device's OPP table stands for the whole pool.
+            Ptr<AcceleratorPool> pool = cluster.Get(i).node->GetObject<AcceleratorPool>();
+            if (pool && pool->GetN() > 0)
+            {
+                accel = pool->Get(0);
+                m_backendProfiles[i].deviceCount = pool->GetN();
+            }
+        }
         if (accel)
         {
             m_operatingPoints[i] = accel->GetOperatingPoints();
+            m_backendProfiles[i].operatingPoints = m_operatingPoints[i];
+            m_backendProfiles[i].energyModel =
+                DynamicCast<DvfsEnergyModel>(accel->GetEnergyModel());
             state.SetCommandedFrequency(i, accel->GetFrequency());
         }
     }
@@ -84,12 +134,21 @@ DeviceManager::TryConsumeMetrics(Ptr<Packet> buffer, const Address& from, Cluste
     uint8_t firstByte;
     buffer->CopyData(&firstByte, 1);
 
-    if (firstByte != DeviceMetricsHeader::DEVICE_METRICS)
+    uint32_t size;
+    if (firstByte == DeviceMetricsHeader::DEVICE_METRICS)
+    {
+        size = DeviceMetricsHeader::SERIALIZED_SIZE;
+    }
+    else if (firstByte == MetricsTrailerHeader::METRICS_TRAILER)
+    {
+        size = MetricsTrailerHeader::SERIALIZED_SIZE;
+    }
+    else
     {
         return false;
     }
 
-    if (buffer->GetSize() < DeviceMetricsHeader::SERIALIZED_SIZE)
+    if (buffer->GetSize() < size)
     {
         return false;
     }
@@ -101,8 +160,8 @@ DeviceManager::TryConsumeMetrics(Ptr<Packet> buffer, const Address& from, Cluste
     }
     uint32_t backendIdx = static_cast<uint32_t>(idx);
 
-    Ptr<Packet> metricsPacket = buffer->CreateFragment(0, DeviceMetricsHeader::SERIALIZED_SIZE);
-    buffer->RemoveAtStart(DeviceMetricsHeader::SERIALIZED_SIZE);
+    Ptr<Packet> metricsPacket = buffer->CreateFragment(0, size);
+    buffer->RemoveAtStart(size);
     HandleMetrics(metricsPacket, backendIdx, state);
     return true;
 }
@@ -124,42 +183,238 @@ DeviceManager::EvaluateScaling(ClusterState& state)
 {
     NS_LOG_FUNCTION(this);
 
+    if (m_clusterScalingPolicy && m_deviceProtocol)
+    {
+        EvaluateCluster(state);
+        return;
+    }
+
     if (!m_scalingPolicy || !m_deviceProtocol)
     {
         return;
     }
 
-    for (uint32_t i = 0; i < state.GetN(); i++)
+    for (uint32_t i : state.TakeDirtyBackends())
+    {
+        EvaluateBackend(state, i);
+    }
+}
+
+void
+DeviceManager::AttachFrequencyHint(Ptr<Task> task, uint32_t backendIdx, ClusterState& state)
+{
+    NS_LOG_FUNCTION(this << task->GetTaskId() << backendIdx);
+
+    task->SetTargetFrequency(0);
+    task->SetTargetVoltage(0);
+
+    if (!m_piggybackCommands || !m_scalingPolicy || m_clusterScalingPolicy)
+    {
+        return;
+    }
+
+    // Decide as if the task had already been dispatched to the backend
+    ClusterState::BackendState projected = state.Get(backendIdx);
+    projected.activeTasks++;
+    projected.totalDispatched++;
+    ClusterState::OutstandingTask& entry = projected.outstandingTasks[task->GetTaskId()];
+    entry.computeDemand = task->GetComputeDemand();
+    entry.deadline = task->GetDeadline();
+    projected.outstandingFlops += entry.computeDemand;
+
+    Ptr<ScalingDecision> decision = DecideBackend(projected, backendIdx);
+    if (!decision)
+    {
+        return;
+    }
+
+    task->SetTargetFrequency(decision->targetFrequency);
+    task->SetTargetVoltage(decision->targetVoltage);
+}
+
+void
+DeviceManager::CommitFrequencyHint(Ptr<const Task> task, uint32_t backendIdx, ClusterState& state)
+{
+    NS_LOG_FUNCTION(this << task->GetTaskId() << backendIdx);
+
+    // Tasks of one batch may carry the same hint; only the first changes the clock
+    double frequency = task->GetTargetFrequency();
+    if (frequency <= 0 || frequency == state.Get(backendIdx).commandedFrequency)
+    {
+        return;
+    }
+
+    Ptr<ScalingDecision> decision = Create<ScalingDecision>();
+    decision->targetFrequency = frequency;
+    decision->targetVoltage = task->GetTargetVoltage();
+    CommitDecision(state, backendIdx, decision);
+}
+
+void
+DeviceManager::EvaluateBackend(ClusterState& state, uint32_t backendIdx)
+{
+    NS_LOG_FUNCTION(this << backendIdx);
+
+    Ptr<ScalingDecision> decision = DecideBackend(state.Get(backendIdx), backendIdx);
+    if (decision)
+    {
+        SendDecision(state, backendIdx, decision);
+    }
+}
+
+void
+DeviceManager::EvaluateCluster(ClusterState& state)
+{
+    NS_LOG_FUNCTION(this);
+
+    if (state.TakeDirtyBackends().empty())
     {
-        const ClusterState::BackendState& backend = state.Get(i);
+        return;
+    }
 
-        Ptr<ScalingDecision> decision = m_scalingPolicy->Decide(backend, m_operatingPoints[i]);
+    std::vector<Ptr<ScalingDecision>> decisions =
+        m_clusterScalingPolicy->Decide(state, m_backendProfiles);
 
-        if (!decision)
+    // Lower frequencies first, and raise none while a reduction is outstanding, so the
+    // commanded clocks stay within what the policy budgeted for during reconfiguration
+    Time now = Simulator::Now();
+    bool lowered = true;
+    for (bool raise : {false, true})
+    {
+        if (raise && !lowered)
         {
-            continue;
+            NS_LOG_WARN("Holding back scale-ups until every reduction is sent");
+            break;
         }
-
-        if (decision->targetFrequency == backend.commandedFrequency)
+        for (uint32_t i = 0; i < decisions.size() && i < state.GetN(); i++)
         {
-            continue;
+            Ptr<ScalingDecision> decision = decisions[i];
+            if (!decision || (decision->targetFrequency > state.Get(i).commandedFrequency) != raise)
+            {
+                continue;
+            }
+
+            Time last = m_lastCommandTime[i];
+            if (raise && !last.IsStrictlyNegative() && now - last < m_minCommandInterval)
+            {
+                NS_LOG_DEBUG("Suppressing scale-up of backend " << i << ", last sent at "
+                                                                << last);
+                ScheduleReevaluation(i, last + m_minCommandInterval);
+                continue;
+            }
+            if (!SendDecision(state, i, decision) && !raise)
+            {
+                // Decide again on the next evaluation
+                lowered = false;
+                state.MarkDirty(i);
+            }
         }
+    }
+}
 
-        double oldFreq = backend.commandedFrequency;
+bool
+DeviceManager::SendDecision(ClusterState& state,
+                            uint32_t backendIdx,
+                            Ptr<ScalingDecision> decision)
+{
+    NS_LOG_FUNCTION(this << backendIdx);
+
+    Ptr<Packet> cmdPacket = m_deviceProtocol->CreateCommandPacket(decision);
+    if (!m_backendConnMgr->Send(cmdPacket, m_cluster.Get(backendIdx).address))
+    {
+        NS_LOG_WARN("Failed to send scaling command to backend " << backendIdx);
+        return false;
+    }
 
-        Ptr<Packet> cmdPacket = m_deviceProtocol->CreateCommandPacket(decision);
-        if (!m_backendConnMgr->Send(cmdPacket, m_cluster.Get(i).address))
+    CommitDecision(state, backendIdx, decision);
+    return true;
+}
+
+Ptr<ScalingDecision>
+DeviceManager::DecideBackend(const ClusterState::BackendState& backend, uint32_t backendIdx)
+{
+    NS_LOG_FUNCTION(this << backendIdx);
+
+    Ptr<ScalingDecision> decision = m_scalingPolicy->Decide(backend, m_operatingPoints[backendIdx]);
+
+    if (!decision || decision->targetFrequency == backend.commandedFrequency)
+    {
+        m_scaleDownSince[backendIdx] = Seconds(-1);
+        return nullptr;
+    }
+
+    Time now = Simulator::Now();
+    if (decision->targetFrequency < backend.commandedFrequency)
+    {
+        if (m_scaleDownSince[backendIdx].IsStrictlyNegative())
         {
-            NS_LOG_WARN("Failed to send scaling command to backend " << i);
-            continue;
+            m_scaleDownSince[backendIdx] = now;
         }
+        if (now - m_scaleDownSince[backendIdx] < m_scaleDownDelay)
+        {
+            NS_LOG_DEBUG("Holding scale-down of backend " << backendIdx << " requested since "
+                                                          << m_scaleDownSince[backendIdx]);
+            ScheduleReevaluation(backendIdx, m_scaleDownSince[backendIdx] + m_scaleDownDelay);
+            return nullptr;
+        }
+    }
+    else
+    {
+        m_scaleDownSince[backendIdx] = Seconds(-1);
+    }
+
+    Time last = m_lastCommandTime[backendIdx];
+    if (!last.IsStrictlyNegative() && now - last < m_minCommandInterval)
+    {
+        NS_LOG_DEBUG("Suppressing scaling command to backend " << backendIdx << ", last sent at "
+                                                               << last);
+        ScheduleReevaluation(backendIdx, last + m_minCommandInterval);
+        return nullptr;
+    }
+
+    return decision;
+}
+
+void
+DeviceManager::CommitDecision(ClusterState& state,
+                              uint32_t backendIdx,
+                              Ptr<ScalingDecision> decision)
+{
+    double oldFreq = state.Get(backendIdx).commandedFrequency;
+
+    NS_LOG_INFO("Scaling backend " << backendIdx << ": freq " << oldFreq << " -> "
+                                   << decision->targetFrequency);
+
+    m_frequencyChangedTrace(backendIdx, oldFreq, decision->targetFrequency);
+    state.SetCommandedFrequency(backendIdx, decision->targetFrequency);
+    m_lastCommandTime[backendIdx] = Simulator::Now();
+    m_scaleDownSince[backendIdx] = Seconds(-1);
+}
 
-        NS_LOG_INFO("Scaling backend " << i << ": freq " << oldFreq << " -> "
-                                       << decision->targetFrequency);
+void
+DeviceManager::ScheduleReevaluation(uint32_t backendIdx, Time at)
+{
+    NS_LOG_FUNCTION(this << backendIdx << at);
 
-        m_frequencyChangedTrace(i, oldFreq, decision->targetFrequency);
-        state.SetCommandedFrequency(i, decision->targetFrequency);
+    Time delay = at - Simulator::Now();
+    EventId& event = m_reevaluateEvents[backendIdx];
+    if (event.IsPending())
+    {
+        if (Simulator::GetDelayLeft(event) <= delay)
+        {
+            return;
+        }
+        event.Cancel();
     }
+    event = Simulator::Schedule(delay, &DeviceManager::Reevaluate, this, backendIdx);
+}
+
+void
+DeviceManager::Reevaluate(uint32_t backendIdx)
+{
+    NS_LOG_FUNCTION(this << backendIdx);
+    m_clusterState->MarkDirty(backendIdx);
+    EvaluateScaling(*m_clusterState);
 }
 
 void
@@ -167,9 +422,19 @@ DeviceManager::DoDispose()
 {
     NS_LOG_FUNCTION(this);
     m_scalingPolicy = nullptr;
+    m_clusterScalingPolicy = nullptr;
     m_deviceProtocol = nullptr;
     m_backendConnMgr = nullptr;
     m_operatingPoints.clear();
+    m_backendProfiles.clear();
+    m_lastCommandTime.clear();
+    m_scaleDownSince.clear();
+    for (auto& event : m_reevaluateEvents)
+    {
+        event.Cancel();
+    }
+    m_reevaluateEvents.clear();
+    m_clusterState = nullptr;
     m_cluster.Clear();
     Object::DoDispose();
 }
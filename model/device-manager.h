@@ -10,12 +10,16 @@
 #define DEVICE_MANAGER_H
 
 #include "accelerator.h"
+#include "cluster-scaling-policy.h"
 #include "cluster-state.h"
 #include "cluster.h"
 #include "connection-manager.h"
 #include "device-protocol.h"
 #include "scaling-policy.h"
+#include "task.h"
 
+#include "ns3/event-id.h"
+#include "ns3/nstime.h"
 #include "ns3/object.h"
 #include "ns3/ptr.h"
 #include "ns3/traced-callback.h"
@@ -37,6 +41,29 @@ namespace ns3
  * Metrics arrive via HandleMetrics() (called by EdgeOrchestrator when a type-4
  * packet arrives). Scaling is evaluated via EvaluateScaling() (called by
  * EdgeOrchestrator on task events).
+ *
+ * Only backends whose ClusterState changed since the previous evaluation are
+ * passed to the policy, so the cost of an evaluation is independent of the
+ * cluster size. Commands to each backend are rate-limited by
+ * MinCommandInterval so that a policy reacting to every dispatch and
+ * completion cannot thrash the device through repeated DVFS transitions, and
+ * ScaleDownDelay adds hysteresis by only lowering the frequency once the
+ * policy has asked for it continuously for that long. Decisions held back by
+ * either are re-evaluated when they become eligible.
+ *
+ * With PiggybackCommands enabled, the decision for a dispatch target is made
+ * as the task is dispatched and carried on the task message as a frequency
+ * hint (see AttachFrequencyHint()), so it needs no separate command and
+ * cannot race the task on the backend stream. Decisions made at other times,
+ * such as scaling down after completions, are still sent as commands.
+ *
+ * A ClusterScalingPolicy, when configured, replaces the per-backend policy
+ * and decides every backend at once whenever any of them changed. So that
+ * the commanded clocks stay within cluster-wide constraints such as a power
+ * cap during reconfiguration, frequency reductions are sent first and are
+ * exempt from ScaleDownDelay and MinCommandInterval, and increases are held
+ * back until every reduction has been sent; increases remain rate-limited.
+ * Piggybacked frequency hints are not used with a cluster policy.
  */
 class DeviceManager : public Object
 {
@@ -57,7 +84,8 @@ class DeviceManager : public Object
      *
      * @param cluster The backend cluster.
      * @param backendCm The backend connection manager for sending commands.
-     * @param state The cluster state to initialize commanded frequencies.
+     * @param state The cluster state to initialize commanded frequencies. It must
+     *              outlive the DeviceManager, as deferred evaluations use it.
      */
     void Start(const Cluster& cluster, Ptr<ConnectionManager> backendCm, ClusterState& state);
 
@@ -75,7 +103,8 @@ class DeviceManager : public Object
     /**
      * @brief Try to consume a device metrics message from a receive buffer.
      *
-     * Peeks at the first byte of the buffer. If it is a metrics message and
+     * Peeks at the first byte of the buffer. If it is a metrics report or a
+     * metrics trailer following a task response, and
      * enough data is available, the message is consumed (removed from the
      * buffer), parsed, and stored in ClusterState.
      *
@@ -87,16 +116,47 @@ class DeviceManager : public Object
     bool TryConsumeMetrics(Ptr<Packet> buffer, const Address& from, ClusterState& state);
 
     /**
-     * @brief Evaluate scaling decisions for all backends.
+     * @brief Evaluate scaling decisions for the backends that changed.
      *
-     * Called by EdgeOrchestrator on task events. For each backend,
-     * runs ScalingPolicy::Decide() and sends command packets
-     * if frequency or voltage changed.
+     * Called by EdgeOrchestrator on task events. For each backend marked
+     * dirty in the cluster state, runs ScalingPolicy::Decide() and sends
+     * command packets if frequency or voltage changed.
      *
      * @param state The cluster state with per-backend load and metrics.
      */
     void EvaluateScaling(ClusterState& state);
 
+    /**
+     * @brief Attach a scaling decision for a dispatch target to the task.
+     *
+     * Called by EdgeOrchestrator just before a task is serialized for
+     * dispatch. The policy is evaluated for the backend as if the task had
+     * already been dispatched; any resulting decision is stored on the task
+     * as a frequency hint, but is not recorded as commanded until
+     * CommitFrequencyHint() confirms that the task was sent. Clears any
+     * earlier hint, and attaches none unless PiggybackCommands is enabled
+     * and no ClusterScalingPolicy is set.
+     *
+     * @param task The task about to be dispatched.
+     * @param backendIdx The target backend index.
+     * @param state The cluster state (task not yet recorded as dispatched).
+     */
+    void AttachFrequencyHint(Ptr<Task> task, uint32_t backendIdx, ClusterState& state);
+
+    /**
+     * @brief Record the frequency hint of a task that was sent as commanded.
+     *
+     * Called by EdgeOrchestrator once the task message carrying the hint
+     * attached by AttachFrequencyHint() has been sent. A task sent without
+     * a hint, or with one the backend is already commanded to, changes
+     * nothing.
+     *
+     * @param task The task that was sent.
+     * @param backendIdx The backend it was sent to.
+     * @param state The cluster state.
+     */
+    void CommitFrequencyHint(Ptr<const Task> task, uint32_t backendIdx, ClusterState& state);
+
     /**
      * @brief TracedCallback signature for frequency change events.
      * @param backendIdx The backend index.
@@ -111,13 +171,78 @@ class DeviceManager : public Object
     void DoDispose() override;
 
   private:
-    Ptr<ScalingPolicy> m_scalingPolicy;   //!< Pluggable scaling strategy
-    Ptr<DeviceProtocol> m_deviceProtocol; //!< Protocol for metrics/command serialization
+    /**
+     * @brief Run the scaling policy for one backend and send any command.
+     * @param state The cluster state.
+     * @param backendIdx The backend index.
+     */
+    void EvaluateBackend(ClusterState& state, uint32_t backendIdx);
+
+    /**
+     * @brief Run the cluster scaling policy and send the resulting commands.
+     *
+     * Increases are only sent once every reduction has been sent.
+     *
+     * @param state The cluster state.
+     */
+    void EvaluateCluster(ClusterState& state);
+
+    /**
+     * @brief Send a scaling command to a backend and record it.
+     * @param state The cluster state.
+     * @param backendIdx The backend index.
+     * @param decision The decision to send.
+     * @return false if the command could not be sent.
+     */
+    bool SendDecision(ClusterState& state, uint32_t backendIdx, Ptr<ScalingDecision> decision);
+
+    /**
+     * @brief Run the scaling policy and apply hysteresis and rate limiting.
+     * @param backend The backend state to decide on.
+     * @param backendIdx The backend index.
+     * @return The decision to apply now, or nullptr if none.
+     */
+    Ptr<ScalingDecision> DecideBackend(const ClusterState::BackendState& backend,
+                                       uint32_t backendIdx);
+
+    /**
+     * @brief Record a decision that has been delivered to a backend.
+     * @param state The cluster state.
+     * @param backendIdx The backend index.
+     * @param decision The delivered decision.
+     */
+    void CommitDecision(ClusterState& state, uint32_t backendIdx, Ptr<ScalingDecision> decision);
+
+    /**
+     * @brief Re-evaluate a backend once a held-back decision becomes eligible.
+     * @param backendIdx The backend index.
+     * @param at Absolute time of the re-evaluation.
+     */
+    void ScheduleReevaluation(uint32_t backendIdx, Time at);
+
+    /**
+     * @brief Mark a backend dirty and evaluate scaling.
+     * @param backendIdx The backend index.
+     */
+    void Reevaluate(uint32_t backendIdx);
+
+    Ptr<ScalingPolicy> m_scalingPolicy;               //!< Pluggable scaling strategy
+    Ptr<ClusterScalingPolicy> m_clusterScalingPolicy; //!< Cluster-wide strategy (optional)
+    Ptr<DeviceProtocol> m_deviceProtocol;             //!< Protocol for metrics/commands
 
     Ptr<ConnectionManager> m_backendConnMgr; //!< Backend connection for sending commands
     Cluster m_cluster;                       //!< Backend cluster reference
     std::vector<std::vector<OperatingPoint>>
-        m_operatingPoints; //!< Per-backend OPP tables extracted at startup
+        m_operatingPoints;                   //!< Per-backend OPP tables extracted at startup
+    std::vector<ClusterScalingPolicy::BackendProfile>
+        m_backendProfiles;                   //!< Per-backend profiles for the cluster policy
+    Time m_minCommandInterval;               //!< Minimum time between commands to one backend
+    Time m_scaleDownDelay;                   //!< Time a lower frequency must be requested for
+    bool m_piggybackCommands;                //!< Carry dispatch-time decisions on tasks
+    std::vector<Time> m_lastCommandTime;     //!< Per-backend time of last command sent
+    std::vector<Time> m_scaleDownSince;      //!< Per-backend start of pending scale-down request
+    std::vector<EventId> m_reevaluateEvents; //!< Per-backend deferred re-evaluation
+    ClusterState* m_clusterState;            //!< Cluster state passed to Start()
 
     TracedCallback<uint32_t, double, double> m_frequencyChangedTrace; //!< Frequency change trace
 };
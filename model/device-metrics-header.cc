@@ -35,7 +35,11 @@ DeviceMetricsHeader::DeviceMetricsHeader()
       m_voltage(0),
       m_busy(false),
       m_queueLength(0),
-      m_currentPower(0)
+      m_currentPower(0),
+      m_deviceIndex(0),
+      m_deviceCount(1),
+      m_temperature(0),
+      m_throttled(false)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -123,6 +127,58 @@ DeviceMetricsHeader::SetCurrentPower(double power)
     m_currentPower = power;
 }
 
+uint16_t
+DeviceMetricsHeader::GetDeviceIndex() const
+{
+    return m_deviceIndex;
+}
+
+void
+DeviceMetricsHeader::SetDeviceIndex(uint16_t deviceIndex)
+{
+    NS_LOG_FUNCTION(this << deviceIndex);
+    m_deviceIndex = deviceIndex;
+}
+
+uint16_t
+DeviceMetricsHeader::GetDeviceCount() const
+{
+    return m_deviceCount;
+}
+
+void
+DeviceMetricsHeader::SetDeviceCount(uint16_t deviceCount)
+{
+    NS_LOG_FUNCTION(this << deviceCount);
+    m_deviceCount = deviceCount;
+}
+
+double
+DeviceMetricsHeader::GetTemperature() const
+{
+    return m_temperature;
+}
+
+void
+DeviceMetricsHeader::SetTemperature(double temperature)
+{
+    NS_LOG_FUNCTION(this << temperature);
+    m_temperature = temperature;
+}
+
+bool
+DeviceMetricsHeader::GetThrottled() const
+{
+    return m_throttled;
+}
+
+void
+DeviceMetricsHeader::SetThrottled(bool throttled)
+{
+    NS_LOG_FUNCTION(this << throttled);
+    m_throttled = throttled;
+}
+
 TypeId
 DeviceMetricsHeader::GetInstanceTypeId() const
 {
@@ -156,6 +212,15 @@ DeviceMetricsHeader::Serialize(Buffer::Iterator start) const
     uint64_t powerBits;
     std::memcpy(&powerBits, &m_currentPower, sizeof(powerBits));
     start.WriteHtonU64(powerBits);
+
+    start.WriteHtonU16(m_deviceIndex);
+    start.WriteHtonU16(m_deviceCount);
+
+    uint64_t tempBits;
+    std::memcpy(&tempBits, &m_temperature, sizeof(tempBits));
+    start.WriteHtonU64(tempBits);
+
+    start.WriteU8(m_throttled ? 1 : 0);
 }
 
 uint32_t
@@ -177,6 +242,14 @@ DeviceMetricsHeader::Deserialize(Buffer::Iterator start)
     uint64_t powerBits = start.ReadNtohU64();
     std::memcpy(&m_currentPower, &powerBits, sizeof(m_currentPower));
 
+    m_deviceIndex = start.ReadNtohU16();
+    m_deviceCount = start.ReadNtohU16();
+
+    uint64_t tempBits = start.ReadNtohU64();
+    std::memcpy(&m_temperature, &tempBits, sizeof(m_temperature));
+
+    m_throttled = (start.ReadU8() != 0);
+
     return SERIALIZED_SIZE;
 }
 
@@ -185,7 +258,9 @@ DeviceMetricsHeader::Print(std::ostream& os) const
 {
     os << "DeviceMetricsHeader(type=" << static_cast<int>(m_messageType) << ", freq=" << m_frequency
        << ", volt=" << m_voltage << ", busy=" << (m_busy ? "true" : "false")
-       << ", qLen=" << m_queueLength << ", power=" << m_currentPower << ")";
+       << ", qLen=" << m_queueLength << ", power=" << m_currentPower
+       << ", device=" << m_deviceIndex << "/" << m_deviceCount << ", temp=" << m_temperature
+       << ", throttled=" << (m_throttled ? "true" : "false") << ")";
 }
 
 } // namespace ns3
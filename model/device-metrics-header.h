@@ -22,17 +22,25 @@ namespace ns3
  * @brief Header for device metrics reports sent from backend to orchestrator.
  *
  * DeviceMetricsHeader carries accelerator state (frequency, voltage, busy
- * status, queue length, power) from a backend to the EdgeOrchestrator's
+ * status, queue length, power, temperature, throttling) from a backend to the EdgeOrchestrator's
  * DeviceManager. It is multiplexed on the same connection as task data using
  * message type 6.
  *
- * Wire format (30 bytes):
+ * Backends with an AcceleratorPool report one header per device plus an
+ * aggregate header (deviceIndex == AGGREGATE_DEVICE) summarising the node.
+ * Single-accelerator backends report deviceIndex 0 and deviceCount 1.
+ *
+ * Wire format (43 bytes):
  * - messageType: 1 byte (uint8_t, always DEVICE_METRICS = 6)
  * - frequency: 8 bytes (double as uint64_t via memcpy, network byte order)
  * - voltage: 8 bytes (double as uint64_t via memcpy, network byte order)
  * - busy: 1 byte (uint8_t, 0=idle, 1=busy)
  * - queueLength: 4 bytes (uint32_t, network byte order)
  * - currentPower: 8 bytes (double as uint64_t via memcpy, network byte order)
+ * - deviceIndex: 2 bytes (uint16_t, network byte order)
+ * - deviceCount: 2 bytes (uint16_t, network byte order)
+ * - temperature: 8 bytes (double as uint64_t via memcpy, network byte order)
+ * - throttled: 1 byte (uint8_t, 1 = thermally throttled)
  */
 class DeviceMetricsHeader : public Header
 {
@@ -45,7 +53,12 @@ class DeviceMetricsHeader : public Header
     /**
      * @brief Serialized size of the header in bytes.
      */
-    static constexpr uint32_t SERIALIZED_SIZE = 30;
+    static constexpr uint32_t SERIALIZED_SIZE = 43;
+
+    /**
+     * @brief Device index marking a node-level aggregate report.
+     */
+    static constexpr uint16_t AGGREGATE_DEVICE = 0xFFFF;
 
     /**
      * @brief Get the type ID.
@@ -74,6 +87,18 @@ class DeviceMetricsHeader : public Header
     double GetCurrentPower() const;
     void SetCurrentPower(double power);
 
+    uint16_t GetDeviceIndex() const;
+    void SetDeviceIndex(uint16_t deviceIndex);
+
+    uint16_t GetDeviceCount() const;
+    void SetDeviceCount(uint16_t deviceCount);
+
+    double GetTemperature() const;
+    void SetTemperature(double temperature);
+
+    bool GetThrottled() const;
+    void SetThrottled(bool throttled);
+
     // Header interface
     TypeId GetInstanceTypeId() const override;
     uint32_t GetSerializedSize() const override;
@@ -88,6 +113,10 @@ class DeviceMetricsHeader : public Header
     bool m_busy{false};                    //!< Whether accelerator is busy
     uint32_t m_queueLength{0};             //!< Tasks in queue
     double m_currentPower{0};              //!< Current power in Watts
+    uint16_t m_deviceIndex{0};             //!< Device index or AGGREGATE_DEVICE
+    uint16_t m_deviceCount{1};             //!< Number of devices on the backend
+    double m_temperature{0};               //!< Device temperature in degrees Celsius
+    bool m_throttled{false};               //!< Whether the device is thermally throttled
 };
 
 } // namespace ns3
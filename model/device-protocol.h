@@ -19,6 +19,7 @@ namespace ns3
 {
 
 class Accelerator;
+class AcceleratorPool;
 
 /**
  * @ingroup distributed
@@ -50,12 +51,46 @@ class DeviceProtocol : public Object
      */
     virtual Ptr<Packet> CreateMetricsPacket(Ptr<const Accelerator> accel) = 0;
 
+    /**
+     * @brief Serialize the state of a multi-accelerator backend.
+     *
+     * Called by the server application when the node carries an
+     * AcceleratorPool. Produces either a per-device report or a node-level
+     * aggregate report.
+     *
+     * @param pool The accelerator pool whose state is read.
+     * @param deviceIndex The device to report, or
+     *        DeviceMetricsHeader::AGGREGATE_DEVICE for the pool aggregate.
+     * @return A packet containing the serialized metrics header.
+     */
+    virtual Ptr<Packet> CreatePoolMetricsPacket(Ptr<const AcceleratorPool> pool,
+                                                uint16_t deviceIndex) = 0;
+
+    /**
+     * @brief Serialize compact accelerator state to append to a task response.
+     *
+     * Called by the server application when metrics are piggybacked on
+     * responses instead of being sent as separate reports.
+     *
+     * @param accel The accelerator whose state is read.
+     * @return A packet containing the serialized metrics trailer.
+     */
+    virtual Ptr<Packet> CreateMetricsTrailer(Ptr<const Accelerator> accel) = 0;
+
+    /**
+     * @brief Serialize compact node-level state of a multi-accelerator backend.
+     * @param pool The accelerator pool whose state is read.
+     * @return A packet containing the serialized metrics trailer.
+     */
+    virtual Ptr<Packet> CreatePoolMetricsTrailer(Ptr<const AcceleratorPool> pool) = 0;
+
     /**
      * @brief Parse a metrics packet into a DeviceMetrics object.
      *
-     * Called by the DeviceManager when a type-4 packet arrives.
+     * Called by the DeviceManager when a metrics report or a metrics
+     * trailer arrives.
      *
-     * @param packet The packet containing the metrics header.
+     * @param packet The packet containing the metrics header or trailer.
      * @return The parsed DeviceMetrics.
      */
     virtual Ptr<DeviceMetrics> ParseMetrics(Ptr<Packet> packet) = 0;
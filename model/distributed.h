@@ -60,6 +60,8 @@
 #include "ns3/edge-orchestrator.h"
 #include "ns3/first-fit-scheduler.h"
 #include "ns3/orchestrator-header.h"
+#include "ns3/task-cancel-header.h"
+#include "ns3/task-steal-header.h"
 
 // Device management
 #include "ns3/device-manager.h"
@@ -86,10 +86,13 @@ DvfsEnergyModel::CalculateActivePower(Ptr<Accelerator> accelerator, double utili
         return EnergyModel::PowerState();
     }
 
-    utilization = std::max(0.0, std::min(1.0, utilization));
+    return CalculatePower(accelerator->GetFrequency(), accelerator->GetVoltage(), utilization);
+}
 
-    double voltage = accelerator->GetVoltage();
-    double frequency = accelerator->GetFrequency();
+EnergyModel::PowerState
+DvfsEnergyModel::CalculatePower(double frequency, double voltage, double utilization) const
+{
+    utilization = std::max(0.0, std::min(1.0, utilization));
 
     // Calculate dynamic power: P = C * V^2 * f * utilization
     double dynamicPower = m_effectiveCapacitance * voltage * voltage * frequency * utilization;
@@ -62,6 +62,21 @@ class DvfsEnergyModel : public EnergyModel
                                                  double utilization) override;
     std::string GetName() const override;
 
+    /**
+     * @brief Calculate power at an operating point without an accelerator.
+     *
+     * Lets decision-makers predict the power of a device at an OPP it is
+     * not currently running at.
+     *
+     * @param frequency Operating frequency in Hz.
+     * @param voltage Operating voltage in Volts.
+     * @param utilization Utilization level [0.0, 1.0].
+     * @return PowerState at the operating point.
+     */
+    EnergyModel::PowerState CalculatePower(double frequency,
+                                           double voltage,
+                                           double utilization) const;
+
     /**
      * @brief Get the effective capacitance.
      * @return Effective capacitance in Farads.
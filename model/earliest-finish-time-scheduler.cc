@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#include "earliest-finish-time-scheduler.h"
+
+#include "scaling-policy.h"
+
+#include "ns3/double.h"
+#include "ns3/log.h"
+
+#include <algorithm>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("EarliestFinishTimeScheduler");
+NS_OBJECT_ENSURE_REGISTERED(EarliestFinishTimeScheduler);
+
+TypeId
+EarliestFinishTimeScheduler::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::EarliestFinishTimeScheduler")
+            .SetParent<ClusterScheduler>()
+            .SetGroupName("Distributed")
+            .AddConstructor<EarliestFinishTimeScheduler>()
+            .AddAttribute("ComputeRate",
+                          "Compute rate in FLOPS at ReferenceFrequency, for backends whose "
+                          "rates are not recorded in ClusterState",
+                          DoubleValue(1e12),
+                          MakeDoubleAccessor(&EarliestFinishTimeScheduler::m_computeRate),
+                          MakeDoubleChecker<double>(0.0))
+            .AddAttribute("ReferenceFrequency",
+                          "Frequency in Hz at which ComputeRate applies",
+                          DoubleValue(1.5e9),
+                          MakeDoubleAccessor(&EarliestFinishTimeScheduler::m_referenceFrequency),
+                          MakeDoubleChecker<double>(0.0))
+            .AddAttribute("MemoryBandwidth",
+                          "Memory bandwidth in bytes/s, for backends whose rates are not "
+                          "recorded in ClusterState",
+                          DoubleValue(900e9),
+                          MakeDoubleAccessor(&EarliestFinishTimeScheduler::m_memoryBandwidth),
+                          MakeDoubleChecker<double>(0.0));
+    return tid;
+}
+
+EarliestFinishTimeScheduler::EarliestFinishTimeScheduler()
+    : m_computeRate(1e12),
+      m_referenceFrequency(1.5e9),
+      m_memoryBandwidth(900e9)
+{
+    NS_LOG_FUNCTION(this);
+    m_tiebreaker = CreateObject<UniformRandomVariable>();
+}
+
+EarliestFinishTimeScheduler::~EarliestFinishTimeScheduler()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+EarliestFinishTimeScheduler::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    m_tiebreaker = nullptr;
+    ClusterScheduler::DoDispose();
+}
+
+double
+EarliestFinishTimeScheduler::GetComputeRate(const ClusterState::BackendState& backend) const
+{
+    bool known = backend.computeRate > 0 && backend.referenceFrequency > 0;
+    double computeRate = known ? backend.computeRate : m_computeRate;
+    double referenceFrequency = known ? backend.referenceFrequency : m_referenceFrequency;
+    if (referenceFrequency <= 0)
+    {
+        return computeRate;
+    }
+    return computeRate * GetFrequency(backend) / referenceFrequency;
+}
+
+double
+EarliestFinishTimeScheduler::GetFrequency(const ClusterState::BackendState& backend) const
+{
+    bool known = backend.computeRate > 0 && backend.referenceFrequency > 0;
+    double frequency = backend.commandedFrequency > 0
+                           ? backend.commandedFrequency
+                           : (known ? backend.referenceFrequency : m_referenceFrequency);
+    const Ptr<DeviceMetrics>& metrics = backend.deviceMetrics;
+    if (metrics && metrics->throttled && metrics->frequency > 0)
+    {
+        frequency = std::min(frequency, metrics->frequency);
+    }
+    return frequency;
+}
+
+double
+EarliestFinishTimeScheduler::GetMemoryBandwidth(const ClusterState::BackendState& backend) const
+{
+    return backend.memoryBandwidth > 0 ? backend.memoryBandwidth : m_memoryBandwidth;
+}
+
+Time
+EarliestFinishTimeScheduler::EstimateFinishTime(const ClusterState::BackendState& backend,
+                                                Ptr<const Task> task) const
+{
+    // The devices drain the queue together, but the task itself runs on one
+    double devices = static_cast<double>(backend.deviceCount);
+    double rate = GetComputeRate(backend);
+    double bandwidth = GetMemoryBandwidth(backend);
+    double flops = backend.outstandingFlops / devices + task->GetComputeDemand();
+    double bytes = static_cast<double>(backend.outstandingBytes) / devices +
+                   static_cast<double>(task->GetInputSize() + task->GetOutputSize());
+
+    double seconds = (rate > 0 ? flops / rate : 0) + (bandwidth > 0 ? bytes / bandwidth : 0);
+    return Seconds(seconds);
+}
+
+int32_t
+EarliestFinishTimeScheduler::ScheduleTask(Ptr<Task> task,
+                                          const Cluster& cluster,
+                                          const ClusterState& state)
+{
+    NS_LOG_FUNCTION(this << task);
+
+    std::string required = task->GetRequiredAcceleratorType();
+
+    const std::vector<uint32_t>& pool = required.empty()
+                                            ? cluster.GetAvailableBackends()
+                                            : cluster.GetAvailableBackendsByType(required);
+
+    if (pool.empty())
+    {
+        NS_LOG_DEBUG("EarliestFinishTime: no suitable backends");
+        return -1;
+    }
+
+    // Reservoir tie-break: the k-th tied backend replaces the choice with probability 1/k
+    int32_t bestIdx = -1;
+    Time bestFinish = Time::Max();
+    uint32_t ties = 0;
+    for (uint32_t idx : pool)
+    {
+        Time finish = EstimateFinishTime(state.Get(idx), task);
+        if (bestIdx < 0 || finish < bestFinish)
+        {
+            bestFinish = finish;
+            bestIdx = static_cast<int32_t>(idx);
+            ties = 1;
+        }
+        else if (finish == bestFinish && m_tiebreaker->GetInteger(0, ties++) == 0)
+        {
+            bestIdx = static_cast<int32_t>(idx);
+        }
+    }
+
+    NS_LOG_DEBUG("EarliestFinishTime: scheduled task " << task->GetTaskId() << " to backend "
+                                                       << bestIdx << " (finish in " << bestFinish
+                                                       << ", tied=" << ties << ")");
+    return bestIdx;
+}
+
+std::string
+EarliestFinishTimeScheduler::GetName() const
+{
+    return "EarliestFinishTime";
+}
+
+} // namespace ns3
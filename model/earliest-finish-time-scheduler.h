@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#ifndef EARLIEST_FINISH_TIME_SCHEDULER_H
+#define EARLIEST_FINISH_TIME_SCHEDULER_H
+
+#include "cluster-scheduler.h"
+#include "cluster-state.h"
+
+#include "ns3/nstime.h"
+#include "ns3/random-variable-stream.h"
+
+#include <string>
+
+namespace ns3
+{
+
+/**
+ * @ingroup distributed
+ * @brief Scheduler that selects the backend expected to finish the task first.
+ *
+ * Active task counts treat a 100 GFLOP task the same as a 1 GFLOP one.
+ * EarliestFinishTimeScheduler instead estimates, for each available backend
+ * matching the task's accelerator type, when the task would finish if
+ * queued behind the backend's outstanding work:
+ *
+ * T = (outstandingFlops / N + demand) / R(f) + (outstandingBytes / N + bytes) / B
+ *
+ * where R(f) = computeRate * f / referenceFrequency is the compute rate of
+ * one device at the backend's current clock, B its memory bandwidth and N
+ * the backend's device count: the devices drain the queue together, while
+ * the task runs on one. The clock is the frequency last commanded by the
+ * DeviceManager, lowered to the reported frequency if the device is
+ * thermally throttled, or referenceFrequency if neither is known. Backends
+ * whose rates were not recorded in ClusterState (see
+ * ClusterState::SetDeviceRates) use this scheduler's attributes.
+ *
+ * Ties are broken by uniform random selection.
+ */
+class EarliestFinishTimeScheduler : public ClusterScheduler
+{
+  public:
+    /**
+     * @brief Get the type ID.
+     * @return The object TypeId.
+     */
+    static TypeId GetTypeId();
+
+    EarliestFinishTimeScheduler();
+    ~EarliestFinishTimeScheduler() override;
+
+    /**
+     * @brief Select the backend with the earliest estimated finish time.
+     *
+     * @param task The task to schedule.
+     * @param cluster The cluster of backends.
+     * @param state Per-backend load state.
+     * @return Backend index, or -1 if no suitable backend.
+     */
+    int32_t ScheduleTask(Ptr<Task> task,
+                         const Cluster& cluster,
+                         const ClusterState& state) override;
+
+    /**
+     * @brief Get the scheduler name.
+     * @return "EarliestFinishTime"
+     */
+    std::string GetName() const override;
+
+    /**
+     * @brief Estimate how long a backend would take to finish a task.
+     * @param backend The backend's state.
+     * @param task The task to place.
+     * @return Time from now until the task would finish.
+     */
+    Time EstimateFinishTime(const ClusterState::BackendState& backend,
+                            Ptr<const Task> task) const;
+
+  protected:
+    void DoDispose() override;
+
+    /**
+     * @brief Get a backend's compute rate at its current clock.
+     * @param backend The backend's state.
+     * @return Compute rate in FLOPS.
+     */
+    double GetComputeRate(const ClusterState::BackendState& backend) const;
+
+    /**
+     * @brief Get a backend's current clock.
+     * @param backend The backend's state.
+     * @return The commanded (or throttled) frequency in Hz.
+     */
+    double GetFrequency(const ClusterState::BackendState& backend) const;
+
+    /**
+     * @brief Get a backend's memory bandwidth.
+     * @param backend The backend's state.
+     * @return Memory bandwidth in bytes/s.
+     */
+    double GetMemoryBandwidth(const ClusterState::BackendState& backend) const;
+
+    Ptr<UniformRandomVariable> m_tiebreaker; //!< RNG for breaking ties
+
+  private:
+    double m_computeRate;        //!< Default compute rate in FLOPS
+    double m_referenceFrequency; //!< Frequency at which m_computeRate applies, in Hz
+    double m_memoryBandwidth;    //!< Default memory bandwidth in bytes/s
+};
+
+} // namespace ns3
+
+#endif // EARLIEST_FINISH_TIME_SCHEDULER_H
@@ -8,14 +8,27 @@
 
 #include "edge-orchestrator.h"
 
+#include "accelerator-pool.h"
+#include "accelerator.h"
+#include "backend-autoscaler.h"
 #include "device-manager.h"
+#include "gpu-accelerator.h"
 #include "simple-task.h"
+#include "task-cancel-header.h"
+#include "task-steal-header.h"
 #include "tcp-connection-manager.h"
 
+#include "ns3/double.h"
 #include "ns3/log.h"
+#include "ns3/node.h"
 #include "ns3/pointer.h"
+#include "ns3/simulator.h"
 #include "ns3/uinteger.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 namespace ns3
 {
 
@@ -61,6 +74,74 @@ EdgeOrchestrator::GetTypeId()
                           PointerValue(),
                           MakePointerAccessor(&EdgeOrchestrator::m_deviceManager),
                           MakePointerChecker<DeviceManager>())
+            .AddAttribute("Autoscaler",
+                          "Autoscaler powering backends off and on with load (optional)",
+                          PointerValue(),
+                          MakePointerAccessor(&EdgeOrchestrator::m_autoscaler),
+                          MakePointerChecker<BackendAutoscaler>())
+            .AddAttribute("AdmissionWindow",
+                          "Time to hold admission requests for joint evaluation "
+                          "(0 = decide each request on arrival)",
+                          TimeValue(Seconds(0)),
+                          MakeTimeAccessor(&EdgeOrchestrator::m_admissionWindow),
+                          MakeTimeChecker(Seconds(0)))
+            .AddAttribute("MaxInFlightPerBackend",
+                          "Tasks a backend may hold before ready tasks wait in the fair "
+                          "dispatch stage (0 = dispatch every ready task at once)",
+                          UintegerValue(0),
+                          MakeUintegerAccessor(&EdgeOrchestrator::m_maxInFlight),
+                          MakeUintegerChecker<uint32_t>())
+            .AddAttribute("BatchWindow",
+                          "Time a batch of like tasks stays open for more tasks to join "
+                          "(0 = send each task on its own)",
+                          TimeValue(Seconds(0)),
+                          MakeTimeAccessor(&EdgeOrchestrator::m_batchWindow),
+                          MakeTimeChecker(Seconds(0)))
+            .AddAttribute("MaxBatchSize",
+                          "Number of tasks at which a batch is sent without waiting",
+                          UintegerValue(8),
+                          MakeUintegerAccessor(&EdgeOrchestrator::m_maxBatchSize),
+                          MakeUintegerChecker<uint32_t>(1))
+            .AddAttribute("HedgePercentile",
+                          "Percentile of recent response times after which an unanswered task "
+                          "is sent to a second backend (0 = no hedging)",
+                          DoubleValue(0.0),
+                          MakeDoubleAccessor(&EdgeOrchestrator::m_hedgePercentile),
+                          MakeDoubleChecker<double>(0.0, 1.0))
+            .AddAttribute("HedgeHistory",
+                          "Number of recent response times per task type the percentile "
+                          "is taken over",
+                          UintegerValue(100),
+                          MakeUintegerAccessor(&EdgeOrchestrator::m_hedgeHistory),
+                          MakeUintegerChecker<uint32_t>(1))
+            .AddAttribute("HedgeBudget",
+                          "Hedges allowed as a fraction of the tasks dispatched",
+                          DoubleValue(0.05),
+                          MakeDoubleAccessor(&EdgeOrchestrator::m_hedgeBudget),
+                          MakeDoubleChecker<double>(0.0))
+            .AddAttribute("StealThreshold",
+                          "Tasks in flight at which a backend gives up queued work to an idle "
+                          "backend of the same type (0 = no work stealing)",
+                          UintegerValue(0),
+                          MakeUintegerAccessor(&EdgeOrchestrator::m_stealThreshold),
+                          MakeUintegerChecker<uint32_t>())
+            .AddAttribute("QuarantineAfter",
+                          "Outlier responses in a row after which a backend is quarantined "
+                          "(0 = never quarantine)",
+                          UintegerValue(0),
+                          MakeUintegerAccessor(&EdgeOrchestrator::m_quarantineAfter),
+                          MakeUintegerChecker<uint32_t>())
+            .AddAttribute("OutlierFactor",
+                          "Slowdown over a backend's healthy service cost at which a response "
+                          "is an outlier",
+                          DoubleValue(3.0),
+                          MakeDoubleAccessor(&EdgeOrchestrator::m_outlierFactor),
+                          MakeDoubleChecker<double>(1.0))
+            .AddAttribute("ProbeInterval",
+                          "Time between probes of a quarantined backend",
+                          TimeValue(Seconds(1)),
+                          MakeTimeAccessor(&EdgeOrchestrator::m_probeInterval),
+                          MakeTimeChecker(Seconds(0)))
             .AddTraceSource("WorkloadAdmitted",
                             "A workload has been admitted for execution",
                             MakeTraceSourceAccessor(&EdgeOrchestrator::m_workloadAdmittedTrace),
@@ -69,6 +150,10 @@ EdgeOrchestrator::GetTypeId()
                             "A workload has been rejected",
                             MakeTraceSourceAccessor(&EdgeOrchestrator::m_workloadRejectedTrace),
                             "ns3::EdgeOrchestrator::WorkloadRejectedTracedCallback")
+            .AddTraceSource("WorkloadDegraded",
+                            "A workload has been admitted as a cheaper variant",
+                            MakeTraceSourceAccessor(&EdgeOrchestrator::m_workloadDegradedTrace),
+                            "ns3::EdgeOrchestrator::WorkloadDegradedTracedCallback")
             .AddTraceSource("WorkloadCancelled",
                             "A workload has been cancelled",
                             MakeTraceSourceAccessor(&EdgeOrchestrator::m_workloadCancelledTrace),
@@ -77,6 +162,22 @@ EdgeOrchestrator::GetTypeId()
                             "A task has been dispatched to a backend",
                             MakeTraceSourceAccessor(&EdgeOrchestrator::m_taskDispatchedTrace),
                             "ns3::EdgeOrchestrator::TaskDispatchedTracedCallback")
+            .AddTraceSource("BatchDispatched",
+                            "A batch of tasks has been sent to a backend in one message",
+                            MakeTraceSourceAccessor(&EdgeOrchestrator::m_batchDispatchedTrace),
+                            "ns3::EdgeOrchestrator::BatchDispatchedTracedCallback")
+            .AddTraceSource("TaskHedged",
+                            "A copy of a slow task has been sent to another backend",
+                            MakeTraceSourceAccessor(&EdgeOrchestrator::m_taskHedgedTrace),
+                            "ns3::EdgeOrchestrator::TaskHedgedTracedCallback")
+            .AddTraceSource("TaskStolen",
+                            "A queued task has been moved from a busy backend to an idle one",
+                            MakeTraceSourceAccessor(&EdgeOrchestrator::m_taskStolenTrace),
+                            "ns3::EdgeOrchestrator::TaskStolenTracedCallback")
+            .AddTraceSource("BackendQuarantined",
+                            "A slow backend has been quarantined or returned to service",
+                            MakeTraceSourceAccessor(&EdgeOrchestrator::m_backendQuarantinedTrace),
+                            "ns3::EdgeOrchestrator::BackendQuarantinedTracedCallback")
             .AddTraceSource("TaskCompleted",
                             "A task has been completed by a backend",
                             MakeTraceSourceAccessor(&EdgeOrchestrator::m_taskCompletedTrace),
@@ -92,9 +193,21 @@ EdgeOrchestrator::EdgeOrchestrator()
     : m_admissionPolicy(nullptr),
       m_scheduler(nullptr),
       m_deviceManager(nullptr),
+      m_autoscaler(nullptr),
       m_port(8080),
       m_clientConnMgr(nullptr),
-      m_backendConnMgr(nullptr)
+      m_backendConnMgr(nullptr),
+      m_admissionWindow(Seconds(0)),
+      m_maxInFlight(0),
+      m_batchWindow(Seconds(0)),
+      m_maxBatchSize(8),
+      m_hedgePercentile(0.0),
+      m_hedgeHistory(100),
+      m_hedgeBudget(0.05),
+      m_stealThreshold(0),
+      m_quarantineAfter(0),
+      m_outlierFactor(3.0),
+      m_probeInterval(Seconds(1))
 {
     NS_LOG_FUNCTION(this);
 }
@@ -133,9 +246,27 @@ EdgeOrchestrator::CancelWorkload(uint64_t workloadId)
     WorkloadState state = std::move(it->second);
     m_workloads.erase(it);
 
+    if (!state.queuedTasks.empty())
+    {
+        DequeueWorkload(workloadId, state.clientAddr);
+    }
+
     for (const auto& tb : state.taskToBackend)
     {
-        m_clusterState.NotifyTaskCompleted(tb.second);
+        auto dispIt = m_dispatchedTasks.find(tb.first);
+        if (dispIt == m_dispatchedTasks.end())
+        {
+            m_clusterState.NotifyTaskCompleted(tb.second, tb.first);
+            continue;
+        }
+        // Responses still on their way are dropped on arrival
+        dispIt->second.hedgeEvent.Cancel();
+        CancelReplicas(tb.first, dispIt->second, false);
+    }
+
+    for (uint32_t i = 0; i < state.dag->GetTaskCount(); i++)
+    {
+        m_scheduler->NotifyTaskCancelled(state.dag->GetTask(i));
     }
 
     m_workloadsCancelled++;
@@ -177,7 +308,39 @@ void
 EdgeOrchestrator::CancelAllPendingAdmissions()
 {
     NS_LOG_FUNCTION(this);
+    for (const auto& [clientAddr, pending] : m_pendingAdmissions)
+    {
+        for (const auto& [dagId, reservationId] : pending)
+        {
+            m_clusterState.Release(reservationId);
+        }
+    }
     m_pendingAdmissions.clear();
+    m_admissionWindowEvent.Cancel();
+    m_admissionQueue.clear();
+}
+
+bool
+EdgeOrchestrator::ErasePendingAdmission(const Address& clientAddr, uint64_t dagId)
+{
+    auto mapIt = m_pendingAdmissions.find(clientAddr);
+    if (mapIt == m_pendingAdmissions.end())
+    {
+        return false;
+    }
+    auto it = mapIt->second.find(dagId);
+    if (it == mapIt->second.end())
+    {
+        return false;
+    }
+
+    m_clusterState.Release(it->second);
+    mapIt->second.erase(it);
+    if (mapIt->second.empty())
+    {
+        m_pendingAdmissions.erase(mapIt);
+    }
+    return true;
 }
 
 std::map<Address, Ptr<Packet>>::iterator
@@ -209,11 +372,35 @@ EdgeOrchestrator::DoDispose()
     m_backendRxBuffer.clear();
 
     m_workloads.clear();
+    m_dispatchQueues.clear();
+    m_clientWeights.clear();
+    m_queuedTasks = 0;
+    for (auto& [key, batch] : m_batches)
+    {
+        batch.flushEvent.Cancel();
+    }
+    m_batches.clear();
+    m_batchedTasks = 0;
     m_admissionPolicy = nullptr;
     m_scheduler = nullptr;
     m_deviceManager = nullptr;
+    m_autoscaler = nullptr;
     m_taskTypeRegistry.clear();
+    for (auto& [taskId, info] : m_dispatchedTasks)
+    {
+        info.hedgeEvent.Cancel();
+    }
     m_dispatchedTasks.clear();
+    m_responseTimes.clear();
+    m_steals.clear();
+    m_stealRefused.clear();
+    for (auto& [backendIdx, event] : m_probeEvents)
+    {
+        event.Cancel();
+    }
+    m_probeEvents.clear();
+    m_probing.clear();
+    m_probeTasks.clear();
     m_cluster.Clear();
     m_clusterState.Clear();
 
@@ -323,6 +510,38 @@ EdgeOrchestrator::GetWorkloadsCancelled() const
     return m_workloadsCancelled;
 }
 
+uint32_t
+EdgeOrchestrator::GetQueuedTaskCount() const
+{
+    return m_queuedTasks + m_batchedTasks;
+}
+
+uint64_t
+EdgeOrchestrator::GetTasksHedged() const
+{
+    return m_tasksHedged;
+}
+
+uint64_t
+EdgeOrchestrator::GetTasksStolen() const
+{
+    return m_tasksStolen;
+}
+
+uint64_t
+EdgeOrchestrator::GetQuarantines() const
+{
+    return m_quarantines;
+}
+
+void
+EdgeOrchestrator::SetClientWeight(const Address& clientAddr, double weight)
+{
+    NS_LOG_FUNCTION(this << clientAddr << weight);
+    NS_ASSERT_MSG(weight > 0, "Client weight must be positive");
+    m_clientWeights[clientAddr] = weight;
+}
+
 Ptr<ClusterScheduler>
 EdgeOrchestrator::GetScheduler() const
 {
@@ -382,16 +601,77 @@ EdgeOrchestrator::StartApplication()
     }
 
     m_clusterState.Resize(m_cluster.GetN());
+    m_clusterState.SetOutlierFactor(m_outlierFactor);
 
     for (uint32_t i = 0; i < m_cluster.GetN(); i++)
     {
         m_backendConnMgr->Connect(m_cluster.Get(i).address);
+
+        // A multi-device backend aggregates an AcceleratorPool instead of one Accelerator
+        std::vector<Ptr<Accelerator>> devices;
+        Ptr<Node> node = m_cluster.Get(i).node;
+        Ptr<Accelerator> accel = node ? node->GetObject<Accelerator>() : nullptr;
+        Ptr<AcceleratorPool> pool = node ? node->GetObject<AcceleratorPool>() : nullptr;
+        if (accel)
+        {
+            devices.push_back(accel);
+        }
+        for (uint32_t j = 0; !accel && pool && j < pool->GetN(); j++)
+        {
+            devices.push_back(pool->Get(j));
+        }
+        if (devices.empty())
+        {
+            continue;
+        }
+
+        // Each device caches its own models, so a model must fit the smallest device
+        uint64_t capacity = devices[0]->GetMemoryCapacity();
+        for (Ptr<Accelerator> device : devices)
+        {
+            capacity = std::min(capacity, device->GetMemoryCapacity());
+        }
+        m_clusterState.SetModelCacheCapacity(i, capacity);
+
+        // The compute rate scales with the clock, so record the frequency it applies at;
+        // a task runs on one device of a pool, so record the mean device and the count
+        double computeRate = 0;
+        double frequency = 0;
+        double memoryBandwidth = 0;
+        uint32_t gpus = 0;
+        for (Ptr<Accelerator> device : devices)
+        {
+            Ptr<GpuAccelerator> gpu = DynamicCast<GpuAccelerator>(device);
+            if (gpu)
+            {
+                computeRate += gpu->GetComputeRate();
+                frequency += gpu->GetFrequency();
+                memoryBandwidth += gpu->GetMemoryBandwidth();
+                gpus++;
+            }
+        }
+        if (gpus > 0)
+        {
+            m_clusterState.SetDeviceRates(i,
+                                          computeRate / gpus,
+                                          frequency / gpus,
+                                          memoryBandwidth / gpus,
+                                          gpus);
+        }
     }
 
     if (m_deviceManager)
     {
         m_deviceManager->Start(m_cluster, m_backendConnMgr, m_clusterState);
     }
+
+    if (m_autoscaler)
+    {
+        m_autoscaler->TraceConnectWithoutContext(
+            "BackendAvailable",
+            MakeCallback(&EdgeOrchestrator::HandleBackendAvailable, this));
+        m_autoscaler->Start(m_cluster, m_clusterState);
+    }
 }
 
 void
@@ -401,6 +681,14 @@ EdgeOrchestrator::StopApplication()
 
     CancelAllPendingAdmissions();
 
+    if (m_autoscaler)
+    {
+        m_autoscaler->Stop();
+        m_autoscaler->TraceDisconnectWithoutContext(
+            "BackendAvailable",
+            MakeCallback(&EdgeOrchestrator::HandleBackendAvailable, this));
+    }
+
     std::vector<uint64_t> activeIds;
     activeIds.reserve(m_workloads.size());
     for (const auto& pair : m_workloads)
@@ -456,14 +744,84 @@ EdgeOrchestrator::HandleBackendClose(const Address& backendAddr)
         return;
     }
 
-    std::vector<uint64_t> affectedWorkloads;
+    for (auto it = m_steals.begin(); it != m_steals.end();)
+    {
+        if (it->first == static_cast<uint32_t>(backendIdx) ||
+            it->second == static_cast<uint32_t>(backendIdx))
+        {
+            it = m_steals.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    m_stealRefused.erase(backendIdx);
+    auto probeIt = m_probeEvents.find(backendIdx);
+    if (probeIt != m_probeEvents.end())
+    {
+        probeIt->second.Cancel();
+        m_probeEvents.erase(probeIt);
+    }
+    m_probing.erase(backendIdx);
+    m_probeTasks.erase(backendIdx);
+
+    // Every copy on the closed backend is lost; a task survives on its other live copies
+    uint32_t closedIdx = static_cast<uint32_t>(backendIdx);
+    std::set<uint64_t> affectedWorkloads;
+    for (auto it = m_dispatchedTasks.begin(); it != m_dispatchedTasks.end();)
+    {
+        uint64_t taskId = it->first;
+        DispatchedTaskInfo& info = it->second;
+        bool lostLive = false;
+        for (auto replicaIt = info.replicas.begin(); replicaIt != info.replicas.end();)
+        {
+            if (replicaIt->backendIdx != closedIdx)
+            {
+                ++replicaIt;
+                continue;
+            }
+            lostLive = lostLive || !replicaIt->cancelled;
+            m_clusterState.NotifyTaskCompleted(closedIdx, taskId);
+            replicaIt = info.replicas.erase(replicaIt);
+        }
+
+        auto live = std::find_if(info.replicas.begin(),
+                                 info.replicas.end(),
+                                 [](const Replica& replica) { return !replica.cancelled; });
+        auto wit = m_workloads.find(info.workloadId);
+        if (lostLive && wit != m_workloads.end())
+        {
+            auto tbIt = wit->second.taskToBackend.find(taskId);
+            if (live != info.replicas.end())
+            {
+                if (tbIt != wit->second.taskToBackend.end())
+                {
+                    tbIt->second = live->backendIdx;
+                }
+            }
+            else
+            {
+                // Already released above, so cancelling the workload must not release it again
+                info.hedgeEvent.Cancel();
+                if (tbIt != wit->second.taskToBackend.end())
+                {
+                    wit->second.taskToBackend.erase(tbIt);
+                }
+                affectedWorkloads.insert(info.workloadId);
+            }
+        }
+        it = info.replicas.empty() ? m_dispatchedTasks.erase(it) : std::next(it);
+    }
+
+    // Tasks placed on the backend but not yet sent are lost with it
     for (const auto& pair : m_workloads)
     {
         for (const auto& tb : pair.second.taskToBackend)
         {
-            if (tb.second == static_cast<uint32_t>(backendIdx))
+            if (tb.second == closedIdx && m_dispatchedTasks.count(tb.first) == 0)
             {
-                affectedWorkloads.push_back(pair.first);
+                affectedWorkloads.insert(pair.first);
                 break;
             }
         }
@@ -536,39 +894,78 @@ EdgeOrchestrator::ProcessAdmissionDecision(Ptr<DagTask> dag, uint64_t id, const
 {
     NS_LOG_FUNCTION(this << id << clientAddr);
 
-    if (!CheckAdmission(dag))
+    // A duplicate is refused before the policy sees it, so it takes no tokens or reservation
+    auto& pending = m_pendingAdmissions[clientAddr];
+    if (pending.count(id))
+    {
+        NS_LOG_WARN("Duplicate admission request for id " << id << " from " << clientAddr);
+        RejectWorkload(dag->GetTaskCount(), "duplicate_admission");
+        SendAdmissionResponse(clientAddr, id, false, 0);
+        return false;
+    }
+
+    // Per-client limits are applied once, whatever variant is admitted
+    bool admitted = !m_admissionPolicy || m_admissionPolicy->CheckClient(clientAddr, dag);
+
+    // Degrade rather than reject: try each cheaper variant until one fits.
+    // The variant travels in the admitted byte, which bounds it at 254.
+    uint32_t maxVariant = admitted ? std::min<uint32_t>(dag->GetVariantCount(), 254) : 0;
+    uint32_t variant = 0;
+    admitted = admitted && CheckAdmission(dag, clientAddr);
+    while (!admitted && variant < maxVariant)
+    {
+        dag->ApplyVariant(++variant);
+        admitted = CheckAdmission(dag, clientAddr);
+    }
+
+    if (!admitted)
     {
         NS_LOG_INFO("Workload " << id << " rejected by admission policy");
         RejectWorkload(dag->GetTaskCount(), "admission_rejected");
-        SendAdmissionResponse(clientAddr, id, false);
+        SendAdmissionResponse(clientAddr, id, false, 0);
         return false;
     }
 
-    auto& pending = m_pendingAdmissions[clientAddr];
-    if (pending.count(id))
+    if (m_admissionPolicy)
     {
-        NS_LOG_WARN("Duplicate admission request for id " << id << " from " << clientAddr);
-        RejectWorkload(dag->GetTaskCount(), "duplicate_admission");
-        SendAdmissionResponse(clientAddr, id, false);
-        return false;
+        m_admissionPolicy->NotifyAdmitted(clientAddr, dag);
     }
 
-    pending.insert(id);
+    // Hold the capacity until the data arrives, where the policy planned it if it did
+    static const std::vector<int32_t> unplanned;
+    const std::vector<int32_t>& placement =
+        m_admissionPolicy ? m_admissionPolicy->GetPlacement() : unplanned;
+    uint64_t reservationId = m_nextReservationId++;
+    m_clusterState.Reserve(reservationId,
+                           dag,
+                           m_cluster,
+                           placement.size() == dag->GetTaskCount() ? placement : unplanned);
+    pending[id] = reservationId;
+
+    if (variant > 0)
+    {
+        NS_LOG_INFO("Workload " << id << " admitted as variant " << variant);
+        m_workloadDegradedTrace(id, variant);
+    }
 
     NS_LOG_INFO("Workload " << id << " admitted, awaiting data upload");
-    SendAdmissionResponse(clientAddr, id, true);
+    SendAdmissionResponse(clientAddr, id, true, static_cast<uint8_t>(variant));
     return true;
 }
 
 void
-EdgeOrchestrator::SendAdmissionResponse(const Address& clientAddr, uint64_t taskId, bool admitted)
+EdgeOrchestrator::SendAdmissionResponse(const Address& clientAddr,
+                                        uint64_t taskId,
+                                        bool admitted,
+                                        uint8_t variant)
 {
-    NS_LOG_FUNCTION(this << clientAddr << taskId << admitted);
+    NS_LOG_FUNCTION(this << clientAddr << taskId << admitted << static_cast<uint32_t>(variant));
 
     OrchestratorHeader response;
     response.SetMessageType(OrchestratorHeader::ADMISSION_RESPONSE);
     response.SetTaskId(taskId);
     response.SetAdmitted(admitted);
+    response.SetVariant(variant);
     response.SetPayloadSize(0);
 
     Ptr<Packet> packet = Create<Packet>();
@@ -580,15 +977,7 @@ EdgeOrchestrator::SendAdmissionResponse(const Address& clientAddr, uint64_t task
 
         if (admitted)
         {
-            auto mapIt = m_pendingAdmissions.find(clientAddr);
-            if (mapIt != m_pendingAdmissions.end())
-            {
-                mapIt->second.erase(taskId);
-                if (mapIt->second.empty())
-                {
-                    m_pendingAdmissions.erase(mapIt);
-                }
-            }
+            ErasePendingAdmission(clientAddr, taskId);
             RejectWorkload(0, "admission_response_send_failed");
         }
         return;
@@ -599,9 +988,9 @@ EdgeOrchestrator::SendAdmissionResponse(const Address& clientAddr, uint64_t task
 }
 
 bool
-EdgeOrchestrator::CheckAdmission(Ptr<DagTask> dag)
+EdgeOrchestrator::CheckAdmission(Ptr<DagTask> dag, const Address& clientAddr)
 {
-    NS_LOG_FUNCTION(this);
+    NS_LOG_FUNCTION(this << clientAddr);
 
     if (!m_admissionPolicy)
     {
@@ -609,7 +998,7 @@ EdgeOrchestrator::CheckAdmission(Ptr<DagTask> dag)
         return true;
     }
 
-    return m_admissionPolicy->ShouldAdmit(dag, m_cluster, m_clusterState);
+    return m_admissionPolicy->ShouldAdmitFrom(clientAddr, dag, m_cluster, m_clusterState);
 }
 
 uint64_t
@@ -654,9 +1043,15 @@ EdgeOrchestrator::CreateAndDispatchWorkload(Ptr<DagTask> dag, const Address& cli
 }
 
 int32_t
-EdgeOrchestrator::DispatchTask(uint64_t workloadId, Ptr<Task> task)
+EdgeOrchestrator::SelectBackend(Ptr<Task> task)
 {
-    NS_LOG_FUNCTION(this << workloadId << task->GetTaskId());
+    NS_LOG_FUNCTION(this << task->GetTaskId());
+
+    // Availability changes (e.g. from the autoscaler) invalidate the load index
+    if (!m_clusterState.IsLoadIndexed(m_cluster))
+    {
+        m_clusterState.IndexLoad(m_cluster);
+    }
 
     int32_t backendIdx = m_scheduler->ScheduleTask(task, m_cluster, m_clusterState);
     if (backendIdx < 0 || static_cast<uint32_t>(backendIdx) >= m_cluster.GetN())
@@ -665,41 +1060,147 @@ EdgeOrchestrator::DispatchTask(uint64_t workloadId, Ptr<Task> task)
                                                                 << task->GetTaskId());
         return -1;
     }
+    if (FitsModel(backendIdx, task))
+    {
+        return backendIdx;
+    }
+
+    // Place again among the backends that can hold the model, hiding the rest
+    Cluster fitting = m_cluster;
+    for (uint32_t idx : m_cluster.GetAvailableBackends())
+    {
+        if (!FitsModel(idx, task))
+        {
+            fitting.SetAvailable(idx, false);
+        }
+    }
+    if (fitting.GetNAvailable() == 0)
+    {
+        NS_LOG_WARN("Model " << task->GetModelId() << " of task " << task->GetTaskId()
+                             << " does not fit any available backend");
+        return -1;
+    }
+
+    NS_LOG_DEBUG("Model of task " << task->GetTaskId() << " does not fit backend " << backendIdx
+                                  << ", placing it among " << fitting.GetNAvailable()
+                                  << " that it fits");
+    backendIdx = m_scheduler->ScheduleTask(task, fitting, m_clusterState);
+    if (backendIdx < 0 || static_cast<uint32_t>(backendIdx) >= m_cluster.GetN() ||
+        !FitsModel(backendIdx, task))
+    {
+        NS_LOG_WARN("Scheduler found no backend for the model of task " << task->GetTaskId());
+        return -1;
+    }
+    return backendIdx;
+}
+
+bool
+EdgeOrchestrator::FitsModel(uint32_t backendIdx, Ptr<const Task> task) const
+{
+    // A device fails a model it cannot hold, and the backend has no failure response
+    uint64_t capacity = m_clusterState.Get(backendIdx).modelCacheCapacity;
+    return capacity == 0 || task->GetModelSize() <= capacity;
+}
+
+int32_t
+EdgeOrchestrator::DispatchTask(uint64_t workloadId, Ptr<Task> task, int32_t backendIdx)
+{
+    NS_LOG_FUNCTION(this << workloadId << task->GetTaskId() << backendIdx);
+    return DispatchBatch({{workloadId, task}}, backendIdx) ? backendIdx : -1;
+}
+
+bool
+EdgeOrchestrator::DispatchBatch(const std::vector<std::pair<uint64_t, Ptr<Task>>>& tasks,
+                                int32_t backendIdx)
+{
+    NS_LOG_FUNCTION(this << tasks.size() << backendIdx);
 
     const Cluster::Backend& backend = m_cluster.Get(backendIdx);
 
-    auto wit = m_workloads.find(workloadId);
-    NS_ASSERT_MSG(wit != m_workloads.end(),
-                  "DispatchTask: workload " << workloadId << " not found");
-    auto& state = wit->second;
+    // Only a lone task's round trip is free of queueing behind its batch
+    bool idleBackend = m_clusterState.Get(backendIdx).activeTasks == 0 && tasks.size() == 1;
 
-    uint64_t taskId = task->GetTaskId();
-    int32_t dagIdx = state.dag->GetTaskIndex(taskId);
-    NS_ASSERT_MSG(dagIdx >= 0, "Task " << taskId << " not found in DAG");
+    // The backend parses the task messages one after another
+    Ptr<Packet> packet = Create<Packet>();
+    for (const auto& [workloadId, task] : tasks)
+    {
+        auto wit = m_workloads.find(workloadId);
+        NS_ASSERT_MSG(wit != m_workloads.end(),
+                      "DispatchBatch: workload " << workloadId << " not found");
+        auto& state = wit->second;
+
+        uint64_t taskId = task->GetTaskId();
+        int32_t dagIdx = state.dag->GetTaskIndex(taskId);
+        NS_ASSERT_MSG(dagIdx >= 0, "Task " << taskId << " not found in DAG");
+
+        state.taskToBackend[taskId] = backendIdx;
+        state.pendingTasks++;
 
-    m_dispatchedTasks[taskId] = {workloadId, static_cast<uint32_t>(dagIdx), task->GetTaskType()};
+        if (m_deviceManager)
+        {
+            m_deviceManager->AttachFrequencyHint(task, backendIdx, m_clusterState);
+        }
 
-    state.taskToBackend[taskId] = backendIdx;
-    state.pendingTasks++;
+        Ptr<Packet> message = task->Serialize(false);
 
-    Ptr<Packet> packet = task->Serialize(false);
+        Replica replica{static_cast<uint32_t>(backendIdx),
+                        Simulator::Now(),
+                        message->GetSize(),
+                        idleBackend};
+        m_dispatchedTasks[taskId] =
+            {workloadId, static_cast<uint32_t>(dagIdx), task->GetTaskType(), {replica}, EventId()};
+        packet->AddAtEnd(message);
+    }
 
     bool sent = m_backendConnMgr->Send(packet, backend.address);
     if (!sent)
     {
-        NS_LOG_ERROR("Failed to send task to backend " << backendIdx);
-        m_dispatchedTasks.erase(taskId);
-        state.taskToBackend.erase(taskId);
-        state.pendingTasks--;
-        return -1;
+        NS_LOG_ERROR("Failed to send " << tasks.size() << " task(s) to backend " << backendIdx);
+        for (const auto& [workloadId, task] : tasks)
+        {
+            auto& state = m_workloads.find(workloadId)->second;
+            m_dispatchedTasks.erase(task->GetTaskId());
+            state.taskToBackend.erase(task->GetTaskId());
+            state.pendingTasks--;
+        }
+        return false;
+    }
+
+    for (const auto& [workloadId, task] : tasks)
+    {
+        uint64_t taskId = task->GetTaskId();
+        if (m_deviceManager)
+        {
+            m_deviceManager->CommitFrequencyHint(task, backendIdx, m_clusterState);
+        }
+        task->SetState(TASK_DISPATCHED);
+        m_taskDispatchedTrace(workloadId, taskId, backendIdx);
+        m_clusterState.NotifyTaskDispatched(backendIdx, task);
+        m_clusterState.NotifyModelUsed(backendIdx, task->GetModelId(), task->GetModelSize());
+        m_tasksDispatched++;
+        NS_LOG_INFO("Dispatched task " << taskId << " to backend " << backendIdx);
+
+        Time threshold = GetHedgeThreshold(task->GetTaskType());
+        if (threshold.IsStrictlyPositive())
+        {
+            m_dispatchedTasks[taskId].hedgeEvent =
+                Simulator::Schedule(threshold, &EdgeOrchestrator::HedgeTask, this, taskId);
+        }
     }
+    m_stealRefused.erase(backendIdx);
 
-    task->SetState(TASK_DISPATCHED);
-    m_taskDispatchedTrace(workloadId, taskId, backendIdx);
-    m_clusterState.NotifyTaskDispatched(backendIdx);
-    NS_LOG_INFO("Dispatched task " << taskId << " to backend " << backendIdx);
+    // A probed backend takes one batch, then waits out its result in quarantine
+    if (m_probing.erase(backendIdx) > 0)
+    {
+        m_cluster.SetQuarantined(backendIdx, true);
+        m_probeTasks[backendIdx] = tasks.front().second->GetTaskId();
+        m_probeEvents[backendIdx] =
+            Simulator::Schedule(m_probeInterval, &EdgeOrchestrator::ProbeBackend, this, backendIdx);
+        NS_LOG_DEBUG("Probing backend " << backendIdx << " with task "
+                                        << tasks.front().second->GetTaskId());
+    }
 
-    return backendIdx;
+    return true;
 }
 
 void
@@ -729,6 +1230,22 @@ EdgeOrchestrator::HandleBackendResponse(Ptr<Packet> packet, const Address& from)
             continue;
         }
 
+        uint8_t messageType;
+        buffer->CopyData(&messageType, 1);
+        if (messageType == TaskCancelHeader::TASK_CANCEL)
+        {
+            HandleCancelAck(buffer, from);
+            continue;
+        }
+        if (messageType == TaskStealHeader::STEAL_RESPONSE)
+        {
+            if (!HandleStealResponse(buffer, from))
+            {
+                break;
+            }
+            continue;
+        }
+
         uint64_t taskId = PeekTaskId(buffer);
 
         auto dispIt = m_dispatchedTasks.find(taskId);
@@ -738,7 +1255,7 @@ EdgeOrchestrator::HandleBackendResponse(Ptr<Packet> packet, const Address& from)
             break;
         }
 
-        DispatchedTaskInfo info = dispIt->second;
+        DispatchedTaskInfo& info = dispIt->second;
 
         auto regIt = m_taskTypeRegistry.find(info.taskType);
         if (regIt == m_taskTypeRegistry.end())
@@ -757,83 +1274,631 @@ EdgeOrchestrator::HandleBackendResponse(Ptr<Packet> packet, const Address& from)
 
         buffer->RemoveAtStart(consumedBytes);
 
+        // Apply a metrics trailer piggybacked on the response before the
+        // completion, so scaling decisions see the backend's fresh state
+        if (m_deviceManager && buffer->GetSize() > 0)
+        {
+            m_deviceManager->TryConsumeMetrics(buffer, from, m_clusterState);
+        }
+
+        int32_t fromIdx = m_cluster.GetBackendIndex(from);
+        auto replicaIt = std::find_if(info.replicas.begin(),
+                                      info.replicas.end(),
+                                      [fromIdx](const Replica& replica) {
+                                          return static_cast<int32_t>(replica.backendIdx) ==
+                                                 fromIdx;
+                                      });
+        if (replicaIt == info.replicas.end())
+        {
+            NS_LOG_ERROR("Task " << taskId << " was not dispatched to backend " << from);
+            continue;
+        }
+
+        Replica replica = *replicaIt;
+        info.replicas.erase(replicaIt);
+        uint64_t workloadId = info.workloadId;
+
+        if (replica.cancelled)
+        {
+            NS_LOG_DEBUG("Dropping response of withdrawn task " << taskId << " from backend "
+                                                                << replica.backendIdx);
+            m_clusterState.NotifyTaskCompleted(replica.backendIdx, taskId);
+            if (info.replicas.empty())
+            {
+                m_dispatchedTasks.erase(dispIt);
+            }
+            continue;
+        }
+
+        // The first response wins; other copies are withdrawn
+        info.hedgeEvent.Cancel();
+        CancelReplicas(taskId, info, true);
+        if (info.replicas.empty())
+        {
+            m_dispatchedTasks.erase(dispIt);
+        }
+
         if (!task)
         {
             NS_LOG_ERROR("Deserializer consumed " << consumedBytes
                                                   << " bytes but returned null task " << taskId
                                                   << " — cancelling workload");
-            m_dispatchedTasks.erase(dispIt);
-            CancelWorkload(info.workloadId);
+            auto workloadIt = m_workloads.find(workloadId);
+            if (workloadIt != m_workloads.end() &&
+                workloadIt->second.taskToBackend.erase(taskId) > 0)
+            {
+                m_clusterState.NotifyTaskCompleted(replica.backendIdx, taskId);
+            }
+            CancelWorkload(workloadId);
             continue;
         }
 
-        m_dispatchedTasks.erase(dispIt);
+        // The response carries the backend's own timings; hedging goes by the round trip
+        std::deque<Time>& history = m_responseTimes[task->GetTaskType()];
+        history.push_back(Simulator::Now() - replica.dispatchTime);
+        while (history.size() > m_hedgeHistory)
+        {
+            history.pop_front();
+        }
+        bool outlier = m_clusterState.NotifyResponse(replica.backendIdx,
+                                                     task,
+                                                     replica.dispatchTime,
+                                                     Simulator::Now());
+        UpdateHealth(replica.backendIdx, taskId, outlier);
 
-        auto workloadIt = m_workloads.find(info.workloadId);
+        auto workloadIt = m_workloads.find(workloadId);
         if (workloadIt == m_workloads.end())
         {
-            NS_LOG_WARN("Workload " << info.workloadId << " not found for task " << taskId);
+            NS_LOG_WARN("Workload " << workloadId << " not found for task " << taskId);
             continue;
         }
 
         auto& state = workloadIt->second;
-        auto backendIt = state.taskToBackend.find(taskId);
-        if (backendIt == state.taskToBackend.end())
+        if (state.taskToBackend.find(taskId) == state.taskToBackend.end())
         {
             NS_LOG_ERROR("Backend index not found for task " << taskId << " in workload "
-                                                             << info.workloadId
+                                                             << workloadId
                                                              << " - skipping completion");
             continue;
         }
-        uint32_t backendIdx = backendIt->second;
 
-        OnTaskCompleted(info.workloadId, task, backendIdx);
+        RecordTransfer(replica, task, consumedBytes);
+        OnTaskCompleted(workloadId, task, replica.backendIdx);
     }
 
     if (buffer->GetSize() == 0)
     {
         m_backendRxBuffer.erase(from);
     }
+
+    // Responses free backend slots, including those of cancelled workloads
+    DrainDispatchQueue();
+    TryStealWork();
 }
 
 void
-EdgeOrchestrator::OnTaskCompleted(uint64_t workloadId, Ptr<Task> task, uint32_t backendIdx)
+EdgeOrchestrator::RecordTransfer(const Replica& replica,
+                                 Ptr<const Task> task,
+                                 uint64_t responseBytes)
 {
-    NS_LOG_FUNCTION(this << workloadId << task->GetTaskId() << backendIdx);
-
-    auto it = m_workloads.find(workloadId);
-    if (it == m_workloads.end())
+    const ClusterState::BackendState& backend = m_clusterState.Get(replica.backendIdx);
+    if (!replica.idleBackend || backend.computeRate <= 0 || backend.referenceFrequency <= 0)
     {
-        NS_LOG_WARN("OnTaskCompleted: workload " << workloadId << " not found");
         return;
     }
 
-    WorkloadState& state = it->second;
-    uint64_t taskId = task->GetTaskId();
-
-    m_scheduler->NotifyTaskCompleted(backendIdx, task);
-    m_clusterState.NotifyTaskCompleted(backendIdx);
-
-    if (m_deviceManager)
+    double frequency = backend.commandedFrequency > 0 ? backend.commandedFrequency
+                                                      : backend.referenceFrequency;
+    double exec = task->GetComputeDemand() * backend.referenceFrequency /
+                  (backend.computeRate * frequency);
+    if (backend.memoryBandwidth > 0)
     {
-        m_deviceManager->EvaluateScaling(m_clusterState);
+        exec += static_cast<double>(task->GetInputSize() + task->GetOutputSize()) /
+                backend.memoryBandwidth;
     }
 
-    m_taskCompletedTrace(workloadId, taskId, backendIdx);
+    Time transfer = Simulator::Now() - replica.dispatchTime - Seconds(exec);
+    m_clusterState.NotifyTransfer(replica.backendIdx,
+                                  replica.requestBytes + responseBytes,
+                                  transfer);
+}
 
-    state.taskToBackend.erase(taskId);
+Time
+EdgeOrchestrator::GetHedgeThreshold(uint8_t taskType) const
+{
+    if (m_hedgePercentile <= 0)
+    {
+        return Seconds(0);
+    }
 
-    NS_ASSERT_MSG(state.pendingTasks > 0, "pendingTasks underflow for workload " << workloadId);
-    state.pendingTasks--;
+    auto it = m_responseTimes.find(taskType);
+    if (it == m_responseTimes.end() || it->second.size() < m_hedgeHistory)
+    {
+        return Seconds(0);
+    }
 
-    NS_LOG_INFO("Task " << taskId << " completed on backend " << backendIdx);
+    std::vector<Time> samples(it->second.begin(), it->second.end());
+    size_t rank = static_cast<size_t>(std::ceil(m_hedgePercentile * samples.size()));
+    auto nth = samples.begin() + (rank > 0 ? rank - 1 : 0);
+    std::nth_element(samples.begin(), nth, samples.end());
+    return *nth;
+}
 
-    Ptr<DagTask> dag = state.dag;
+void
+EdgeOrchestrator::HedgeTask(uint64_t taskId)
+{
+    NS_LOG_FUNCTION(this << taskId);
 
-    int32_t dagIdx = dag->GetTaskIndex(taskId);
-    if (dagIdx < 0)
+    auto it = m_dispatchedTasks.find(taskId);
+    if (it == m_dispatchedTasks.end())
     {
-        NS_LOG_ERROR("Task " << taskId << " not found in DAG for workload " << workloadId);
+        return;
+    }
+
+    DispatchedTaskInfo& info = it->second;
+    if (info.replicas.size() != 1 || info.replicas.front().cancelled)
+    {
+        return;
+    }
+
+    if (m_tasksHedged + 1 > m_hedgeBudget * m_tasksDispatched)
+    {
+        NS_LOG_DEBUG("Hedge budget spent, not hedging task " << taskId);
+        return;
+    }
+
+    auto wit = m_workloads.find(info.workloadId);
+    if (wit == m_workloads.end())
+    {
+        return;
+    }
+    Ptr<Task> task = wit->second.dag->GetTask(info.dagIdx);
+
+    // Least-loaded other backend with room for the copy
+    uint32_t primaryIdx = info.replicas.front().backendIdx;
+    const std::string& required = task->GetRequiredAcceleratorType();
+    const std::vector<uint32_t>& pool = required.empty()
+                                            ? m_cluster.GetAvailableBackends()
+                                            : m_cluster.GetAvailableBackendsByType(required);
+    int32_t bestIdx = -1;
+    uint32_t bestLoad = 0;
+    for (uint32_t idx : pool)
+    {
+        uint32_t load = m_clusterState.Get(idx).activeTasks + GetBatchedTaskCount(idx);
+        if (idx == primaryIdx || m_probing.count(idx) > 0 || !FitsModel(idx, task) ||
+            (m_maxInFlight > 0 && load >= m_maxInFlight))
+        {
+            continue;
+        }
+        if (bestIdx < 0 || load < bestLoad)
+        {
+            bestIdx = static_cast<int32_t>(idx);
+            bestLoad = load;
+        }
+    }
+
+    if (bestIdx < 0)
+    {
+        NS_LOG_DEBUG("No other backend to hedge task " << taskId);
+        return;
+    }
+
+    if (m_deviceManager)
+    {
+        m_deviceManager->AttachFrequencyHint(task, bestIdx, m_clusterState);
+    }
+
+    Ptr<Packet> message = task->Serialize(false);
+    uint64_t requestBytes = message->GetSize();
+    if (!m_backendConnMgr->Send(message, m_cluster.Get(bestIdx).address))
+    {
+        NS_LOG_ERROR("Failed to send hedge of task " << taskId << " to backend " << bestIdx);
+        return;
+    }
+
+    uint32_t backendIdx = static_cast<uint32_t>(bestIdx);
+    if (m_deviceManager)
+    {
+        m_deviceManager->CommitFrequencyHint(task, backendIdx, m_clusterState);
+    }
+    info.replicas.push_back({backendIdx, Simulator::Now(), requestBytes, bestLoad == 0});
+    m_tasksHedged++;
+    m_stealRefused.erase(backendIdx);
+    m_clusterState.NotifyTaskDispatched(backendIdx, task);
+    m_clusterState.NotifyModelUsed(backendIdx, task->GetModelId(), task->GetModelSize());
+    m_taskHedgedTrace(info.workloadId, taskId, backendIdx);
+    NS_LOG_INFO("Hedged task " << taskId << " from backend " << primaryIdx << " to backend "
+                               << backendIdx);
+}
+
+void
+EdgeOrchestrator::CancelReplicas(uint64_t taskId, DispatchedTaskInfo& info, bool notifyBackends)
+{
+    NS_LOG_FUNCTION(this << taskId << notifyBackends);
+
+    for (Replica& replica : info.replicas)
+    {
+        if (replica.cancelled)
+        {
+            continue;
+        }
+        replica.cancelled = true;
+
+        // The backend stays loaded until it acknowledges the withdrawal or answers
+        if (notifyBackends)
+        {
+            TaskCancelHeader header;
+            header.SetTaskId(taskId);
+            Ptr<Packet> packet = Create<Packet>();
+            packet->AddHeader(header);
+            if (!m_backendConnMgr->Send(packet, m_cluster.Get(replica.backendIdx).address))
+            {
+                NS_LOG_WARN("Failed to withdraw task " << taskId << " from backend "
+                                                       << replica.backendIdx);
+            }
+        }
+    }
+}
+
+void
+EdgeOrchestrator::HandleCancelAck(Ptr<Packet> buffer, const Address& from)
+{
+    NS_LOG_FUNCTION(this << from);
+
+    Ptr<Packet> fragment = buffer->CreateFragment(0, TaskCancelHeader::SERIALIZED_SIZE);
+    buffer->RemoveAtStart(TaskCancelHeader::SERIALIZED_SIZE);
+
+    TaskCancelHeader header;
+    fragment->RemoveHeader(header);
+
+    auto it = m_dispatchedTasks.find(header.GetTaskId());
+    if (it == m_dispatchedTasks.end())
+    {
+        NS_LOG_DEBUG("Cancel acknowledged for unknown task " << header.GetTaskId());
+        return;
+    }
+
+    int32_t fromIdx = m_cluster.GetBackendIndex(from);
+    std::vector<Replica>& replicas = it->second.replicas;
+    auto replicaIt = std::find_if(replicas.begin(), replicas.end(), [fromIdx](const Replica& r) {
+        return r.cancelled && static_cast<int32_t>(r.backendIdx) == fromIdx;
+    });
+    if (replicaIt == replicas.end())
+    {
+        return;
+    }
+
+    // The withdrawn copy no longer occupies the backend
+    m_clusterState.NotifyTaskCompleted(replicaIt->backendIdx, header.GetTaskId());
+    replicas.erase(replicaIt);
+    if (replicas.empty())
+    {
+        m_dispatchedTasks.erase(it);
+    }
+    DrainDispatchQueue();
+    TryStealWork();
+}
+
+void
+EdgeOrchestrator::TryStealWork()
+{
+    if (m_stealThreshold == 0)
+    {
+        return;
+    }
+
+    NS_LOG_FUNCTION(this);
+
+    // A backend waiting on its only task cannot spare it
+    uint32_t minLoad = std::max<uint32_t>(m_stealThreshold, 2);
+    auto inSteal = [this](uint32_t idx) {
+        if (m_steals.count(idx) > 0)
+        {
+            return true;
+        }
+        return std::any_of(m_steals.begin(), m_steals.end(), [idx](const auto& steal) {
+            return steal.second == idx;
+        });
+    };
+
+    for (uint32_t thief : m_cluster.GetAvailableBackends())
+    {
+        if (m_clusterState.Get(thief).activeTasks > 0 || GetBatchedTaskCount(thief) > 0 ||
+            inSteal(thief) || m_probing.count(thief) > 0)
+        {
+            continue;
+        }
+
+        const std::string& type = m_cluster.Get(thief).acceleratorType;
+        int32_t victim = -1;
+        uint32_t victimLoad = 0;
+        // Quarantined backends keep their queues until stolen from
+        for (uint32_t idx : m_cluster.GetBackendsByType(type))
+        {
+            uint32_t load = m_clusterState.Get(idx).activeTasks;
+            if (m_cluster.Get(idx).acceleratorType != type || load < minLoad ||
+                load <= victimLoad || inSteal(idx) || m_stealRefused.count(idx) > 0)
+            {
+                continue;
+            }
+            victim = static_cast<int32_t>(idx);
+            victimLoad = load;
+        }
+        if (victim < 0)
+        {
+            continue;
+        }
+
+        Ptr<Packet> packet = Create<Packet>();
+        packet->AddHeader(TaskStealHeader());
+        if (!m_backendConnMgr->Send(packet, m_cluster.Get(victim).address))
+        {
+            NS_LOG_WARN("Failed to send steal request to backend " << victim);
+            continue;
+        }
+        m_steals[static_cast<uint32_t>(victim)] = thief;
+        NS_LOG_DEBUG("Backend " << thief << " stealing from backend " << victim << " with "
+                                << victimLoad << " tasks in flight");
+    }
+}
+
+bool
+EdgeOrchestrator::HandleStealResponse(Ptr<Packet> buffer, const Address& from)
+{
+    NS_LOG_FUNCTION(this << from);
+
+    if (buffer->GetSize() < TaskStealHeader::SERIALIZED_SIZE)
+    {
+        return false;
+    }
+    TaskStealHeader header;
+    buffer->PeekHeader(header);
+    if (buffer->GetSize() < TaskStealHeader::SERIALIZED_SIZE + header.GetPayloadSize())
+    {
+        return false;
+    }
+    buffer->RemoveAtStart(TaskStealHeader::SERIALIZED_SIZE);
+    buffer->RemoveAtStart(header.GetPayloadSize());
+
+    // If the thief went away, the task goes back where it came from
+    uint32_t victim = static_cast<uint32_t>(m_cluster.GetBackendIndex(from));
+    uint32_t thief = victim;
+    auto stealIt = m_steals.find(victim);
+    if (stealIt != m_steals.end())
+    {
+        thief = stealIt->second;
+        m_steals.erase(stealIt);
+    }
+
+    // Not asked again until it has been sent more work
+    if (header.GetPayloadSize() == 0)
+    {
+        NS_LOG_DEBUG("Backend " << victim << " had nothing to give up");
+        m_stealRefused.insert(victim);
+        return true;
+    }
+
+    uint64_t taskId = header.GetTaskId();
+    auto dispIt = m_dispatchedTasks.find(taskId);
+    if (dispIt == m_dispatchedTasks.end())
+    {
+        NS_LOG_DEBUG("Dropping stolen task " << taskId << " which is no longer dispatched");
+        return true;
+    }
+
+    DispatchedTaskInfo& info = dispIt->second;
+    auto victimIt = std::find_if(info.replicas.begin(),
+                                 info.replicas.end(),
+                                 [victim](const Replica& r) { return r.backendIdx == victim; });
+    if (victimIt == info.replicas.end())
+    {
+        return true;
+    }
+
+    // The backend gave the copy up before seeing its withdrawal
+    if (victimIt->cancelled)
+    {
+        m_clusterState.NotifyTaskCompleted(victim, taskId);
+        info.replicas.erase(victimIt);
+        if (info.replicas.empty())
+        {
+            m_dispatchedTasks.erase(dispIt);
+        }
+        return true;
+    }
+
+    // The thief already holds a hedged copy
+    auto thiefIt = std::find_if(info.replicas.begin(),
+                                info.replicas.end(),
+                                [thief](const Replica& r) { return r.backendIdx == thief; });
+    if (thiefIt != info.replicas.end() && thief != victim)
+    {
+        info.replicas.erase(victimIt);
+        m_clusterState.NotifyTaskCompleted(victim, taskId);
+        return true;
+    }
+
+    uint64_t workloadId = info.workloadId;
+    auto wit = m_workloads.find(workloadId);
+    NS_ASSERT_MSG(wit != m_workloads.end(), "Stolen task " << taskId << " has no workload");
+    Ptr<Task> task = wit->second.dag->GetTask(info.dagIdx);
+    if (!FitsModel(thief, task))
+    {
+        NS_LOG_DEBUG("Backend " << thief << " cannot hold the model of task " << taskId);
+        thief = victim;
+    }
+
+    // The task is sent from the orchestrator's copy with a clock hint for where it goes;
+    // the victim's hint was committed for the victim alone
+    task->SetTargetFrequency(0);
+    task->SetTargetVoltage(0);
+    if (m_deviceManager && thief != victim)
+    {
+        m_deviceManager->AttachFrequencyHint(task, thief, m_clusterState);
+    }
+    if (!m_backendConnMgr->Send(task->Serialize(false), m_cluster.Get(thief).address))
+    {
+        NS_LOG_ERROR("Failed to forward stolen task " << taskId << " to backend " << thief);
+        info.replicas.erase(victimIt);
+        m_clusterState.NotifyTaskCompleted(victim, taskId);
+        if (info.replicas.empty())
+        {
+            m_dispatchedTasks.erase(dispIt);
+            wit->second.taskToBackend.erase(taskId);
+        }
+        CancelWorkload(workloadId);
+        return true;
+    }
+
+    if (thief == victim)
+    {
+        return true;
+    }
+
+    if (m_deviceManager)
+    {
+        m_deviceManager->CommitFrequencyHint(task, thief, m_clusterState);
+    }
+
+    // The round trip now includes the detour, so it no longer measures the link
+    victimIt->backendIdx = thief;
+    victimIt->idleBackend = false;
+    auto tbIt = wit->second.taskToBackend.find(taskId);
+    if (tbIt != wit->second.taskToBackend.end() && tbIt->second == victim)
+    {
+        tbIt->second = thief;
+    }
+    m_clusterState.NotifyTaskCompleted(victim, taskId);
+    m_clusterState.NotifyTaskDispatched(thief, task);
+    m_clusterState.NotifyModelUsed(thief, task->GetModelId(), task->GetModelSize());
+    m_stealRefused.erase(thief);
+
+    m_tasksStolen++;
+    m_taskStolenTrace(workloadId, taskId, victim, thief);
+    NS_LOG_INFO("Stole task " << taskId << " from backend " << victim << " for backend "
+                              << thief);
+    return true;
+}
+
+void
+EdgeOrchestrator::UpdateHealth(uint32_t backendIdx, uint64_t taskId, bool outlier)
+{
+    if (m_quarantineAfter == 0)
+    {
+        return;
+    }
+
+    NS_LOG_FUNCTION(this << backendIdx << taskId << outlier);
+
+    // A slow probe leaves the backend quarantined until the next one
+    auto probeIt = m_probeTasks.find(backendIdx);
+    if (probeIt != m_probeTasks.end() && probeIt->second == taskId)
+    {
+        m_probeTasks.erase(probeIt);
+        if (outlier)
+        {
+            NS_LOG_INFO("Backend " << backendIdx << " still slow, staying in quarantine");
+            return;
+        }
+        m_probeEvents[backendIdx].Cancel();
+        m_probeEvents.erase(backendIdx);
+        // The response handler drains the dispatch stage once this response is processed
+        m_cluster.SetQuarantined(backendIdx, false);
+        m_backendQuarantinedTrace(backendIdx, false);
+        NS_LOG_INFO("Backend " << backendIdx << " recovered, lifting quarantine");
+        return;
+    }
+
+    if (m_cluster.IsQuarantined(backendIdx) || m_probing.count(backendIdx) > 0 ||
+        m_clusterState.Get(backendIdx).slowResponses < m_quarantineAfter)
+    {
+        return;
+    }
+
+    const std::string& type = m_cluster.Get(backendIdx).acceleratorType;
+    if (m_cluster.IsAvailable(backendIdx) &&
+        m_cluster.GetAvailableBackendsByType(type).size() <= 1)
+    {
+        NS_LOG_DEBUG("Backend " << backendIdx << " is slow but the last of its type");
+        return;
+    }
+
+    m_cluster.SetQuarantined(backendIdx, true);
+    m_quarantines++;
+    m_backendQuarantinedTrace(backendIdx, true);
+    m_probeEvents[backendIdx] =
+        Simulator::Schedule(m_probeInterval, &EdgeOrchestrator::ProbeBackend, this, backendIdx);
+    NS_LOG_INFO("Quarantined backend " << backendIdx << " after "
+                                       << m_clusterState.Get(backendIdx).slowResponses
+                                       << " slow responses (service time "
+                                       << m_clusterState.Get(backendIdx).serviceTime << ")");
+}
+
+void
+EdgeOrchestrator::HandleBackendAvailable(uint32_t backendIdx)
+{
+    NS_LOG_FUNCTION(this << backendIdx);
+    DrainDispatchQueue();
+    TryStealWork();
+}
+
+void
+EdgeOrchestrator::ProbeBackend(uint32_t backendIdx)
+{
+    NS_LOG_FUNCTION(this << backendIdx);
+
+    // An unanswered probe counts as failed
+    m_probeEvents.erase(backendIdx);
+    m_probeTasks.erase(backendIdx);
+    m_probing.insert(backendIdx);
+    m_cluster.SetQuarantined(backendIdx, false);
+    NS_LOG_DEBUG("Backend " << backendIdx << " open for a probe task");
+    DrainDispatchQueue();
+}
+
+void
+EdgeOrchestrator::OnTaskCompleted(uint64_t workloadId, Ptr<Task> task, uint32_t backendIdx)
+{
+    NS_LOG_FUNCTION(this << workloadId << task->GetTaskId() << backendIdx);
+
+    auto it = m_workloads.find(workloadId);
+    if (it == m_workloads.end())
+    {
+        NS_LOG_WARN("OnTaskCompleted: workload " << workloadId << " not found");
+        return;
+    }
+
+    WorkloadState& state = it->second;
+    uint64_t taskId = task->GetTaskId();
+
+    m_scheduler->NotifyTaskCompleted(backendIdx, task);
+    m_clusterState.NotifyTaskCompleted(backendIdx, taskId);
+
+    if (m_autoscaler)
+    {
+        m_autoscaler->NotifyTaskCompleted(backendIdx);
+    }
+
+    if (m_deviceManager)
+    {
+        m_deviceManager->EvaluateScaling(m_clusterState);
+    }
+
+    m_taskCompletedTrace(workloadId, taskId, backendIdx);
+
+    state.taskToBackend.erase(taskId);
+
+    NS_ASSERT_MSG(state.pendingTasks > 0, "pendingTasks underflow for workload " << workloadId);
+    state.pendingTasks--;
+
+    NS_LOG_INFO("Task " << taskId << " completed on backend " << backendIdx);
+
+    Ptr<DagTask> dag = state.dag;
+
+    int32_t dagIdx = dag->GetTaskIndex(taskId);
+    if (dagIdx < 0)
+    {
+        NS_LOG_ERROR("Task " << taskId << " not found in DAG for workload " << workloadId);
         return;
     }
 
@@ -867,22 +1932,261 @@ EdgeOrchestrator::ProcessDagReadyTasks(uint64_t workloadId)
     {
         Ptr<Task> task = state.dag->GetTask(idx);
 
-        if (state.taskToBackend.find(task->GetTaskId()) != state.taskToBackend.end())
+        if (state.taskToBackend.find(task->GetTaskId()) != state.taskToBackend.end() ||
+            state.queuedTasks.count(task->GetTaskId()))
+        {
+            continue;
+        }
+
+        EnqueueReadyTask(workloadId, task);
+    }
+
+    DrainDispatchQueue();
+
+    return m_workloads.find(workloadId) != m_workloads.end();
+}
+
+void
+EdgeOrchestrator::EnqueueReadyTask(uint64_t workloadId, Ptr<Task> task)
+{
+    NS_LOG_FUNCTION(this << workloadId << task->GetTaskId());
+
+    auto it = m_workloads.find(workloadId);
+    NS_ASSERT_MSG(it != m_workloads.end(),
+                  "EnqueueReadyTask: workload " << workloadId << " not found");
+    WorkloadState& state = it->second;
+
+    auto wit = m_clientWeights.find(state.clientAddr);
+    double weight = wit != m_clientWeights.end() ? wit->second : 1.0;
+
+    ClientQueue& queue = m_dispatchQueues[state.clientAddr];
+    QueuedTask entry;
+    entry.workloadId = workloadId;
+    entry.task = task;
+    entry.startTag = std::max(m_virtualTime, queue.lastFinish);
+    entry.finishTag = entry.startTag + std::max(task->GetComputeDemand(), 1.0) / weight;
+    queue.lastFinish = entry.finishTag;
+    queue.tasks.push_back(entry);
+
+    state.queuedTasks.insert(task->GetTaskId());
+    m_queuedTasks++;
+}
+
+void
+EdgeOrchestrator::DrainDispatchQueue()
+{
+    NS_LOG_FUNCTION(this << m_queuedTasks);
+
+    // Clients whose head task waits for a full backend are passed over, not waited on
+    std::set<const ClientQueue*> held;
+    while (m_queuedTasks > 0)
+    {
+        // Serve the client whose head task finishes first in virtual time
+        ClientQueue* next = nullptr;
+        for (auto& [clientAddr, queue] : m_dispatchQueues)
         {
+            if (!queue.tasks.empty() && held.count(&queue) == 0 &&
+                (!next || queue.tasks.front().finishTag < next->tasks.front().finishTag))
+            {
+                next = &queue;
+            }
+        }
+        if (!next)
+        {
+            return;
+        }
+
+        // A task joining an open batch follows it to its backend, and a held task keeps
+        // the backend chosen for it while that backend stays available
+        QueuedTask& head = next->tasks.front();
+        bool batching = m_batchWindow.IsStrictlyPositive();
+        auto batchIt = batching ? m_batches.find(GetBatchKey(head.task)) : m_batches.end();
+        int32_t backendIdx = head.backendIdx;
+        if (batchIt != m_batches.end())
+        {
+            backendIdx = batchIt->second.backendIdx;
+        }
+        else if (backendIdx < 0 || !m_cluster.IsAvailable(backendIdx))
+        {
+            backendIdx = SelectBackend(head.task);
+        }
+        if (backendIdx >= 0 && m_maxInFlight > 0 &&
+            m_clusterState.Get(backendIdx).activeTasks + GetBatchedTaskCount(backendIdx) >=
+                m_maxInFlight)
+        {
+            NS_LOG_DEBUG("Backend " << backendIdx << " is full, holding task "
+                                    << head.task->GetTaskId());
+            head.backendIdx = backendIdx;
+            held.insert(next);
             continue;
         }
 
-        int32_t backendIdx = DispatchTask(workloadId, task);
-        if (backendIdx < 0)
+        QueuedTask entry = head;
+        next->tasks.pop_front();
+        m_queuedTasks--;
+        m_virtualTime = std::max(m_virtualTime, entry.startTag);
+
+        if (batching && backendIdx >= 0)
+        {
+            AddToBatch(entry.workloadId, entry.task, backendIdx);
+            continue;
+        }
+
+        auto wit = m_workloads.find(entry.workloadId);
+        NS_ASSERT_MSG(wit != m_workloads.end(),
+                      "Queued task " << entry.task->GetTaskId() << " has no workload");
+        wit->second.queuedTasks.erase(entry.task->GetTaskId());
+
+        if (backendIdx < 0 || DispatchTask(entry.workloadId, entry.task, backendIdx) < 0)
+        {
+            NS_LOG_ERROR("Failed to dispatch DAG task " << entry.task->GetTaskId()
+                                                        << " in workload " << entry.workloadId
+                                                        << " - failing workload");
+            CancelWorkload(entry.workloadId);
+        }
+    }
+}
+
+void
+EdgeOrchestrator::DequeueWorkload(uint64_t workloadId, const Address& clientAddr)
+{
+    NS_LOG_FUNCTION(this << workloadId << clientAddr);
+
+    auto it = m_dispatchQueues.find(clientAddr);
+    if (it != m_dispatchQueues.end())
+    {
+        std::deque<QueuedTask>& tasks = it->second.tasks;
+        size_t before = tasks.size();
+        tasks.erase(std::remove_if(tasks.begin(),
+                                   tasks.end(),
+                                   [workloadId](const QueuedTask& entry) {
+                                       return entry.workloadId == workloadId;
+                                   }),
+                    tasks.end());
+        m_queuedTasks -= static_cast<uint32_t>(before - tasks.size());
+    }
+
+    // Tasks already taken into a batch wait there instead
+    for (auto bit = m_batches.begin(); bit != m_batches.end();)
+    {
+        auto& batched = bit->second.tasks;
+        size_t before = batched.size();
+        batched.erase(std::remove_if(batched.begin(),
+                                     batched.end(),
+                                     [workloadId](const std::pair<uint64_t, Ptr<Task>>& entry) {
+                                         return entry.first == workloadId;
+                                     }),
+                      batched.end());
+        m_batchedTasks -= static_cast<uint32_t>(before - batched.size());
+        if (batched.empty())
+        {
+            bit->second.flushEvent.Cancel();
+            bit = m_batches.erase(bit);
+        }
+        else
+        {
+            ++bit;
+        }
+    }
+}
+
+EdgeOrchestrator::BatchKey
+EdgeOrchestrator::GetBatchKey(Ptr<const Task> task)
+{
+    return {task->GetTaskType(), task->GetRequiredAcceleratorType(), task->GetModelId()};
+}
+
+void
+EdgeOrchestrator::AddToBatch(uint64_t workloadId, Ptr<Task> task, int32_t backendIdx)
+{
+    NS_LOG_FUNCTION(this << workloadId << task->GetTaskId() << backendIdx);
+
+    BatchKey key = GetBatchKey(task);
+    auto [it, opened] = m_batches.try_emplace(key);
+    TaskBatch& batch = it->second;
+    if (opened)
+    {
+        batch.backendIdx = backendIdx;
+        batch.flushEvent =
+            Simulator::Schedule(m_batchWindow, &EdgeOrchestrator::FlushBatch, this, key);
+    }
+    batch.tasks.emplace_back(workloadId, task);
+    m_batchedTasks++;
+
+    if (batch.tasks.size() >= m_maxBatchSize)
+    {
+        FlushBatch(key);
+    }
+}
+
+void
+EdgeOrchestrator::FlushBatch(BatchKey key)
+{
+    NS_LOG_FUNCTION(this);
+
+    auto it = m_batches.find(key);
+    if (it == m_batches.end())
+    {
+        return;
+    }
+
+    TaskBatch batch = std::move(it->second);
+    m_batches.erase(it);
+    batch.flushEvent.Cancel();
+    m_batchedTasks -= static_cast<uint32_t>(batch.tasks.size());
+
+    for (const auto& [workloadId, task] : batch.tasks)
+    {
+        m_workloads.find(workloadId)->second.queuedTasks.erase(task->GetTaskId());
+    }
+
+    // The backend may have been scaled down or quarantined while the batch was open
+    Ptr<Task> first = batch.tasks.front().second;
+    int32_t backendIdx = batch.backendIdx;
+    if (!m_cluster.IsAvailable(backendIdx))
+    {
+        NS_LOG_DEBUG("Backend " << backendIdx << " left the pool, placing batch again");
+        backendIdx = SelectBackend(first);
+    }
+    bool sent = backendIdx >= 0 && DispatchBatch(batch.tasks, backendIdx);
+
+    // A batch that fails to send is tried once on another backend
+    if (!sent && backendIdx >= 0)
+    {
+        int32_t retryIdx = SelectBackend(first);
+        if (retryIdx >= 0 && retryIdx != backendIdx)
+        {
+            NS_LOG_DEBUG("Retrying batch on backend " << retryIdx);
+            backendIdx = retryIdx;
+            sent = DispatchBatch(batch.tasks, backendIdx);
+        }
+    }
+
+    if (!sent)
+    {
+        for (const auto& [workloadId, task] : batch.tasks)
         {
-            NS_LOG_ERROR("Failed to dispatch DAG task " << task->GetTaskId() << " in workload "
-                                                        << workloadId << " - failing workload");
             CancelWorkload(workloadId);
-            return false;
         }
+        return;
     }
 
-    return true;
+    NS_LOG_DEBUG("Sent batch of " << batch.tasks.size() << " tasks to backend " << backendIdx);
+    m_batchDispatchedTrace(backendIdx, static_cast<uint32_t>(batch.tasks.size()));
+}
+
+uint32_t
+EdgeOrchestrator::GetBatchedTaskCount(uint32_t backendIdx) const
+{
+    uint32_t count = 0;
+    for (const auto& [key, batch] : m_batches)
+    {
+        if (batch.backendIdx == static_cast<int32_t>(backendIdx))
+        {
+            count += static_cast<uint32_t>(batch.tasks.size());
+        }
+    }
+    return count;
 }
 
 void
@@ -946,20 +2250,13 @@ EdgeOrchestrator::HandleDataUpload(uint64_t dagId, Ptr<Packet> payload, const Ad
 {
     NS_LOG_FUNCTION(this << dagId << clientAddr);
 
-    auto mapIt = m_pendingAdmissions.find(clientAddr);
-    if (mapIt == m_pendingAdmissions.end() || mapIt->second.find(dagId) == mapIt->second.end())
+    if (!ErasePendingAdmission(clientAddr, dagId))
     {
         NS_LOG_WARN("Received DATA_UPLOAD for unknown dagId " << dagId << " from " << clientAddr
                                                               << " — discarding");
         return;
     }
 
-    mapIt->second.erase(dagId);
-    if (mapIt->second.empty())
-    {
-        m_pendingAdmissions.erase(mapIt);
-    }
-
     uint64_t consumedBytes = 0;
     Ptr<DagTask> dag =
         DagTask::DeserializeFullData(payload,
@@ -984,7 +2281,22 @@ EdgeOrchestrator::CleanupClient(const Address& clientAddr)
 
     m_rxBuffer.erase(clientAddr);
 
-    m_pendingAdmissions.erase(clientAddr);
+    auto mapIt = m_pendingAdmissions.find(clientAddr);
+    if (mapIt != m_pendingAdmissions.end())
+    {
+        for (const auto& [dagId, reservationId] : mapIt->second)
+        {
+            m_clusterState.Release(reservationId);
+        }
+        m_pendingAdmissions.erase(mapIt);
+    }
+
+    m_admissionQueue.erase(std::remove_if(m_admissionQueue.begin(),
+                                          m_admissionQueue.end(),
+                                          [&clientAddr](const QueuedAdmission& request) {
+                                              return request.clientAddr == clientAddr;
+                                          }),
+                           m_admissionQueue.end());
 
     std::vector<uint64_t> clientWorkloads;
     for (const auto& pair : m_workloads)
@@ -1000,6 +2312,9 @@ EdgeOrchestrator::CleanupClient(const Address& clientAddr)
         NS_LOG_DEBUG("Cancelling workload " << wid << " - client disconnected");
         CancelWorkload(wid);
     }
+    m_dispatchQueues.erase(clientAddr);
+
+    DrainDispatchQueue();
 }
 
 void
@@ -1018,7 +2333,7 @@ EdgeOrchestrator::HandleAdmissionRequest(uint64_t dagId,
     {
         NS_LOG_WARN("Failed to deserialize DAG metadata for dagId " << dagId);
         RejectWorkload(0, "deserialization_failed");
-        SendAdmissionResponse(clientAddr, dagId, false);
+        SendAdmissionResponse(clientAddr, dagId, false, 0);
         return;
     }
 
@@ -1026,7 +2341,7 @@ EdgeOrchestrator::HandleAdmissionRequest(uint64_t dagId,
     {
         NS_LOG_WARN("DAG admission request for empty DAG " << dagId);
         RejectWorkload(0, "empty_dag");
-        SendAdmissionResponse(clientAddr, dagId, false);
+        SendAdmissionResponse(clientAddr, dagId, false, 0);
         return;
     }
 
@@ -1034,11 +2349,62 @@ EdgeOrchestrator::HandleAdmissionRequest(uint64_t dagId,
     {
         NS_LOG_WARN("DAG validation failed for dagId " << dagId);
         RejectWorkload(dag->GetTaskCount(), "invalid_dag");
-        SendAdmissionResponse(clientAddr, dagId, false);
+        SendAdmissionResponse(clientAddr, dagId, false, 0);
+        return;
+    }
+
+    if (m_admissionWindow.IsStrictlyPositive())
+    {
+        m_admissionQueue.push_back({dag, dagId, clientAddr});
+        if (!m_admissionWindowEvent.IsPending())
+        {
+            m_admissionWindowEvent = Simulator::Schedule(m_admissionWindow,
+                                                         &EdgeOrchestrator::EvaluateAdmissionWindow,
+                                                         this);
+        }
         return;
     }
 
     ProcessAdmissionDecision(dag, dagId, clientAddr);
 }
 
+void
+EdgeOrchestrator::EvaluateAdmissionWindow()
+{
+    NS_LOG_FUNCTION(this << m_admissionQueue.size());
+
+    std::vector<QueuedAdmission> queue;
+    queue.swap(m_admissionQueue);
+
+    // Greedy knapsack: the most utility per FLOP is decided first, and each
+    // admission reserves capacity that the later requests are checked against
+    std::vector<std::pair<double, uint32_t>> order;
+    order.reserve(queue.size());
+    for (uint32_t i = 0; i < queue.size(); i++)
+    {
+        Ptr<DagTask> dag = queue[i].dag;
+        double utility = 0;
+        double demand = 0;
+        for (uint32_t t = 0; t < dag->GetTaskCount(); t++)
+        {
+            Ptr<Task> task = dag->GetTask(t);
+            if (task)
+            {
+                utility += 1.0 + task->GetPriority();
+                demand += task->GetComputeDemand();
+            }
+        }
+        double density = demand > 0 ? utility / demand : std::numeric_limits<double>::infinity();
+        order.emplace_back(density, i);
+    }
+    std::stable_sort(order.begin(), order.end(), [](const auto& a, const auto& b) {
+        return a.first > b.first;
+    });
+
+    for (const auto& [density, i] : order)
+    {
+        ProcessAdmissionDecision(queue[i].dag, queue[i].id, queue[i].clientAddr);
+    }
+}
+
 } // namespace ns3
@@ -19,17 +19,24 @@
 
 #include "ns3/application.h"
 #include "ns3/callback.h"
+#include "ns3/event-id.h"
+#include "ns3/nstime.h"
 #include "ns3/ptr.h"
 #include "ns3/traced-callback.h"
 
+#include <deque>
 #include <map>
+#include <set>
+#include <string>
+#include <tuple>
 #include <unordered_map>
-#include <unordered_set>
 #include <utility>
+#include <vector>
 
 namespace ns3
 {
 
+class BackendAutoscaler;
 class DeviceManager;
 
 /**
@@ -41,6 +48,77 @@ class DeviceManager;
  * - Admission control via pluggable AdmissionPolicy
  * - Task scheduling via pluggable Scheduler
  *
+ * Workloads admitted but still awaiting their data upload have their
+ * capacity reserved in ClusterState, so that admission decisions taken in
+ * the meantime account for them. With a non-zero AdmissionWindow, admission
+ * requests are held for the window and then evaluated jointly, as a greedy
+ * knapsack: in decreasing order of utility per FLOP, each request is
+ * admitted if the policy accepts it on top of the reservations of those
+ * admitted before it. A workload's utility is the sum over its tasks of
+ * one plus the task's priority.
+ *
+ * Workloads whose tasks carry cheaper variants (Task::AddVariant()) are
+ * degraded rather than rejected: if the policy rejects the original, each
+ * variant is tried in turn and the workload is admitted as the first one
+ * the policy accepts. The chosen variant is returned in the
+ * ADMISSION_RESPONSE for the client to upload the task in that form.
+ *
+ * With a non-zero MaxInFlightPerBackend, ready tasks pass through a
+ * dispatch stage instead of going out at once. Each client has a queue
+ * and the stage serves them by weighted fair queueing: a task's virtual
+ * finish tag is
+ *
+ * F = max(V, F_prev(client)) + max(FLOPS, 1) / w_client
+ *
+ * and the queued task with the smallest tag is released next, V advancing
+ * to its start tag. A task is released only while the backend chosen for
+ * it by the scheduler has fewer than MaxInFlightPerBackend tasks in
+ * flight; otherwise it waits at the head of its client's queue, keeping
+ * that backend, until the backend responds, and the other clients are
+ * served meanwhile. A client flooding the orchestrator with large DAGs thus
+ * queues behind its own work while backend queues stay short. The stage is
+ * drained whenever a backend frees a slot or comes into service.
+ *
+ * With a non-zero BatchWindow, released tasks are grouped across clients
+ * by task type, required accelerator type and model before being sent.
+ * The first task of a group is placed by the scheduler and the rest follow
+ * it to the same backend, so the model is loaded once for the group. A
+ * group is sent as one message, its tasks back to back, when it reaches
+ * MaxBatchSize or BatchWindow after it was opened; the backend responds to
+ * each task separately. Batched tasks count towards their backend's
+ * in-flight limit.
+ *
+ * With a non-zero HedgePercentile, a task still unanswered after that
+ * percentile of the recent response times of its task type is hedged: a
+ * copy is sent to the least-loaded other backend able to run it. The
+ * first response is taken and the other copy is withdrawn with a
+ * TaskCancelHeader; its backend counts as loaded until it acknowledges
+ * the withdrawal, which for a running copy is when it finishes. Response
+ * times are kept over the last HedgeHistory responses per task type, and a
+ * type is hedged only once its history is full. Hedges are limited to
+ * HedgeBudget times the tasks dispatched.
+ *
+ * With a non-zero StealThreshold, idle backends take queued work from
+ * busy ones. Backends only talk to the orchestrator, so it steals on an
+ * idle backend's behalf: when a backend has nothing in flight and another
+ * of the same accelerator type has at least StealThreshold tasks (and
+ * never fewer than two), the busy backend is sent a TaskStealHeader
+ * request. It gives up the last task its devices have queued but not
+ * started, which the orchestrator sends on to the idle backend from its own
+ * copy of the task, with a frequency hint decided for that backend. Each
+ * backend takes part in at most one steal at a time.
+ *
+ * Every response updates the backend's service time in ClusterState,
+ * which counts responses that are OutlierFactor times slower than the
+ * backend's healthy cost (see ClusterState::NotifyResponse()). With a
+ * non-zero QuarantineAfter, a backend that is alive but slow is
+ * quarantined once that many responses in a row are outliers: it leaves
+ * the cluster's available backends, so no scheduler places new tasks on
+ * it, while the tasks it holds can still finish or be stolen. Every
+ * ProbeInterval the backend is let back in for one probe task; if the
+ * probe is answered at the healthy cost, the quarantine is lifted. The
+ * last available backend of an accelerator type is never quarantined.
+ *
  * The orchestrator supports mixed task types through a task type registry.
  * Each task type is registered via RegisterTaskType() with its deserializer
  * callbacks, enabling DAGs containing different task types (e.g., ImageTask
@@ -83,6 +161,13 @@ class EdgeOrchestrator : public Application
      */
     typedef void (*WorkloadRejectedTracedCallback)(uint32_t taskCount, const std::string& reason);
 
+    /**
+     * @brief TracedCallback signature for workloads admitted as a cheaper variant.
+     * @param dagId The client's DAG ID.
+     * @param variant The variant the workload was admitted as.
+     */
+    typedef void (*WorkloadDegradedTracedCallback)(uint64_t dagId, uint32_t variant);
+
     /**
      * @brief TracedCallback signature for task dispatched events.
      * @param workloadId The workload this task belongs to.
@@ -93,6 +178,42 @@ class EdgeOrchestrator : public Application
                                                  uint64_t taskId,
                                                  uint32_t backendIdx);
 
+    /**
+     * @brief TracedCallback signature for batch dispatched events.
+     * @param backendIdx The backend index the batch was sent to.
+     * @param batchSize Number of tasks in the batch.
+     */
+    typedef void (*BatchDispatchedTracedCallback)(uint32_t backendIdx, uint32_t batchSize);
+
+    /**
+     * @brief TracedCallback signature for task hedged events.
+     * @param workloadId The workload this task belongs to.
+     * @param taskId The hedged task ID.
+     * @param backendIdx The backend index the copy was sent to.
+     */
+    typedef void (*TaskHedgedTracedCallback)(uint64_t workloadId,
+                                             uint64_t taskId,
+                                             uint32_t backendIdx);
+
+    /**
+     * @brief TracedCallback signature for task stolen events.
+     * @param workloadId The workload this task belongs to.
+     * @param taskId The stolen task ID.
+     * @param fromBackend The backend index that gave the task up.
+     * @param toBackend The backend index the task was moved to.
+     */
+    typedef void (*TaskStolenTracedCallback)(uint64_t workloadId,
+                                             uint64_t taskId,
+                                             uint32_t fromBackend,
+                                             uint32_t toBackend);
+
+    /**
+     * @brief TracedCallback signature for backend quarantine events.
+     * @param backendIdx The backend index.
+     * @param quarantined True when quarantined, false when restored.
+     */
+    typedef void (*BackendQuarantinedTracedCallback)(uint32_t backendIdx, bool quarantined);
+
     /**
      * @brief TracedCallback signature for task completed events.
      * @param workloadId The workload this task belongs to.
@@ -191,6 +312,37 @@ class EdgeOrchestrator : public Application
      */
     uint64_t GetWorkloadsCancelled() const;
 
+    /**
+     * @brief Get the number of ready tasks held in the dispatch stage.
+     * @return Count of queued and batched tasks.
+     */
+    uint32_t GetQueuedTaskCount() const;
+
+    /**
+     * @brief Get the number of tasks hedged.
+     * @return Count of duplicate dispatches sent.
+     */
+    uint64_t GetTasksHedged() const;
+
+    /**
+     * @brief Get the number of tasks stolen.
+     * @return Count of queued tasks moved from a busy backend to an idle one.
+     */
+    uint64_t GetTasksStolen() const;
+
+    /**
+     * @brief Get the number of times a backend was quarantined.
+     * @return Count of quarantines, not counting probes.
+     */
+    uint64_t GetQuarantines() const;
+
+    /**
+     * @brief Set a client's weight in the dispatch stage.
+     * @param clientAddr The client address.
+     * @param weight The client's share relative to other clients (> 0, default 1).
+     */
+    void SetClientWeight(const Address& clientAddr, double weight);
+
     /**
      * @brief Get the configured scheduler.
      * @return The scheduler, or nullptr if not set.
@@ -225,6 +377,11 @@ class EdgeOrchestrator : public Application
 
     /**
      * @brief Handle backend disconnection (TCP-specific).
+     *
+     * Every copy of a task on the backend is dropped and released from
+     * ClusterState. A workload is cancelled only if one of its tasks is left
+     * with no live copy on another backend.
+     *
      * @param backendAddr The address of the disconnected backend.
      */
     void HandleBackendClose(const Address& backendAddr);
@@ -239,7 +396,8 @@ class EdgeOrchestrator : public Application
      * @brief Handle an admission request from a client (Phase 1).
      *
      * Deserializes DAG metadata, validates structure, checks admission
-     * policy, and sends ADMISSION_RESPONSE.
+     * policy, and sends ADMISSION_RESPONSE. With an admission window, the
+     * request is queued for EvaluateAdmissionWindow() instead.
      *
      * @param dagId The DAG ID from the OrchestratorHeader taskId field.
      * @param dagPacket Packet containing serialized DAG metadata.
@@ -250,9 +408,12 @@ class EdgeOrchestrator : public Application
     /**
      * @brief Process an admission decision for a workload.
      *
-     * Checks admission policy, detects duplicate requests, queues the
-     * pending admission, and sends the response. Pending admissions are
-     * cleaned up on client disconnect but have no expiry timeout.
+     * Refuses duplicate requests, checks the client once with the policy,
+     * checks the workload, falling back to cheaper variants of it, notifies
+     * the policy of the admitted one, queues the pending admission,
+     * reserves its capacity, and sends the response.
+     * Pending admissions are cleaned up on client disconnect but have no
+     * expiry timeout.
      *
      * @param dag The workload DAG.
      * @param id The DAG ID.
@@ -261,20 +422,41 @@ class EdgeOrchestrator : public Application
      */
     bool ProcessAdmissionDecision(Ptr<DagTask> dag, uint64_t id, const Address& clientAddr);
 
+    /**
+     * @brief Decide the admission requests queued during the admission window.
+     *
+     * Requests are decided in decreasing order of utility per FLOP, each
+     * seeing the capacity reserved by those admitted before it.
+     */
+    void EvaluateAdmissionWindow();
+
+    /**
+     * @brief Remove a pending admission and release its reserved capacity.
+     * @param clientAddr The client address.
+     * @param dagId The DAG ID.
+     * @return false if no such admission was pending.
+     */
+    bool ErasePendingAdmission(const Address& clientAddr, uint64_t dagId);
+
     /**
      * @brief Send admission response to client.
      * @param clientAddr The client address.
      * @param taskId The task ID.
      * @param admitted Whether the task was admitted.
+     * @param variant The variant the task was admitted as (0 = original).
      */
-    void SendAdmissionResponse(const Address& clientAddr, uint64_t taskId, bool admitted);
+    void SendAdmissionResponse(const Address& clientAddr,
+                               uint64_t taskId,
+                               bool admitted,
+                               uint8_t variant);
 
     /**
      * @brief Check admission for a workload.
      * @param dag The workload DAG.
+     * @param clientAddr The requesting client.
      * @return true if admitted.
      */
-    bool CheckAdmission(Ptr<DagTask> dag);
+    bool CheckAdmission(Ptr<DagTask> dag, const Address& clientAddr);
 
     /**
      * @brief Create and dispatch a workload.
@@ -284,13 +466,105 @@ class EdgeOrchestrator : public Application
      */
     uint64_t CreateAndDispatchWorkload(Ptr<DagTask> dag, const Address& clientAddr);
 
+    /**
+     * @brief Choose a backend for a task with the scheduler.
+     *
+     * If the chosen backend cannot hold the task's model (see FitsModel()), the
+     * scheduler places the task again among the available backends that can.
+     * Fails only if none can.
+     *
+     * @param task The task to place.
+     * @return Backend index, or -1 if scheduling failed.
+     */
+    int32_t SelectBackend(Ptr<Task> task);
+
+    /**
+     * @brief Check that a backend's devices can hold a task's model.
+     * @param backendIdx The backend.
+     * @param task The task.
+     * @return true if the model fits, or the backend's memory is untracked.
+     */
+    bool FitsModel(uint32_t backendIdx, Ptr<const Task> task) const;
+
     /**
      * @brief Dispatch a task to a backend.
      * @param workloadId The workload this task belongs to.
      * @param task The task to dispatch.
-     * @return Backend index, or -1 if scheduling failed.
+     * @param backendIdx The backend chosen by SelectBackend().
+     * @return Backend index, or -1 if sending failed.
+     */
+    int32_t DispatchTask(uint64_t workloadId, Ptr<Task> task, int32_t backendIdx);
+
+    /**
+     * @brief Dispatch tasks to a backend in a single message.
+     * @param tasks (workloadId, task) pairs, sent in order.
+     * @param backendIdx The backend.
+     * @return false if sending failed, in which case no task was dispatched.
+     */
+    bool DispatchBatch(const std::vector<std::pair<uint64_t, Ptr<Task>>>& tasks,
+                       int32_t backendIdx);
+
+    /**
+     * @brief Queue a ready task in its client's dispatch queue.
+     * @param workloadId The workload this task belongs to.
+     * @param task The ready task.
+     */
+    void EnqueueReadyTask(uint64_t workloadId, Ptr<Task> task);
+
+    /**
+     * @brief Release queued tasks in fair order while their backends have room.
+     *
+     * A client whose head task waits for a full backend is passed over for
+     * the rest of the pass. Workloads whose tasks cannot be placed or sent
+     * are cancelled.
+     */
+    void DrainDispatchQueue();
+
+    /**
+     * @brief Tasks that may share a batch: task type, accelerator type and model.
+     */
+    typedef std::tuple<uint8_t, std::string, std::string> BatchKey;
+
+    /**
+     * @brief Get the batch a task may join.
+     * @param task The task.
+     * @return The task's batch key.
+     */
+    static BatchKey GetBatchKey(Ptr<const Task> task);
+
+    /**
+     * @brief Add a released task to its batch, opening one on the given backend if needed.
+     * @param workloadId The workload this task belongs to.
+     * @param task The task.
+     * @param backendIdx The backend chosen for the task.
      */
-    int32_t DispatchTask(uint64_t workloadId, Ptr<Task> task);
+    void AddToBatch(uint64_t workloadId, Ptr<Task> task, int32_t backendIdx);
+
+    /**
+     * @brief Send a batch to its backend.
+     *
+     * A batch whose backend has since become unavailable or quarantined is
+     * placed again, and a batch that fails to send is tried once on another
+     * backend. Workloads of a batch that cannot be sent either way are
+     * cancelled.
+     *
+     * @param key The batch key.
+     */
+    void FlushBatch(BatchKey key);
+
+    /**
+     * @brief Get the number of batched tasks waiting to be sent to a backend.
+     * @param backendIdx The backend.
+     * @return Count of batched tasks.
+     */
+    uint32_t GetBatchedTaskCount(uint32_t backendIdx) const;
+
+    /**
+     * @brief Remove a workload's tasks from the dispatch stage.
+     * @param workloadId The workload.
+     * @param clientAddr The workload's client.
+     */
+    void DequeueWorkload(uint64_t workloadId, const Address& clientAddr);
 
     /**
      * @brief Handle response from a backend worker.
@@ -308,9 +582,9 @@ class EdgeOrchestrator : public Application
     void OnTaskCompleted(uint64_t workloadId, Ptr<Task> task, uint32_t backendIdx);
 
     /**
-     * @brief Process ready tasks for a DAG workload.
+     * @brief Queue the ready tasks of a DAG workload and release what fits.
      * @param workloadId The workload to process.
-     * @return true if all ready tasks dispatched successfully, false if a dispatch
+     * @return true if the workload is still active, false if a dispatch
      *         failure occurred and the workload was cancelled.
      */
     bool ProcessDagReadyTasks(uint64_t workloadId);
@@ -340,8 +614,8 @@ class EdgeOrchestrator : public Application
     /**
      * @brief Handle a Phase 2 data upload from a client.
      *
-     * Matches the dagId to a pending admission, cancels the timeout,
-     * deserializes the DAG, and dispatches the workload.
+     * Matches the dagId to a pending admission, releases its reserved
+     * capacity, deserializes the DAG, and dispatches the workload.
      *
      * @param dagId The DAG ID from the OrchestratorHeader taskId field.
      * @param payload Packet containing serialized DAG full data.
@@ -442,18 +716,118 @@ class EdgeOrchestrator : public Application
     Ptr<AdmissionPolicy> m_admissionPolicy; //!< Admission policy (nullptr = always admit)
     Ptr<ClusterScheduler> m_scheduler;      //!< Task scheduler (required)
     Ptr<DeviceManager> m_deviceManager;     //!< DVFS device manager (optional)
+    Ptr<BackendAutoscaler> m_autoscaler;    //!< Backend power autoscaler (optional)
     std::map<uint8_t, TaskTypeEntry> m_taskTypeRegistry; //!< taskType → deserializers
 
+    /**
+     * @brief One copy of a dispatched task on a backend.
+     */
+    struct Replica
+    {
+        uint32_t backendIdx;   //!< Backend the copy was sent to
+        Time dispatchTime;     //!< When the request was sent
+        uint64_t requestBytes; //!< Size of the request on the wire
+        bool idleBackend;      //!< Whether the backend had no other tasks at dispatch
+        bool cancelled{false}; //!< Withdrawn, awaiting its response or cancel acknowledgement
+    };
+
     /**
      * @brief Info stored per dispatched task for routing backend responses.
      */
     struct DispatchedTaskInfo
     {
-        uint64_t workloadId; //!< Owning workload
-        uint32_t dagIdx;     //!< Index within the DAG
-        uint8_t taskType;    //!< Task type for deserialization
+        uint64_t workloadId;           //!< Owning workload
+        uint32_t dagIdx;               //!< Index within the DAG
+        uint8_t taskType;              //!< Task type for deserialization
+        std::vector<Replica> replicas; //!< Copies awaiting a response, the original first
+        EventId hedgeEvent;            //!< Pending hedge of the task
     };
 
+    /**
+     * @brief Measure a backend's link rate from a task's round trip.
+     *
+     * Only tasks sent to an idle backend are sampled, so the round trip is
+     * transfer plus execution with no queueing. The execution time is
+     * estimated from the device rates recorded in ClusterState; backends
+     * without them are not sampled.
+     *
+     * @param replica The copy of the task that responded.
+     * @param task The completed task.
+     * @param responseBytes Size of the response on the wire.
+     */
+    void RecordTransfer(const Replica& replica, Ptr<const Task> task, uint64_t responseBytes);
+
+    /**
+     * @brief Get the response time after which a task of a type is hedged.
+     * @param taskType The task type.
+     * @return The HedgePercentile of recent response times, or zero if not yet known.
+     */
+    Time GetHedgeThreshold(uint8_t taskType) const;
+
+    /**
+     * @brief Send a copy of a task that has not yet responded to another backend.
+     * @param taskId The task to hedge.
+     */
+    void HedgeTask(uint64_t taskId);
+
+    /**
+     * @brief Withdraw every copy of a task still awaiting a response.
+     *
+     * The copies stay recorded, and their backends loaded, until their
+     * response or cancel acknowledgement arrives: a backend acknowledges a
+     * running copy only once it has finished.
+     *
+     * @param taskId The task.
+     * @param info Dispatch info of the task.
+     * @param notifyBackends Whether to send each backend a TaskCancelHeader.
+     */
+    void CancelReplicas(uint64_t taskId, DispatchedTaskInfo& info, bool notifyBackends);
+
+    /**
+     * @brief Handle a backend's acknowledgement of a cancelled copy.
+     * @param buffer The receive buffer, starting with a TaskCancelHeader.
+     * @param from The backend address.
+     */
+    void HandleCancelAck(Ptr<Packet> buffer, const Address& from);
+
+    /**
+     * @brief Ask the busiest backends to give up queued tasks to idle ones.
+     */
+    void TryStealWork();
+
+    /**
+     * @brief Handle a backend's answer to a steal request.
+     *
+     * A task given up is sent on to the idle backend the steal was for,
+     * re-serialized with a frequency hint for that backend (and none if it
+     * falls back to the busy one, which already applied its own).
+     *
+     * @param buffer The receive buffer, starting with a TaskStealHeader.
+     * @param from The backend address.
+     * @return False if the given-up task has not fully arrived yet.
+     */
+    bool HandleStealResponse(Ptr<Packet> buffer, const Address& from);
+
+    /**
+     * @brief Quarantine a backend after repeated slow responses, or lift it after a probe.
+     * @param backendIdx The backend that responded.
+     * @param taskId The task it answered.
+     * @param outlier Whether the response was an outlier.
+     */
+    void UpdateHealth(uint32_t backendIdx, uint64_t taskId, bool outlier);
+
+    /**
+     * @brief Release held work to a backend the autoscaler brought into service.
+     * @param backendIdx The backend index.
+     */
+    void HandleBackendAvailable(uint32_t backendIdx);
+
+    /**
+     * @brief Let a quarantined backend take one probe task.
+     * @param backendIdx The backend index.
+     */
+    void ProbeBackend(uint32_t backendIdx);
+
     std::unordered_map<uint64_t, DispatchedTaskInfo>
         m_dispatchedTasks;       //!< originalTaskId → dispatch info
     Cluster m_cluster;           //!< Backend cluster
@@ -472,26 +846,113 @@ class EdgeOrchestrator : public Application
         Ptr<DagTask> dag;                           //!< The DAG workflow
         Address clientAddr;                         //!< Client address for response routing
         std::map<uint64_t, uint32_t> taskToBackend; //!< originalTaskId → backendIdx
+        std::set<uint64_t> queuedTasks;             //!< Ready tasks held in the dispatch stage
         uint32_t pendingTasks{0};                   //!< Tasks dispatched but not completed
     };
 
     std::map<uint64_t, WorkloadState> m_workloads; //!< Active workloads
     uint64_t m_nextWorkloadId{1};                  //!< Next workload ID
 
-    std::map<Address, std::unordered_set<uint64_t>> m_pendingAdmissions;
+    std::map<Address, std::unordered_map<uint64_t, uint64_t>>
+        m_pendingAdmissions;         //!< Client → DAG ID → ClusterState reservation ID
+    uint64_t m_nextReservationId{1}; //!< Next ClusterState reservation ID
+
+    /**
+     * @brief An admission request held for joint evaluation.
+     */
+    struct QueuedAdmission
+    {
+        Ptr<DagTask> dag;   //!< Workload metadata
+        uint64_t id;        //!< DAG ID
+        Address clientAddr; //!< Requesting client
+    };
+
+    Time m_admissionWindow;                        //!< Joint admission window (0 = decide at once)
+    EventId m_admissionWindowEvent;                //!< End of the current admission window
+    std::vector<QueuedAdmission> m_admissionQueue; //!< Requests held for the current window
+
+    /**
+     * @brief A ready task held in the dispatch stage.
+     */
+    struct QueuedTask
+    {
+        uint64_t workloadId;    //!< Owning workload
+        Ptr<Task> task;         //!< The ready task
+        double startTag;        //!< Virtual time at which the task's service starts
+        double finishTag;       //!< Virtual time at which the task's service ends
+        int32_t backendIdx{-1}; //!< Backend chosen while held at the head (-1 = none yet)
+    };
+
+    /**
+     * @brief Dispatch queue of one client.
+     */
+    struct ClientQueue
+    {
+        std::deque<QueuedTask> tasks; //!< Ready tasks in arrival order
+        double lastFinish{0};         //!< Finish tag of the client's last queued task
+    };
+
+    uint32_t m_maxInFlight;                          //!< Tasks per backend (0 = no stage)
+    std::map<Address, ClientQueue> m_dispatchQueues; //!< Client → dispatch queue
+    std::map<Address, double> m_clientWeights;       //!< Client weights other than 1
+    double m_virtualTime{0};                         //!< Start tag of the last released task
+    uint32_t m_queuedTasks{0};                       //!< Tasks across all dispatch queues
+
+    /**
+     * @brief Released tasks waiting to be sent together.
+     */
+    struct TaskBatch
+    {
+        int32_t backendIdx{-1};                            //!< Backend of the first task
+        std::vector<std::pair<uint64_t, Ptr<Task>>> tasks; //!< (workloadId, task) pairs
+        EventId flushEvent;                                //!< End of the batch window
+    };
+
+    Time m_batchWindow;                      //!< How long a batch stays open (0 = no batching)
+    uint32_t m_maxBatchSize;                 //!< Tasks at which a batch is sent at once
+    std::map<BatchKey, TaskBatch> m_batches; //!< Open batches
+    uint32_t m_batchedTasks{0};              //!< Tasks across all open batches
+
+    double m_hedgePercentile; //!< Response-time percentile after which to hedge (0 = off)
+    uint32_t m_hedgeHistory;  //!< Response times kept per task type
+    double m_hedgeBudget;     //!< Hedges allowed per task dispatched
+    std::map<uint8_t, std::deque<Time>> m_responseTimes; //!< Recent response times by type
+
+    uint32_t m_stealThreshold;             //!< Victim load at which to steal (0 = off)
+    std::map<uint32_t, uint32_t> m_steals; //!< Victim → thief of pending steal requests
+    std::set<uint32_t> m_stealRefused;     //!< Refused a steal since last sent work
+
+    uint32_t m_quarantineAfter;                //!< Outliers in a row to quarantine (0 = off)
+    double m_outlierFactor;                    //!< Slowdown at which a response is an outlier
+    Time m_probeInterval;                      //!< Time between probes of a quarantined backend
+    std::map<uint32_t, EventId> m_probeEvents; //!< Next probe per quarantined backend
+    std::set<uint32_t> m_probing;              //!< Let back in, awaiting a probe task
+    std::map<uint32_t, uint64_t> m_probeTasks; //!< Backend → probe task awaiting its response
 
     // Statistics
     uint64_t m_workloadsAdmitted{0};  //!< Total admitted
     uint64_t m_workloadsRejected{0};  //!< Total rejected
     uint64_t m_workloadsCompleted{0}; //!< Total completed
     uint64_t m_workloadsCancelled{0}; //!< Total cancelled (client disconnect)
+    uint64_t m_tasksDispatched{0};    //!< Total tasks dispatched, not counting hedges
+    uint64_t m_tasksHedged{0};        //!< Total copies sent by hedging
+    uint64_t m_tasksStolen{0};        //!< Total tasks moved by work stealing
+    uint64_t m_quarantines{0};        //!< Total backends quarantined
 
     // Traces
     TracedCallback<uint64_t, uint32_t> m_workloadAdmittedTrace; //!< (workloadId, taskCount)
     TracedCallback<uint32_t, const std::string&> m_workloadRejectedTrace; //!< (taskCount, reason)
+    TracedCallback<uint64_t, uint32_t> m_workloadDegradedTrace;           //!< (dagId, variant)
     TracedCallback<uint64_t> m_workloadCancelledTrace;                    //!< (workloadId)
     TracedCallback<uint64_t, uint64_t, uint32_t>
-        m_taskDispatchedTrace; //!< (workloadId, taskId, backendIdx)
+        m_taskDispatchedTrace;                                 //!< (workloadId, taskId, backendIdx)
+    TracedCallback<uint32_t, uint32_t> m_batchDispatchedTrace; //!< (backendIdx, batchSize)
+    TracedCallback<uint64_t, uint64_t, uint32_t>
+        m_taskHedgedTrace; //!< (workloadId, taskId, backendIdx)
+    TracedCallback<uint64_t, uint64_t, uint32_t, uint32_t>
+        m_taskStolenTrace; //!< (workloadId, taskId, fromBackend, toBackend)
+    TracedCallback<uint32_t, bool>
+        m_backendQuarantinedTrace; //!< (backendIdx, quarantined)
     TracedCallback<uint64_t, uint64_t, uint32_t>
         m_taskCompletedTrace;                          //!< (workloadId, taskId, backendIdx)
     TracedCallback<uint64_t> m_workloadCompletedTrace; //!< (workloadId)
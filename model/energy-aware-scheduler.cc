@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#include "energy-aware-scheduler.h"
+
+#include "accelerator-pool.h"
+#include "scaling-policy.h"
+
+#include "ns3/log.h"
+#include "ns3/node.h"
+#include "ns3/simulator.h"
+#include "ns3/trace-source-accessor.h"
+
+#include <cmath>
+#include <limits>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("EnergyAwareScheduler");
+NS_OBJECT_ENSURE_REGISTERED(EnergyAwareScheduler);
+
+TypeId
+EnergyAwareScheduler::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::EnergyAwareScheduler")
+            .SetParent<EarliestFinishTimeScheduler>()
+            .SetGroupName("Distributed")
+            .AddConstructor<EnergyAwareScheduler>()
+            .AddTraceSource("EnergyEstimate",
+                            "Expected energy of each placed task",
+                            MakeTraceSourceAccessor(&EnergyAwareScheduler::m_energyEstimateTrace),
+                            "ns3::EnergyAwareScheduler::EnergyEstimateTracedCallback")
+            .AddTraceSource("EnergyOutcome",
+                            "Expected versus device-reported energy of each completed task",
+                            MakeTraceSourceAccessor(&EnergyAwareScheduler::m_energyOutcomeTrace),
+                            "ns3::EnergyAwareScheduler::EnergyOutcomeTracedCallback");
+    return tid;
+}
+
+EnergyAwareScheduler::EnergyAwareScheduler()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+EnergyAwareScheduler::~EnergyAwareScheduler()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+EnergyAwareScheduler::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    for (const auto& profile : m_profiles)
+    {
+        for (const auto& accel : profile.accelerators)
+        {
+            accel->TraceDisconnectWithoutContext(
+                "TaskEnergy",
+                MakeCallback(&EnergyAwareScheduler::TaskEnergy, this));
+        }
+    }
+    m_profiles.clear();
+    m_expected.clear();
+    EarliestFinishTimeScheduler::DoDispose();
+}
+
+void
+EnergyAwareScheduler::UpdateProfiles(const Cluster& cluster)
+{
+    if (m_profiles.size() == cluster.GetN())
+    {
+        return;
+    }
+
+    NS_LOG_FUNCTION(this);
+    m_profiles.resize(cluster.GetN());
+    for (uint32_t i = 0; i < cluster.GetN(); i++)
+    {
+        EnergyProfile& profile = m_profiles[i];
+        if (!profile.accelerators.empty())
+        {
+            continue;
+        }
+
+        // Multi-accelerator backends are commanded as one node, so the
+        // first device's OPP table stands for the whole pool.
+        Ptr<Node> node = cluster.Get(i).node;
+        if (!node)
+        {
+            continue;
+        }
+        Ptr<Accelerator> accel = node->GetObject<Accelerator>();
+        Ptr<AcceleratorPool> pool = node->GetObject<AcceleratorPool>();
+        if (accel)
+        {
+            profile.accelerators.push_back(accel);
+        }
+        else if (pool)
+        {
+            for (uint32_t d = 0; d < pool->GetN(); d++)
+            {
+                profile.accelerators.push_back(pool->Get(d));
+            }
+        }
+        if (profile.accelerators.empty())
+        {
+            continue;
+        }
+
+        Ptr<Accelerator> first = profile.accelerators.front();
+        profile.operatingPoints = first->GetOperatingPoints();
+        profile.energyModel = DynamicCast<DvfsEnergyModel>(first->GetEnergyModel());
+        profile.voltage = first->GetVoltage();
+        for (const auto& device : profile.accelerators)
+        {
+            device->TraceConnectWithoutContext(
+                "TaskEnergy",
+                MakeCallback(&EnergyAwareScheduler::TaskEnergy, this));
+        }
+    }
+}
+
+bool
+EnergyAwareScheduler::EstimateEnergy(uint32_t backendIdx,
+                                     const ClusterState::BackendState& backend,
+                                     Ptr<const Task> task,
+                                     EnergyEstimate& estimate) const
+{
+    const EnergyProfile& profile = m_profiles[backendIdx];
+    if (!profile.energyModel)
+    {
+        return false;
+    }
+
+    // The voltage is that of the OPP nearest the current clock
+    double frequency = GetFrequency(backend);
+    double voltage = profile.voltage;
+    double nearest = std::numeric_limits<double>::infinity();
+    for (const auto& opp : profile.operatingPoints)
+    {
+        if (std::abs(opp.frequency - frequency) < nearest)
+        {
+            nearest = std::abs(opp.frequency - frequency);
+            voltage = opp.voltage;
+        }
+    }
+
+    double rate = GetComputeRate(backend);
+    double bandwidth = GetMemoryBandwidth(backend);
+    double computeSeconds = rate > 0 ? task->GetComputeDemand() / rate : 0;
+    double bytes = static_cast<double>(task->GetInputSize() + task->GetOutputSize());
+    double transferSeconds = bandwidth > 0 ? bytes / bandwidth : 0;
+    double execSeconds = computeSeconds + transferSeconds;
+    double utilization = execSeconds > 0 ? computeSeconds / execSeconds : 1.0;
+
+    EnergyModel::PowerState power =
+        profile.energyModel->CalculatePower(frequency, voltage, utilization);
+    estimate.marginal = power.dynamicPower * execSeconds;
+    estimate.task = power.GetTotalPower() * execSeconds;
+    return true;
+}
+
+int32_t
+EnergyAwareScheduler::ScheduleTask(Ptr<Task> task,
+                                   const Cluster& cluster,
+                                   const ClusterState& state)
+{
+    NS_LOG_FUNCTION(this << task);
+
+    UpdateProfiles(cluster);
+
+    std::string required = task->GetRequiredAcceleratorType();
+
+    const std::vector<uint32_t>& pool = required.empty()
+                                            ? cluster.GetAvailableBackends()
+                                            : cluster.GetAvailableBackendsByType(required);
+
+    if (pool.empty())
+    {
+        NS_LOG_DEBUG("EnergyAware: no suitable backends");
+        return -1;
+    }
+
+    Time slack = task->HasDeadline() ? task->GetDeadline() - Simulator::Now() : Time::Max();
+
+    int32_t cheapestIdx = -1; // Feasible, lowest marginal energy
+    EnergyEstimate cheapest;
+    Time cheapestFinish;
+    uint32_t ties = 0;
+    int32_t fastestIdx = -1; // Earliest finish regardless of energy
+    Time fastestFinish;
+    for (uint32_t idx : pool)
+    {
+        const ClusterState::BackendState& backend = state.Get(idx);
+        Time finish = EstimateFinishTime(backend, task);
+        if (fastestIdx < 0 || finish < fastestFinish)
+        {
+            fastestIdx = static_cast<int32_t>(idx);
+            fastestFinish = finish;
+        }
+
+        EnergyEstimate estimate;
+        if (finish > slack || !EstimateEnergy(idx, backend, task, estimate))
+        {
+            continue;
+        }
+
+        // Reservoir tie-break among equally cheap and fast backends
+        if (cheapestIdx < 0 || estimate.marginal < cheapest.marginal ||
+            (estimate.marginal == cheapest.marginal && finish < cheapestFinish))
+        {
+            cheapestIdx = static_cast<int32_t>(idx);
+            cheapest = estimate;
+            cheapestFinish = finish;
+            ties = 1;
+        }
+        else if (estimate.marginal == cheapest.marginal && finish == cheapestFinish &&
+                 m_tiebreaker->GetInteger(0, ties++) == 0)
+        {
+            cheapestIdx = static_cast<int32_t>(idx);
+        }
+    }
+
+    int32_t bestIdx = cheapestIdx;
+    bool known = true;
+    if (bestIdx < 0)
+    {
+        bestIdx = fastestIdx;
+        known = EstimateEnergy(bestIdx, state.Get(bestIdx), task, cheapest);
+        NS_LOG_DEBUG("EnergyAware: no backend meets the deadline with a known energy model, "
+                     "falling back to earliest finish");
+    }
+
+    if (known)
+    {
+        m_expected[task->GetTaskId()] = {static_cast<uint32_t>(bestIdx), cheapest.task};
+        m_energyEstimateTrace(task->GetTaskId(), bestIdx, cheapest.task);
+    }
+
+    NS_LOG_DEBUG("EnergyAware: scheduled task " << task->GetTaskId() << " to backend " << bestIdx
+                                                << " (marginal=" << cheapest.marginal
+                                                << " J, expected=" << cheapest.task << " J)");
+    return bestIdx;
+}
+
+void
+EnergyAwareScheduler::NotifyTaskCompleted(uint32_t backendIdx, Ptr<Task> task)
+{
+    NS_LOG_FUNCTION(this << backendIdx << task);
+    m_expected.erase(task->GetTaskId());
+}
+
+void
+EnergyAwareScheduler::NotifyTaskCancelled(Ptr<Task> task)
+{
+    NS_LOG_FUNCTION(this << task);
+    m_expected.erase(task->GetTaskId());
+}
+
+void
+EnergyAwareScheduler::TaskEnergy(Ptr<const Task> task, double energy)
+{
+    auto it = m_expected.find(task->GetTaskId());
+    if (it == m_expected.end())
+    {
+        return;
+    }
+    NS_LOG_DEBUG("EnergyAware: task " << task->GetTaskId() << " expected " << it->second.second
+                                      << " J, actual " << energy << " J");
+    m_energyOutcomeTrace(task->GetTaskId(), it->second.first, it->second.second, energy);
+    m_expected.erase(it);
+}
+
+std::string
+EnergyAwareScheduler::GetName() const
+{
+    return "EnergyAware";
+}
+
+} // namespace ns3
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#ifndef ENERGY_AWARE_SCHEDULER_H
+#define ENERGY_AWARE_SCHEDULER_H
+
+#include "accelerator.h"
+#include "dvfs-energy-model.h"
+#include "earliest-finish-time-scheduler.h"
+
+#include "ns3/traced-callback.h"
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @ingroup distributed
+ * @brief Scheduler that places each task where it costs the least energy within its deadline.
+ *
+ * For every available backend matching the task's accelerator type,
+ * EnergyAwareScheduler estimates the task's execution time at the
+ * backend's current clock (as EarliestFinishTimeScheduler does) and the
+ * power drawn at the backend's current operating point, using the OPP
+ * table and DvfsEnergyModel of the backend's accelerator:
+ *
+ * E_marginal = P_dyn(f, V, u) * t_exec
+ *
+ * Static power is drawn whether or not the task is placed, so only the
+ * dynamic part is charged to the decision. Among the backends whose
+ * estimated finish time meets the task's deadline, the one with the
+ * lowest marginal energy wins, with earlier finish breaking ties. Tasks
+ * without a deadline treat every backend as feasible. If no backend can
+ * meet the deadline, or none has a DVFS energy model, the earliest finish
+ * wins instead.
+ *
+ * The EnergyEstimate trace reports the energy the device is expected to
+ * attribute to each placed task (static plus dynamic). The EnergyOutcome
+ * trace pairs it with the energy the device actually reported through its
+ * TaskEnergy trace, for calibrating the model.
+ */
+class EnergyAwareScheduler : public EarliestFinishTimeScheduler
+{
+  public:
+    /**
+     * @brief Get the type ID.
+     * @return The object TypeId.
+     */
+    static TypeId GetTypeId();
+
+    EnergyAwareScheduler();
+    ~EnergyAwareScheduler() override;
+
+    /**
+     * @brief Select the lowest-energy backend that meets the task's deadline.
+     *
+     * @param task The task to schedule.
+     * @param cluster The cluster of backends.
+     * @param state Per-backend load state.
+     * @return Backend index, or -1 if no suitable backend.
+     */
+    int32_t ScheduleTask(Ptr<Task> task,
+                         const Cluster& cluster,
+                         const ClusterState& state) override;
+
+    /**
+     * @brief Forget the estimate of a completed task.
+     * @param backendIdx The backend index where the task completed.
+     * @param task The task that completed.
+     */
+    void NotifyTaskCompleted(uint32_t backendIdx, Ptr<Task> task) override;
+
+    /**
+     * @brief Forget the estimate of a cancelled task.
+     * @param task The task that was cancelled.
+     */
+    void NotifyTaskCancelled(Ptr<Task> task) override;
+
+    /**
+     * @brief Get the scheduler name.
+     * @return "EnergyAware"
+     */
+    std::string GetName() const override;
+
+    /**
+     * @brief TracedCallback signature for energy estimates.
+     * @param taskId The placed task.
+     * @param backendIdx The chosen backend.
+     * @param expected Expected task energy in Joules.
+     */
+    typedef void (*EnergyEstimateTracedCallback)(uint64_t taskId,
+                                                 uint32_t backendIdx,
+                                                 double expected);
+
+    /**
+     * @brief TracedCallback signature for expected-versus-actual energy.
+     * @param taskId The completed task.
+     * @param backendIdx The backend that ran it.
+     * @param expected Expected task energy in Joules.
+     * @param actual Energy reported by the device in Joules.
+     */
+    typedef void (*EnergyOutcomeTracedCallback)(uint64_t taskId,
+                                                uint32_t backendIdx,
+                                                double expected,
+                                                double actual);
+
+  protected:
+    void DoDispose() override;
+
+  private:
+    /**
+     * @brief Power characteristics of a backend's accelerator.
+     */
+    struct EnergyProfile
+    {
+        std::vector<Ptr<Accelerator>> accelerators;  //!< Devices whose task energy is traced
+        std::vector<OperatingPoint> operatingPoints; //!< OPP table of the first device
+        Ptr<DvfsEnergyModel> energyModel;            //!< DVFS model (null = unknown)
+        double voltage{0};                           //!< Voltage when no OPP table is known
+    };
+
+    /**
+     * @brief Energy a task is expected to cost on a backend.
+     */
+    struct EnergyEstimate
+    {
+        double marginal{0}; //!< Dynamic energy in Joules
+        double task{0};     //!< Static plus dynamic energy attributed to the task in Joules
+    };
+
+    /**
+     * @brief Look up the accelerators of every backend, once per cluster size.
+     * @param cluster The cluster of backends.
+     */
+    void UpdateProfiles(const Cluster& cluster);
+
+    /**
+     * @brief Estimate the energy a task would cost on a backend at its current OPP.
+     * @param backendIdx The backend index.
+     * @param backend The backend's state.
+     * @param task The task to place.
+     * @param estimate Receives the estimate.
+     * @return False if the backend has no DVFS energy model.
+     */
+    bool EstimateEnergy(uint32_t backendIdx,
+                        const ClusterState::BackendState& backend,
+                        Ptr<const Task> task,
+                        EnergyEstimate& estimate) const;
+
+    /**
+     * @brief Handle a device's per-task energy report.
+     * @param task The completed task.
+     * @param energy Energy consumed in Joules.
+     */
+    void TaskEnergy(Ptr<const Task> task, double energy);
+
+    std::vector<EnergyProfile> m_profiles; //!< Per-backend energy profiles
+    std::map<uint64_t, std::pair<uint32_t, double>>
+        m_expected; //!< Task ID → (backend, expected energy) for placed tasks
+
+    TracedCallback<uint64_t, uint32_t, double> m_energyEstimateTrace; //!< Estimate at placement
+    TracedCallback<uint64_t, uint32_t, double, double>
+        m_energyOutcomeTrace; //!< Expected versus actual energy at completion
+};
+
+} // namespace ns3
+
+#endif // ENERGY_AWARE_SCHEDULER_H
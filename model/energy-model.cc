@@ -10,6 +10,8 @@
 
 #include "ns3/log.h"
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -34,10 +36,51 @@ EnergyModel::~EnergyModel()
     NS_LOG_FUNCTION(this);
 }
 
+EnergyModel::PowerState
+EnergyModel::CalculateIdleStatePower(Ptr<Accelerator> accelerator, uint32_t state)
+{
+    NS_LOG_FUNCTION(this << accelerator << state);
+    if (state == 0)
+    {
+        return CalculateIdlePower(accelerator);
+    }
+    return PowerState(GetIdleState(state).staticPower, 0.0);
+}
+
+void
+EnergyModel::AddIdleState(Time residency, double staticPower, Time wakeLatency)
+{
+    NS_LOG_FUNCTION(this << residency << staticPower << wakeLatency);
+    NS_ASSERT_MSG(residency.IsStrictlyPositive(), "Idle state residency must be positive");
+    IdleState idle{residency, staticPower, wakeLatency};
+    auto it = std::lower_bound(
+        m_idleStates.begin(),
+        m_idleStates.end(),
+        idle,
+        [](const IdleState& a, const IdleState& b) { return a.residency < b.residency; });
+    m_idleStates.insert(it, idle);
+}
+
+uint32_t
+EnergyModel::GetNIdleStates() const
+{
+    return static_cast<uint32_t>(m_idleStates.size()) + 1;
+}
+
+const EnergyModel::IdleState&
+EnergyModel::GetIdleState(uint32_t state) const
+{
+    NS_ASSERT_MSG(state >= 1 && state <= m_idleStates.size(),
+                  "Deep idle state " << state << " out of range (count=" << m_idleStates.size()
+                                     << ")");
+    return m_idleStates[state - 1];
+}
+
 void
 EnergyModel::DoDispose()
 {
     NS_LOG_FUNCTION(this);
+    m_idleStates.clear();
     Object::DoDispose();
 }
 
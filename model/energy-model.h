@@ -9,9 +9,12 @@
 #ifndef ENERGY_MODEL_H
 #define ENERGY_MODEL_H
 
+#include "ns3/nstime.h"
 #include "ns3/object.h"
 #include "ns3/ptr.h"
 
+#include <vector>
+
 namespace ns3
 {
 
@@ -28,6 +31,10 @@ class Accelerator;
  * - Static power: Always consumed when the device is powered on
  * - Dynamic power: Consumed during active computation
  *
+ * Optional deep idle states lower static power once the accelerator has
+ * been idle for a residency threshold, at the cost of a wake-up latency
+ * paid by the next task.
+ *
  * Example usage:
  * @code
  * Ptr<DvfsEnergyModel> energy = CreateObject<DvfsEnergyModel>();
@@ -85,6 +92,19 @@ class EnergyModel : public Object
         }
     };
 
+    /**
+     * @brief A deep idle (power-gated) state.
+     *
+     * Idle state 0 is the shallow idle reported by CalculateIdlePower();
+     * deep states are numbered from 1 in order of increasing residency.
+     */
+    struct IdleState
+    {
+        Time residency;     //!< Idle time before the state is entered
+        double staticPower; //!< Static power while in the state in Watts
+        Time wakeLatency;   //!< Time to return to the active state
+    };
+
     /**
      * @brief Get the type ID.
      * @return The object TypeId.
@@ -118,6 +138,42 @@ class EnergyModel : public Object
      */
     virtual PowerState CalculateActivePower(Ptr<Accelerator> accelerator, double utilization) = 0;
 
+    /**
+     * @brief Calculate power consumption in a given idle state.
+     *
+     * Default implementation returns CalculateIdlePower() for state 0 and
+     * the configured static power for deeper states.
+     *
+     * @param accelerator The accelerator to calculate idle power for.
+     * @param state The idle state index (0 = shallow idle).
+     * @return PowerState with idle power values.
+     */
+    virtual PowerState CalculateIdleStatePower(Ptr<Accelerator> accelerator, uint32_t state);
+
+    /**
+     * @brief Add a deep idle state.
+     *
+     * States are kept sorted by residency ascending.
+     *
+     * @param residency Idle time before the state is entered.
+     * @param staticPower Static power while in the state in Watts.
+     * @param wakeLatency Time to return to the active state.
+     */
+    void AddIdleState(Time residency, double staticPower, Time wakeLatency);
+
+    /**
+     * @brief Get the number of idle states, including shallow idle.
+     * @return 1 plus the number of deep idle states.
+     */
+    uint32_t GetNIdleStates() const;
+
+    /**
+     * @brief Get a deep idle state.
+     * @param state The idle state index (1-based; 0 is shallow idle).
+     * @return The idle state parameters.
+     */
+    const IdleState& GetIdleState(uint32_t state) const;
+
     /**
      * @brief Get the name of this energy model.
      *
@@ -127,6 +183,9 @@ class EnergyModel : public Object
 
   protected:
     void DoDispose() override;
+
+  private:
+    std::vector<IdleState> m_idleStates; //!< Deep idle states sorted by residency
 };
 
 } // namespace ns3
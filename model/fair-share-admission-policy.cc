@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#include "fair-share-admission-policy.h"
+
+#include "dag-task.h"
+
+#include "ns3/double.h"
+#include "ns3/log.h"
+#include "ns3/pointer.h"
+#include "ns3/simulator.h"
+#include "ns3/trace-source-accessor.h"
+
+#include <algorithm>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("FairShareAdmissionPolicy");
+NS_OBJECT_ENSURE_REGISTERED(FairShareAdmissionPolicy);
+
+TypeId
+FairShareAdmissionPolicy::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::FairShareAdmissionPolicy")
+            .SetParent<AdmissionPolicy>()
+            .SetGroupName("Distributed")
+            .AddConstructor<FairShareAdmissionPolicy>()
+            .AddAttribute("InnerPolicy",
+                          "Policy that must also admit each workload (nullptr = admit)",
+                          PointerValue(),
+                          MakePointerAccessor(&FairShareAdmissionPolicy::m_inner),
+                          MakePointerChecker<AdmissionPolicy>())
+            .AddAttribute("Rate",
+                          "Admission rate in tasks/s, shared among active clients by weight",
+                          DoubleValue(100.0),
+                          MakeDoubleAccessor(&FairShareAdmissionPolicy::m_rate),
+                          MakeDoubleChecker<double>(0.0))
+            .AddAttribute("Burst",
+                          "Token bucket depth in tasks per unit of client weight",
+                          DoubleValue(10.0),
+                          MakeDoubleAccessor(&FairShareAdmissionPolicy::m_burst),
+                          MakeDoubleChecker<double>(0.0))
+            .AddAttribute("ActiveWindow",
+                          "Time since its last request for which a client shares the rate",
+                          TimeValue(Seconds(1)),
+                          MakeTimeAccessor(&FairShareAdmissionPolicy::m_activeWindow),
+                          MakeTimeChecker(Seconds(0)))
+            .AddTraceSource("Throttled",
+                            "A workload was rejected because its client exceeded its share",
+                            MakeTraceSourceAccessor(&FairShareAdmissionPolicy::m_throttledTrace),
+                            "ns3::FairShareAdmissionPolicy::ThrottledTracedCallback");
+    return tid;
+}
+
+FairShareAdmissionPolicy::FairShareAdmissionPolicy()
+    : m_inner(nullptr),
+      m_rate(100.0),
+      m_burst(10.0),
+      m_activeWindow(Seconds(1))
+{
+    NS_LOG_FUNCTION(this);
+}
+
+FairShareAdmissionPolicy::~FairShareAdmissionPolicy()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+FairShareAdmissionPolicy::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    m_inner = nullptr;
+    m_buckets.clear();
+    m_weights.clear();
+    AdmissionPolicy::DoDispose();
+}
+
+bool
+FairShareAdmissionPolicy::ShouldAdmit(Ptr<DagTask> dag,
+                                      const Cluster& cluster,
+                                      const ClusterState& state)
+{
+    NS_LOG_FUNCTION(this << dag->GetTaskCount());
+    return !m_inner || m_inner->ShouldAdmit(dag, cluster, state);
+}
+
+bool
+FairShareAdmissionPolicy::ShouldAdmitFrom(const Address& client,
+                                          Ptr<DagTask> dag,
+                                          const Cluster& cluster,
+                                          const ClusterState& state)
+{
+    NS_LOG_FUNCTION(this << client << dag->GetTaskCount());
+    return !m_inner || m_inner->ShouldAdmitFrom(client, dag, cluster, state);
+}
+
+bool
+FairShareAdmissionPolicy::CheckClient(const Address& client, Ptr<DagTask> dag)
+{
+    NS_LOG_FUNCTION(this << client << dag->GetTaskCount());
+
+    Time now = Simulator::Now();
+    double weight = GetWeight(client);
+
+    // Idle clients leave the share; the requesting client is kept to refill it
+    double totalWeight = 0;
+    for (auto it = m_buckets.begin(); it != m_buckets.end();)
+    {
+        if (it->first != client && now - it->second.lastSeen > m_activeWindow)
+        {
+            it = m_buckets.erase(it);
+            continue;
+        }
+        totalWeight += GetWeight(it->first);
+        ++it;
+    }
+
+    auto [it, inserted] = m_buckets.try_emplace(client);
+    Bucket& bucket = it->second;
+    double depth = m_burst * weight;
+    if (inserted || now - bucket.lastSeen > m_activeWindow)
+    {
+        bucket.tokens = depth;
+        totalWeight += inserted ? weight : 0;
+    }
+    else
+    {
+        double share = m_rate * weight / totalWeight;
+        bucket.tokens =
+            std::min(depth, bucket.tokens + (now - bucket.lastSeen).GetSeconds() * share);
+    }
+    bucket.lastSeen = now;
+
+    // Workloads larger than the bucket are admitted from a full one
+    double cost = dag->GetTaskCount();
+    if (bucket.tokens < std::min(cost, depth))
+    {
+        NS_LOG_DEBUG("FairShare: throttling " << cost << " tasks from " << client << " with "
+                                              << bucket.tokens << " tokens");
+        m_throttledTrace(client, bucket.tokens);
+        return false;
+    }
+
+    return !m_inner || m_inner->CheckClient(client, dag);
+}
+
+void
+FairShareAdmissionPolicy::NotifyAdmitted(const Address& client, Ptr<DagTask> dag)
+{
+    NS_LOG_FUNCTION(this << client << dag->GetTaskCount());
+
+    auto it = m_buckets.find(client);
+    if (it != m_buckets.end())
+    {
+        it->second.tokens -= dag->GetTaskCount();
+    }
+    if (m_inner)
+    {
+        m_inner->NotifyAdmitted(client, dag);
+    }
+}
+
+const std::vector<int32_t>&
+FairShareAdmissionPolicy::GetPlacement() const
+{
+    return m_inner ? m_inner->GetPlacement() : AdmissionPolicy::GetPlacement();
+}
+
+std::string
+FairShareAdmissionPolicy::GetName() const
+{
+    return "FairShare";
+}
+
+void
+FairShareAdmissionPolicy::SetWeight(const Address& client, double weight)
+{
+    NS_LOG_FUNCTION(this << client << weight);
+    NS_ASSERT_MSG(weight > 0, "Client weight must be positive");
+    m_weights[client] = weight;
+}
+
+double
+FairShareAdmissionPolicy::GetWeight(const Address& client) const
+{
+    auto it = m_weights.find(client);
+    return it != m_weights.end() ? it->second : 1.0;
+}
+
+double
+FairShareAdmissionPolicy::GetTokens(const Address& client) const
+{
+    auto it = m_buckets.find(client);
+    return it != m_buckets.end() ? it->second.tokens : 0.0;
+}
+
+} // namespace ns3
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#ifndef FAIR_SHARE_ADMISSION_POLICY_H
+#define FAIR_SHARE_ADMISSION_POLICY_H
+
+#include "admission-policy.h"
+
+#include "ns3/address.h"
+#include "ns3/nstime.h"
+#include "ns3/traced-callback.h"
+
+#include <map>
+
+namespace ns3
+{
+
+/**
+ * @ingroup distributed
+ * @brief Admission policy that rate-limits each client to a weighted share.
+ *
+ * Every client, keyed by its address, has a token bucket of tasks. The
+ * admission Rate is shared among the clients active within ActiveWindow
+ * in proportion to their weights, so a client alone may use all of it
+ * while a burst from one client cannot take the share of the others:
+ *
+ * refill_c = Rate * w_c / sum(w_active)
+ *
+ * A bucket holds at most Burst * w_c tokens and a workload costs one token
+ * per task. CheckClient() throttles a request whose client has too few
+ * tokens, once per request; ShouldAdmitFrom() then defers to the inner
+ * policy, if any, for the workload and each variant tried; and only
+ * NotifyAdmitted() takes the tokens of the workload finally admitted. A
+ * workload larger than the bucket can still be admitted from a full
+ * bucket, leaving it in debt until refilled. Clients idle for longer than
+ * ActiveWindow drop out of the share and return with a full bucket.
+ *
+ * Clients weigh 1 unless given another weight with SetWeight().
+ */
+class FairShareAdmissionPolicy : public AdmissionPolicy
+{
+  public:
+    /**
+     * @brief Get the type ID.
+     * @return The object TypeId.
+     */
+    static TypeId GetTypeId();
+
+    FairShareAdmissionPolicy();
+    ~FairShareAdmissionPolicy() override;
+
+    /**
+     * @brief Admit an anonymous workload through the inner policy only.
+     *
+     * @param dag The workload DAG
+     * @param cluster Current cluster state
+     * @param state Per-backend load and device metrics
+     * @return The inner policy's decision (true if there is none)
+     */
+    bool ShouldAdmit(Ptr<DagTask> dag, const Cluster& cluster, const ClusterState& state) override;
+
+    /**
+     * @brief Admit a client's workload through the inner policy only.
+     *
+     * Tokens are checked by CheckClient() and taken by NotifyAdmitted().
+     *
+     * @param client Address of the requesting client
+     * @param dag The workload DAG
+     * @param cluster Current cluster state
+     * @param state Per-backend load and device metrics
+     * @return The inner policy's decision (true if there is none)
+     */
+    bool ShouldAdmitFrom(const Address& client,
+                         Ptr<DagTask> dag,
+                         const Cluster& cluster,
+                         const ClusterState& state) override;
+
+    /**
+     * @brief Refill the client's bucket and throttle it if short of tokens.
+     *
+     * @param client Address of the requesting client
+     * @param dag The workload DAG as requested
+     * @return true if the client has the tokens and the inner policy accepts it
+     */
+    bool CheckClient(const Address& client, Ptr<DagTask> dag) override;
+
+    /**
+     * @brief Take the admitted workload's tokens from the client's bucket.
+     * @param client Address of the requesting client
+     * @param dag The admitted workload DAG
+     */
+    void NotifyAdmitted(const Address& client, Ptr<DagTask> dag) override;
+
+    /**
+     * @brief Get the placement planned by the inner policy.
+     * @return Backend index per DAG task, or empty.
+     */
+    const std::vector<int32_t>& GetPlacement() const override;
+
+    /**
+     * @brief Get the policy name.
+     * @return "FairShare"
+     */
+    std::string GetName() const override;
+
+    /**
+     * @brief Set a client's weight.
+     * @param client The client address.
+     * @param weight The client's share relative to other clients (> 0).
+     */
+    void SetWeight(const Address& client, double weight);
+
+    /**
+     * @brief Get a client's weight.
+     * @param client The client address.
+     * @return The weight set with SetWeight(), or 1.
+     */
+    double GetWeight(const Address& client) const;
+
+    /**
+     * @brief Get the tokens in a client's bucket as of its last request.
+     * @param client The client address.
+     * @return Tokens (negative = in debt), or 0 for unknown clients.
+     */
+    double GetTokens(const Address& client) const;
+
+    /**
+     * @brief TracedCallback signature for throttled workloads.
+     * @param client The client whose workload was rejected.
+     * @param tokens Tokens left in the client's bucket.
+     */
+    typedef void (*ThrottledTracedCallback)(const Address& client, double tokens);
+
+  protected:
+    void DoDispose() override;
+
+  private:
+    /**
+     * @brief Token bucket of a client.
+     */
+    struct Bucket
+    {
+        double tokens{0}; //!< Tasks the client may still submit
+        Time lastSeen;    //!< Time of the client's last request
+    };
+
+    Ptr<AdmissionPolicy> m_inner;        //!< Policy applied within the share (null = admit)
+    double m_rate;                       //!< Admission rate in tasks/s shared by active clients
+    double m_burst;                      //!< Bucket depth in tasks per unit of weight
+    Time m_activeWindow;                 //!< How long a client counts towards the share
+    std::map<Address, Bucket> m_buckets; //!< Per-client token buckets
+    std::map<Address, double> m_weights; //!< Client weights other than 1
+
+    TracedCallback<const Address&, double> m_throttledTrace; //!< Workload rejected for rate
+};
+
+} // namespace ns3
+
+#endif // FAIR_SHARE_ADMISSION_POLICY_H
@@ -10,6 +10,8 @@
 
 #include "ns3/log.h"
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -49,7 +51,7 @@ void
 FifoQueueScheduler::Enqueue(Ptr<Task> task)
 {
     NS_LOG_FUNCTION(this << task);
-    m_queue.push(task);
+    m_queue.push_back(task);
     NS_LOG_DEBUG("Enqueued task " << task->GetTaskId() << ", queue length: " << m_queue.size());
 }
 
@@ -65,7 +67,7 @@ FifoQueueScheduler::Dequeue()
     }
 
     Ptr<Task> task = m_queue.front();
-    m_queue.pop();
+    m_queue.pop_front();
     NS_LOG_DEBUG("Dequeued task " << task->GetTaskId() << ", queue length: " << m_queue.size());
     return task;
 }
@@ -83,6 +85,41 @@ FifoQueueScheduler::Peek() const
     return m_queue.front();
 }
 
+Ptr<Task>
+FifoQueueScheduler::RemoveLast()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (m_queue.empty())
+    {
+        return nullptr;
+    }
+
+    Ptr<Task> task = m_queue.back();
+    m_queue.pop_back();
+    NS_LOG_DEBUG("Removed task " << task->GetTaskId() << ", queue length: " << m_queue.size());
+    return task;
+}
+
+Ptr<Task>
+FifoQueueScheduler::Remove(uint64_t taskId)
+{
+    NS_LOG_FUNCTION(this << taskId);
+
+    auto it = std::find_if(m_queue.begin(), m_queue.end(), [taskId](const Ptr<Task>& task) {
+        return task->GetTaskId() == taskId;
+    });
+    if (it == m_queue.end())
+    {
+        return nullptr;
+    }
+
+    Ptr<Task> task = *it;
+    m_queue.erase(it);
+    NS_LOG_DEBUG("Removed task " << taskId << ", queue length: " << m_queue.size());
+    return task;
+}
+
 bool
 FifoQueueScheduler::IsEmpty() const
 {
@@ -105,10 +142,7 @@ void
 FifoQueueScheduler::Clear()
 {
     NS_LOG_FUNCTION(this);
-    while (!m_queue.empty())
-    {
-        m_queue.pop();
-    }
+    m_queue.clear();
 }
 
 } // namespace ns3
@@ -11,7 +11,7 @@
 
 #include "queue-scheduler.h"
 
-#include <queue>
+#include <deque>
 
 namespace ns3
 {
@@ -61,6 +61,8 @@ class FifoQueueScheduler : public QueueScheduler
     void Enqueue(Ptr<Task> task) override;
     Ptr<Task> Dequeue() override;
     Ptr<Task> Peek() const override;
+    Ptr<Task> RemoveLast() override;
+    Ptr<Task> Remove(uint64_t taskId) override;
     bool IsEmpty() const override;
     uint32_t GetLength() const override;
     std::string GetName() const override;
@@ -70,7 +72,7 @@ class FifoQueueScheduler : public QueueScheduler
     void DoDispose() override;
 
   private:
-    std::queue<Ptr<Task>> m_queue; //!< Internal FIFO queue
+    std::deque<Ptr<Task>> m_queue; //!< Internal FIFO queue
 };
 
 } // namespace ns3
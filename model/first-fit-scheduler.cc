@@ -55,20 +55,21 @@ FirstFitScheduler::ScheduleTask(Ptr<Task> task,
 
     if (required.empty())
     {
-        uint32_t n = cluster.GetN();
-        if (n == 0)
+        const std::vector<uint32_t>& available = cluster.GetAvailableBackends();
+        if (available.empty())
         {
-            NS_LOG_DEBUG("FirstFit: no backends in cluster");
+            NS_LOG_DEBUG("FirstFit: no available backends in cluster");
             return -1;
         }
         uint32_t& nextIdx = m_nextIndexByType[""];
-        uint32_t idx = nextIdx % n;
-        nextIdx = (idx + 1) % n;
+        uint32_t pos = nextIdx % available.size();
+        nextIdx = (pos + 1) % available.size();
+        uint32_t idx = available[pos];
         NS_LOG_DEBUG("FirstFit: scheduled task " << task->GetTaskId() << " to backend " << idx);
         return static_cast<int32_t>(idx);
     }
 
-    const std::vector<uint32_t>& candidates = cluster.GetBackendsByType(required);
+    const std::vector<uint32_t>& candidates = cluster.GetAvailableBackendsByType(required);
     if (candidates.empty())
     {
         NS_LOG_DEBUG("FirstFit: no backend matches required accelerator '" << required << "'");
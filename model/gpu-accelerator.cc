@@ -9,10 +9,14 @@
 #include "gpu-accelerator.h"
 
 #include "ns3/double.h"
+#include "ns3/enum.h"
 #include "ns3/log.h"
 #include "ns3/pointer.h"
 #include "ns3/simulator.h"
 #include "ns3/trace-source-accessor.h"
+#include "ns3/uinteger.h"
+
+#include <algorithm>
 
 namespace ns3
 {
@@ -23,44 +27,71 @@ NS_OBJECT_ENSURE_REGISTERED(GpuAccelerator);
 TypeId
 GpuAccelerator::GetTypeId()
 {
-    static TypeId tid = TypeId("ns3::GpuAccelerator")
-                            .SetParent<Accelerator>()
-                            .SetGroupName("Distributed")
-                            .AddConstructor<GpuAccelerator>()
-                            .AddAttribute("ComputeRate",
-                                          "Compute rate in FLOPS (must be > 0)",
-                                          DoubleValue(1e12),
-                                          MakeDoubleAccessor(&GpuAccelerator::m_computeRate),
-                                          MakeDoubleChecker<double>(1.0))
-                            .AddAttribute("MemoryBandwidth",
-                                          "Memory bandwidth in bytes/sec (must be > 0)",
-                                          DoubleValue(900e9),
-                                          MakeDoubleAccessor(&GpuAccelerator::m_memoryBandwidth),
-                                          MakeDoubleChecker<double>(1.0))
-                            .AddAttribute("ProcessingModel",
-                                          "Processing model for timing calculation",
-                                          PointerValue(),
-                                          MakePointerAccessor(&GpuAccelerator::m_processingModel),
-                                          MakePointerChecker<ProcessingModel>())
-                            .AddAttribute("QueueScheduler",
-                                          "Queue scheduler for task management",
-                                          PointerValue(),
-                                          MakePointerAccessor(&GpuAccelerator::m_queueScheduler),
-                                          MakePointerChecker<QueueScheduler>())
-                            .AddAttribute("Frequency",
-                                          "Operating frequency in Hz",
-                                          DoubleValue(1.5e9),
-                                          MakeDoubleAccessor(&GpuAccelerator::m_frequency),
-                                          MakeDoubleChecker<double>(1.0))
-                            .AddAttribute("Voltage",
-                                          "Operating voltage in Volts",
-                                          DoubleValue(1.0),
-                                          MakeDoubleAccessor(&GpuAccelerator::m_voltage),
-                                          MakeDoubleChecker<double>(0.01))
-                            .AddTraceSource("QueueLength",
-                                            "Current number of tasks in queue",
-                                            MakeTraceSourceAccessor(&GpuAccelerator::m_queueLength),
-                                            "ns3::TracedValueCallback::Uint32");
+    static TypeId tid =
+        TypeId("ns3::GpuAccelerator")
+            .SetParent<Accelerator>()
+            .SetGroupName("Distributed")
+            .AddConstructor<GpuAccelerator>()
+            .AddAttribute("ComputeRate",
+                          "Compute rate in FLOPS (must be > 0)",
+                          DoubleValue(1e12),
+                          MakeDoubleAccessor(&GpuAccelerator::m_computeRate),
+                          MakeDoubleChecker<double>(1.0))
+            .AddAttribute("MemoryBandwidth",
+                          "Memory bandwidth in bytes/sec (must be > 0)",
+                          DoubleValue(900e9),
+                          MakeDoubleAccessor(&GpuAccelerator::m_memoryBandwidth),
+                          MakeDoubleChecker<double>(1.0))
+            .AddAttribute("ProcessingModel",
+                          "Processing model for timing calculation",
+                          PointerValue(),
+                          MakePointerAccessor(&GpuAccelerator::m_processingModel),
+                          MakePointerChecker<ProcessingModel>())
+            .AddAttribute("QueueScheduler",
+                          "Queue scheduler for task management",
+                          PointerValue(),
+                          MakePointerAccessor(&GpuAccelerator::m_queueScheduler),
+                          MakePointerChecker<QueueScheduler>())
+            .AddAttribute("Frequency",
+                          "Operating frequency in Hz",
+                          DoubleValue(1.5e9),
+                          MakeDoubleAccessor(&GpuAccelerator::m_frequency),
+                          MakeDoubleChecker<double>(1.0))
+            .AddAttribute("Voltage",
+                          "Operating voltage in Volts",
+                          DoubleValue(1.0),
+                          MakeDoubleAccessor(&GpuAccelerator::m_voltage),
+                          MakeDoubleChecker<double>(0.01))
+            .AddAttribute("MemoryCapacity",
+                          "Device memory available for model weights in bytes",
+                          UintegerValue(80000000000),
+                          MakeUintegerAccessor(&GpuAccelerator::m_memoryCapacity),
+                          MakeUintegerChecker<uint64_t>())
+            .AddAttribute("WeightLoadBandwidth",
+                          "Host-to-device model weight transfer rate in bytes/sec",
+                          DoubleValue(25e9),
+                          MakeDoubleAccessor(&GpuAccelerator::m_weightLoadBandwidth),
+                          MakeDoubleChecker<double>(1.0))
+            .AddAttribute("TransitionMode",
+                          "Behaviour while a DVFS transition settles",
+                          EnumValue(GpuAccelerator::STALL),
+                          MakeEnumAccessor<TransitionMode>(&GpuAccelerator::m_transitionMode),
+                          MakeEnumChecker(GpuAccelerator::STALL,
+                                          "Stall",
+                                          GpuAccelerator::LOWER_CLOCK,
+                                          "LowerClock"))
+            .AddTraceSource("QueueLength",
+                            "Current number of tasks in queue",
+                            MakeTraceSourceAccessor(&GpuAccelerator::m_queueLength),
+                            "ns3::TracedValueCallback::Uint32")
+            .AddTraceSource("ModelLoaded",
+                            "Model weights were loaded into device memory",
+                            MakeTraceSourceAccessor(&GpuAccelerator::m_modelLoadedTrace),
+                            "ns3::GpuAccelerator::ModelLoadedTracedCallback")
+            .AddTraceSource("ModelEvicted",
+                            "Model weights were evicted from device memory",
+                            MakeTraceSourceAccessor(&GpuAccelerator::m_modelEvictedTrace),
+                            "ns3::GpuAccelerator::ModelEvictedTracedCallback");
     return tid;
 }
 
@@ -71,8 +102,19 @@ GpuAccelerator::GpuAccelerator()
       m_voltage(1.0),
       m_processingModel(nullptr),
       m_queueScheduler(nullptr),
+      m_memoryCapacity(80000000000),
+      m_weightLoadBandwidth(25e9),
+      m_transitionMode(STALL),
+      m_memoryUsed(0),
       m_currentTask(nullptr),
       m_currentUtilization(0.0),
+      m_loadingModel(false),
+      m_busyTime(Seconds(0)),
+      m_busyStart(Seconds(-1)),
+      m_transitioning(false),
+      m_targetFrequency(1.5e9),
+      m_stalled(false),
+      m_stalledWork(false),
       m_queueLength(0)
 {
     NS_LOG_FUNCTION(this);
@@ -88,6 +130,8 @@ GpuAccelerator::DoDispose()
 {
     NS_LOG_FUNCTION(this);
     Simulator::Cancel(m_currentEvent);
+    Simulator::Cancel(m_transitionEvent);
+    Simulator::Cancel(m_wakeEvent);
     m_currentTask = nullptr;
     m_processingModel = nullptr;
     if (m_queueScheduler)
@@ -95,6 +139,9 @@ GpuAccelerator::DoDispose()
         m_queueScheduler->Clear();
         m_queueScheduler = nullptr;
     }
+    m_modelLru.clear();
+    m_residentModels.clear();
+    m_memoryUsed = 0;
     Accelerator::DoDispose();
 }
 
@@ -122,8 +169,14 @@ GpuAccelerator::SubmitTask(Ptr<Task> task)
 
     NS_LOG_DEBUG("Task " << task->GetTaskId() << " submitted, queue length: " << m_queueLength);
 
-    if (!m_currentTask)
+    if (!m_currentTask && !m_wakeEvent.IsPending())
     {
+        Time wakeLatency = WakeFromIdle();
+        if (wakeLatency.IsStrictlyPositive())
+        {
+            m_wakeEvent = Simulator::Schedule(wakeLatency, &GpuAccelerator::StartNextTask, this);
+            return;
+        }
         StartNextTask();
     }
 }
@@ -158,12 +211,30 @@ GpuAccelerator::StartNextTask()
             continue;
         }
 
+        Time loadTime;
+        if (!LoadModel(m_currentTask, loadTime))
+        {
+            NS_LOG_ERROR("Model " << m_currentTask->GetModelId() << " does not fit in "
+                                  << m_memoryCapacity << " bytes of device memory");
+            m_currentTask->SetState(TASK_FAILED);
+            m_taskFailedTrace(m_currentTask, "Model exceeds device memory capacity");
+            m_currentTask = nullptr;
+            m_queueLength = m_queueScheduler->GetLength();
+            continue;
+        }
+
         m_taskStartTime = Simulator::Now();
-        m_currentUtilization = result.utilization;
+        if (m_busyStart.IsStrictlyNegative())
+        {
+            m_busyStart = m_taskStartTime;
+        }
+        m_loadingModel = loadTime.IsStrictlyPositive();
+        // Weight transfer keeps the device active without computing
+        m_currentUtilization = m_loadingModel ? 0.0 : result.utilization;
 
         NS_LOG_INFO("Starting task " << m_currentTask->GetTaskId() << " at " << Simulator::Now());
 
-        UpdateEnergyState(true, m_currentUtilization);
+        UpdateEnergyState(true, m_stalled ? 0.0 : m_currentUtilization);
         RecordTaskStartEnergy();
 
         m_currentTask->SetState(TASK_RUNNING);
@@ -171,16 +242,117 @@ GpuAccelerator::StartNextTask()
 
         m_queueLength = m_queueScheduler->GetLength() + 1;
 
+        if (m_loadingModel)
+        {
+            NS_LOG_DEBUG("Cold start, loading model " << m_currentTask->GetModelId() << " for "
+                                                      << loadTime);
+            m_currentEvent =
+                Simulator::Schedule(loadTime, &GpuAccelerator::ModelLoadComplete, this);
+            return;
+        }
+
         NS_LOG_DEBUG("Processing time: " << result.processingTime);
-        m_currentEvent =
-            Simulator::Schedule(result.processingTime, &GpuAccelerator::ProcessingComplete, this);
+        ScheduleProcessing(result.processingTime);
         return;
     }
 
     m_currentTask = nullptr;
+    if (!m_busyStart.IsStrictlyNegative())
+    {
+        m_busyTime += Simulator::Now() - m_busyStart;
+        m_busyStart = Seconds(-1);
+    }
     UpdateEnergyState(false, 0.0);
 }
 
+void
+GpuAccelerator::ModelLoadComplete()
+{
+    NS_LOG_FUNCTION(this);
+
+    m_loadingModel = false;
+
+    // Recompute at the current frequency, which may have changed during the load
+    ProcessingModel::Result result = m_processingModel->Process(m_currentTask, this);
+    if (!result.success)
+    {
+        NS_LOG_ERROR("ProcessingModel failed for task " << m_currentTask->GetTaskId());
+        UpdateEnergyState(false, 0.0);
+        m_currentTask->SetState(TASK_FAILED);
+        m_taskFailedTrace(m_currentTask, "ProcessingModel returned failure");
+        m_currentTask = nullptr;
+        m_queueLength = m_queueScheduler->GetLength();
+        StartNextTask();
+        return;
+    }
+
+    m_currentUtilization = result.utilization;
+    UpdateEnergyState(true, m_stalled ? 0.0 : m_currentUtilization);
+
+    NS_LOG_DEBUG("Processing time: " << result.processingTime);
+    ScheduleProcessing(result.processingTime);
+}
+
+void
+GpuAccelerator::ScheduleProcessing(Time processingTime)
+{
+    NS_LOG_FUNCTION(this << processingTime);
+
+    if (m_stalled)
+    {
+        m_stalledRemaining = processingTime;
+        m_stalledWork = true;
+        return;
+    }
+
+    m_currentEvent = Simulator::Schedule(processingTime, &GpuAccelerator::ProcessingComplete, this);
+}
+
+bool
+GpuAccelerator::LoadModel(Ptr<const Task> task, Time& loadTime)
+{
+    NS_LOG_FUNCTION(this << task);
+
+    loadTime = Seconds(0);
+    const std::string& modelId = task->GetModelId();
+    if (modelId.empty())
+    {
+        return true;
+    }
+
+    auto it = m_residentModels.find(modelId);
+    if (it != m_residentModels.end())
+    {
+        m_modelLru.splice(m_modelLru.begin(), m_modelLru, it->second.lruPos);
+        NS_LOG_DEBUG("Model " << modelId << " is resident");
+        return true;
+    }
+
+    uint64_t modelSize = task->GetModelSize();
+    if (modelSize > m_memoryCapacity)
+    {
+        return false;
+    }
+
+    while (m_memoryUsed + modelSize > m_memoryCapacity)
+    {
+        std::string victim = m_modelLru.back();
+        m_modelLru.pop_back();
+        m_memoryUsed -= m_residentModels[victim].size;
+        m_residentModels.erase(victim);
+        NS_LOG_DEBUG("Evicted model " << victim);
+        m_modelEvictedTrace(victim);
+    }
+
+    m_modelLru.push_front(modelId);
+    m_residentModels[modelId] = ResidentModel{modelSize, m_modelLru.begin()};
+    m_memoryUsed += modelSize;
+
+    loadTime = Seconds(modelSize / m_weightLoadBandwidth);
+    m_modelLoadedTrace(modelId, loadTime);
+    return true;
+}
+
 void
 GpuAccelerator::ProcessingComplete()
 {
@@ -213,12 +385,62 @@ GpuAccelerator::GetQueueLength() const
     return m_queueLength.Get();
 }
 
+Ptr<Task>
+GpuAccelerator::StealQueuedTask()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (!m_queueScheduler)
+    {
+        return nullptr;
+    }
+
+    Ptr<Task> task = m_queueScheduler->RemoveLast();
+    if (task)
+    {
+        m_queueLength = m_queueScheduler->GetLength() + (m_currentTask ? 1 : 0);
+        NS_LOG_DEBUG("Task " << task->GetTaskId() << " taken from queue, queue length: "
+                             << m_queueLength);
+    }
+    return task;
+}
+
+Ptr<Task>
+GpuAccelerator::RemoveQueuedTask(uint64_t taskId)
+{
+    NS_LOG_FUNCTION(this << taskId);
+
+    if (!m_queueScheduler)
+    {
+        return nullptr;
+    }
+
+    Ptr<Task> task = m_queueScheduler->Remove(taskId);
+    if (task)
+    {
+        m_queueLength = m_queueScheduler->GetLength() + (m_currentTask ? 1 : 0);
+        NS_LOG_DEBUG("Task " << taskId << " withdrawn from queue, queue length: "
+                             << m_queueLength);
+    }
+    return task;
+}
+
 bool
 GpuAccelerator::IsBusy() const
 {
     return m_currentTask != nullptr;
 }
 
+Time
+GpuAccelerator::GetBusyTime() const
+{
+    if (m_busyStart.IsStrictlyNegative())
+    {
+        return m_busyTime;
+    }
+    return m_busyTime + (Simulator::Now() - m_busyStart);
+}
+
 double
 GpuAccelerator::GetComputeRate() const
 {
@@ -231,6 +453,30 @@ GpuAccelerator::GetMemoryBandwidth() const
     return m_memoryBandwidth;
 }
 
+uint64_t
+GpuAccelerator::GetMemoryCapacity() const
+{
+    return m_memoryCapacity;
+}
+
+uint64_t
+GpuAccelerator::GetMemoryUsed() const
+{
+    return m_memoryUsed;
+}
+
+uint32_t
+GpuAccelerator::GetResidentModelCount() const
+{
+    return static_cast<uint32_t>(m_residentModels.size());
+}
+
+bool
+GpuAccelerator::IsModelResident(const std::string& modelId) const
+{
+    return modelId.empty() || m_residentModels.count(modelId) > 0;
+}
+
 double
 GpuAccelerator::GetVoltage() const
 {
@@ -243,8 +489,111 @@ GpuAccelerator::GetFrequency() const
     return m_frequency;
 }
 
+bool
+GpuAccelerator::IsTransitioning() const
+{
+    return m_transitioning;
+}
+
 void
 GpuAccelerator::SetFrequency(double frequency)
+{
+    NS_LOG_FUNCTION(this << frequency);
+
+    frequency = ClampFrequencyToThermalCap(frequency);
+    double target = m_transitioning ? m_targetFrequency : m_frequency;
+    if (frequency == target)
+    {
+        return;
+    }
+
+    NotifyFrequencyTransition();
+    Simulator::Cancel(m_transitionEvent);
+    m_targetFrequency = frequency;
+
+    Time latency = GetTransitionLatency(frequency);
+    if (latency.IsZero())
+    {
+        m_transitioning = false;
+        ApplyFrequency(frequency);
+        ResumeProcessing();
+    }
+    else
+    {
+        NS_LOG_DEBUG("Transition " << m_frequency << " -> " << frequency << " Hz over " << latency);
+        m_transitioning = true;
+        if (m_transitionMode == STALL)
+        {
+            StallProcessing();
+        }
+        else
+        {
+            ApplyFrequency(std::min(m_frequency, frequency));
+        }
+        m_transitionEvent =
+            Simulator::Schedule(latency, &GpuAccelerator::TransitionComplete, this);
+    }
+
+    if (!m_currentTask)
+    {
+        // Charge the transition overhead even when idle
+        UpdateEnergyState(false, 0.0);
+    }
+}
+
+void
+GpuAccelerator::TransitionComplete()
+{
+    NS_LOG_FUNCTION(this);
+
+    m_transitioning = false;
+    ApplyFrequency(m_targetFrequency);
+    ResumeProcessing();
+}
+
+void
+GpuAccelerator::StallProcessing()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (m_stalled)
+    {
+        return;
+    }
+    m_stalled = true;
+
+    // Weight loads are bandwidth-bound and continue through the stall
+    if (m_currentTask && !m_loadingModel && m_currentEvent.IsPending())
+    {
+        m_stalledRemaining = Simulator::GetDelayLeft(m_currentEvent);
+        m_stalledWork = true;
+        Simulator::Cancel(m_currentEvent);
+        UpdateEnergyState(true, 0.0);
+    }
+}
+
+void
+GpuAccelerator::ResumeProcessing()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (!m_stalled)
+    {
+        return;
+    }
+    m_stalled = false;
+
+    if (m_stalledWork)
+    {
+        m_stalledWork = false;
+        UpdateEnergyState(true, m_currentUtilization);
+        m_currentEvent =
+            Simulator::Schedule(m_stalledRemaining, &GpuAccelerator::ProcessingComplete, this);
+    }
+}
+
+void
+GpuAccelerator::ApplyFrequency(double frequency)
 {
     NS_LOG_FUNCTION(this << frequency);
     if (frequency == m_frequency)
@@ -252,7 +601,9 @@ GpuAccelerator::SetFrequency(double frequency)
         return;
     }
 
-    if (m_currentTask)
+    // Weight loads are bandwidth-bound and unaffected by the core clock
+    bool computing = m_currentTask && !m_loadingModel && !m_stalled;
+    if (computing)
     {
         UpdateEnergyState(true, m_currentUtilization);
     }
@@ -261,7 +612,13 @@ GpuAccelerator::SetFrequency(double frequency)
     m_computeRate *= ratio;
     m_frequency = frequency;
 
-    if (m_currentTask)
+    if (m_stalledWork)
+    {
+        m_stalledRemaining = Seconds(m_stalledRemaining.GetSeconds() / ratio);
+        return;
+    }
+
+    if (computing)
     {
         UpdateEnergyState(true, m_currentUtilization);
 
@@ -288,7 +645,22 @@ void
 GpuAccelerator::SetVoltage(double voltage)
 {
     NS_LOG_FUNCTION(this << voltage);
+    voltage = ClampVoltageToThermalCap(voltage);
+    if (voltage == m_voltage)
+    {
+        return;
+    }
+
+    bool computing = m_currentTask && !m_loadingModel && !m_stalled;
+    if (computing)
+    {
+        UpdateEnergyState(true, m_currentUtilization);
+    }
     m_voltage = voltage;
+    if (computing)
+    {
+        UpdateEnergyState(true, m_currentUtilization);
+    }
 }
 
 } // namespace ns3
@@ -18,6 +18,10 @@
 #include "ns3/nstime.h"
 #include "ns3/traced-value.h"
 
+#include <list>
+#include <string>
+#include <unordered_map>
+
 namespace ns3
 {
 
@@ -28,10 +32,32 @@ namespace ns3
  * GpuAccelerator models a GPU processing unit. Task processing time
  * is determined by the attached ProcessingModel, which must be set
  * before tasks can be submitted.
+ *
+ * Device memory holds an LRU cache of model weights. A task whose
+ * model is not resident first pays a weight-load transfer of
+ * ModelSize / WeightLoadBandwidth, evicting least recently used models
+ * until it fits in MemoryCapacity. Tasks whose model exceeds the whole
+ * capacity fail.
+ *
+ * A task arriving while the device is in a deep idle state (see
+ * EnergyModel::AddIdleState) starts only after the state's wake latency.
+ *
+ * Frequency changes take the accelerator's transition latency to settle.
+ * Depending on TransitionMode, the device either stalls for the duration
+ * or keeps running at the lower of the old and new clocks.
  */
 class GpuAccelerator : public Accelerator
 {
   public:
+    /**
+     * @brief Behaviour of the device while a DVFS transition settles.
+     */
+    enum TransitionMode
+    {
+        STALL,      //!< Execution halts until the new clock is stable
+        LOWER_CLOCK //!< Execution continues at the lower of the two clocks
+    };
+
     /**
      * @brief Get the type ID.
      * @return The object TypeId.
@@ -45,11 +71,16 @@ class GpuAccelerator : public Accelerator
     void SubmitTask(Ptr<Task> task) override;
     std::string GetName() const override;
     uint32_t GetQueueLength() const override;
+    Ptr<Task> StealQueuedTask() override;
+    Ptr<Task> RemoveQueuedTask(uint64_t taskId) override;
     bool IsBusy() const override;
+    Time GetBusyTime() const override;
     double GetVoltage() const override;
     double GetFrequency() const override;
     void SetFrequency(double frequency) override;
     void SetVoltage(double voltage) override;
+    uint64_t GetMemoryCapacity() const override;
+    bool IsModelResident(const std::string& modelId) const override;
 
     /**
      * @brief Get compute rate in FLOPS.
@@ -63,6 +94,37 @@ class GpuAccelerator : public Accelerator
      */
     double GetMemoryBandwidth() const;
 
+    /**
+     * @brief Get device memory currently occupied by resident models.
+     * @return Memory used in bytes.
+     */
+    uint64_t GetMemoryUsed() const;
+
+    /**
+     * @brief Get the number of models resident in device memory.
+     * @return Number of cached models.
+     */
+    uint32_t GetResidentModelCount() const;
+
+    /**
+     * @brief Check if a DVFS transition is in progress.
+     * @return True while the clock is settling to a new frequency.
+     */
+    bool IsTransitioning() const;
+
+    /**
+     * @brief TracedCallback signature for model load events.
+     * @param modelId The loaded model.
+     * @param loadTime The weight transfer time.
+     */
+    typedef void (*ModelLoadedTracedCallback)(const std::string& modelId, Time loadTime);
+
+    /**
+     * @brief TracedCallback signature for model eviction events.
+     * @param modelId The evicted model.
+     */
+    typedef void (*ModelEvictedTracedCallback)(const std::string& modelId);
+
   protected:
     void DoDispose() override;
 
@@ -77,6 +139,47 @@ class GpuAccelerator : public Accelerator
      */
     void ProcessingComplete();
 
+    /**
+     * @brief Called when the current task's model weights finish loading.
+     */
+    void ModelLoadComplete();
+
+    /**
+     * @brief Make a task's model resident, evicting LRU models as needed.
+     *
+     * @param task The task about to execute.
+     * @param loadTime Set to the weight transfer time (zero on a cache hit).
+     * @return False if the model cannot fit in device memory.
+     */
+    bool LoadModel(Ptr<const Task> task, Time& loadTime);
+
+    /**
+     * @brief Switch the clock immediately, rescaling any in-flight task.
+     * @param frequency The new frequency in Hz.
+     */
+    void ApplyFrequency(double frequency);
+
+    /**
+     * @brief Called when a DVFS transition settles.
+     */
+    void TransitionComplete();
+
+    /**
+     * @brief Halt execution of the current task for a stalling transition.
+     */
+    void StallProcessing();
+
+    /**
+     * @brief Resume execution after a stalling transition.
+     */
+    void ResumeProcessing();
+
+    /**
+     * @brief Schedule completion of the current task, deferring it while stalled.
+     * @param processingTime Remaining processing time at the current clock.
+     */
+    void ScheduleProcessing(Time processingTime);
+
     // GPU-specific attributes
     double m_computeRate;                   //!< Compute rate in FLOPS
     double m_memoryBandwidth;               //!< Memory bandwidth in bytes/sec
@@ -84,15 +187,45 @@ class GpuAccelerator : public Accelerator
     double m_voltage;                       //!< Operating voltage in Volts
     Ptr<ProcessingModel> m_processingModel; //!< Processing model for timing calculation
     Ptr<QueueScheduler> m_queueScheduler;   //!< Queue scheduler for task management
+    uint64_t m_memoryCapacity;              //!< Device memory capacity in bytes
+    double m_weightLoadBandwidth;           //!< Host-to-device weight transfer rate in bytes/sec
+    TransitionMode m_transitionMode;        //!< Behaviour during DVFS transitions
+
+    // Model cache (most recently used at the front)
+    struct ResidentModel
+    {
+        uint64_t size;                           //!< Weight size in bytes
+        std::list<std::string>::iterator lruPos; //!< Position in m_modelLru
+    };
+
+    std::list<std::string> m_modelLru;                                //!< LRU order of models
+    std::unordered_map<std::string, ResidentModel> m_residentModels; //!< Resident models
+    uint64_t m_memoryUsed;                                            //!< Bytes of resident weights
 
     // State
     Ptr<Task> m_currentTask;     //!< Currently executing task
     EventId m_currentEvent;      //!< Current scheduled event
+    EventId m_wakeEvent;         //!< Pending start after waking from deep idle
     Time m_taskStartTime;        //!< When current task started
     double m_currentUtilization; //!< Utilization from last ProcessingModel result
+    bool m_loadingModel;         //!< Current event is a weight load, not execution
+    Time m_busyTime;             //!< Busy time accumulated over completed busy periods
+    Time m_busyStart;            //!< Start of the current busy period (-1 = idle)
+
+    // DVFS transition state
+    bool m_transitioning;      //!< Clock is settling to m_targetFrequency
+    double m_targetFrequency;  //!< Frequency being transitioned to
+    EventId m_transitionEvent; //!< Pending transition completion
+    bool m_stalled;            //!< Execution halted by a stalling transition
+    bool m_stalledWork;        //!< Current task has deferred processing time
+    Time m_stalledRemaining;   //!< Deferred processing time at the current clock
 
     // Traced values
     TracedValue<uint32_t> m_queueLength; //!< Current queue length
+
+    // Trace sources
+    TracedCallback<const std::string&, Time> m_modelLoadedTrace; //!< Model weights loaded
+    TracedCallback<const std::string&> m_modelEvictedTrace;      //!< Model evicted
 };
 
 } // namespace ns3
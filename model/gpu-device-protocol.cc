@@ -8,8 +8,10 @@
 
 #include "gpu-device-protocol.h"
 
+#include "accelerator-pool.h"
 #include "accelerator.h"
 #include "device-metrics-header.h"
+#include "metrics-trailer-header.h"
 #include "scaling-command-header.h"
 
 #include "ns3/log.h"
@@ -53,6 +55,77 @@ GpuDeviceProtocol::CreateMetricsPacket(Ptr<const Accelerator> accel)
     header.SetBusy(accel->IsBusy());
     header.SetQueueLength(accel->GetQueueLength());
     header.SetCurrentPower(accel->GetCurrentPower());
+    header.SetTemperature(accel->GetTemperature());
+    header.SetThrottled(accel->IsThrottled());
+
+    Ptr<Packet> packet = Create<Packet>();
+    packet->AddHeader(header);
+    return packet;
+}
+
+Ptr<Packet>
+GpuDeviceProtocol::CreatePoolMetricsPacket(Ptr<const AcceleratorPool> pool, uint16_t deviceIndex)
+{
+    NS_LOG_FUNCTION(this << pool << deviceIndex);
+
+    DeviceMetricsHeader header;
+    header.SetMessageType(DeviceMetricsHeader::DEVICE_METRICS);
+    header.SetDeviceIndex(deviceIndex);
+    header.SetDeviceCount(static_cast<uint16_t>(pool->GetN()));
+
+    if (deviceIndex == DeviceMetricsHeader::AGGREGATE_DEVICE)
+    {
+        header.SetFrequency(pool->GetFrequency());
+        header.SetVoltage(pool->GetVoltage());
+        header.SetBusy(pool->IsBusy());
+        header.SetQueueLength(pool->GetQueueLength());
+        header.SetCurrentPower(pool->GetCurrentPower());
+        header.SetTemperature(pool->GetTemperature());
+        header.SetThrottled(pool->IsThrottled());
+    }
+    else
+    {
+        Ptr<const Accelerator> accel = pool->Get(deviceIndex);
+        header.SetFrequency(accel->GetFrequency());
+        header.SetVoltage(accel->GetVoltage());
+        header.SetBusy(accel->IsBusy());
+        header.SetQueueLength(accel->GetQueueLength());
+        header.SetCurrentPower(accel->GetCurrentPower());
+        header.SetTemperature(accel->GetTemperature());
+        header.SetThrottled(accel->IsThrottled());
+    }
+
+    Ptr<Packet> packet = Create<Packet>();
+    packet->AddHeader(header);
+    return packet;
+}
+
+Ptr<Packet>
+GpuDeviceProtocol::CreateMetricsTrailer(Ptr<const Accelerator> accel)
+{
+    NS_LOG_FUNCTION(this << accel);
+
+    MetricsTrailerHeader header;
+    header.SetQueueLength(accel->GetQueueLength());
+    header.SetFrequency(accel->GetFrequency());
+    header.SetCurrentPower(accel->GetCurrentPower());
+    header.SetBusyTimeNs(accel->GetBusyTime().GetNanoSeconds());
+
+    Ptr<Packet> packet = Create<Packet>();
+    packet->AddHeader(header);
+    return packet;
+}
+
+Ptr<Packet>
+GpuDeviceProtocol::CreatePoolMetricsTrailer(Ptr<const AcceleratorPool> pool)
+{
+    NS_LOG_FUNCTION(this << pool);
+
+    MetricsTrailerHeader header;
+    header.SetQueueLength(pool->GetQueueLength());
+    header.SetFrequency(pool->GetFrequency());
+    header.SetCurrentPower(pool->GetCurrentPower());
+    header.SetBusyTimeNs(pool->GetBusyTime().GetNanoSeconds());
 
     Ptr<Packet> packet = Create<Packet>();
     packet->AddHeader(header);
@@ -64,6 +137,22 @@ GpuDeviceProtocol::ParseMetrics(Ptr<Packet> packet)
 {
     NS_LOG_FUNCTION(this << packet);
 
+    uint8_t messageType;
+    packet->CopyData(&messageType, 1);
+    if (messageType == MetricsTrailerHeader::METRICS_TRAILER)
+    {
+        MetricsTrailerHeader trailer;
+        packet->RemoveHeader(trailer);
+
+        Ptr<DeviceMetrics> metrics = Create<DeviceMetrics>();
+        metrics->frequency = trailer.GetFrequency();
+        metrics->queueLength = trailer.GetQueueLength();
+        metrics->busy = trailer.GetQueueLength() > 0;
+        metrics->currentPower = trailer.GetCurrentPower();
+        metrics->busyTime = NanoSeconds(trailer.GetBusyTimeNs());
+        return metrics;
+    }
+
     DeviceMetricsHeader header;
     packet->RemoveHeader(header);
 
@@ -73,6 +162,12 @@ GpuDeviceProtocol::ParseMetrics(Ptr<Packet> packet)
     metrics->busy = header.GetBusy();
     metrics->queueLength = header.GetQueueLength();
     metrics->currentPower = header.GetCurrentPower();
+    metrics->deviceIndex = header.GetDeviceIndex();
+    metrics->deviceCount = header.GetDeviceCount();
+    metrics->temperature = header.GetTemperature();
+    metrics->throttled = header.GetThrottled();
+    metrics->aggregate = header.GetDeviceIndex() == DeviceMetricsHeader::AGGREGATE_DEVICE ||
+                         header.GetDeviceCount() <= 1;
 
     return metrics;
 }
@@ -18,7 +18,8 @@ namespace ns3
  * @ingroup distributed
  * @brief Concrete DeviceProtocol for GPU accelerators.
  *
- * Serializes metrics using DeviceMetricsHeader (type 4) and applies
+ * Serializes metrics using DeviceMetricsHeader (type 6), or the compact
+ * MetricsTrailerHeader (type 7) when piggybacked on responses, and applies
  * commands from ScalingCommandHeader (type 5) by calling
  * SetFrequency() and SetVoltage() on the accelerator.
  */
@@ -35,6 +36,10 @@ class GpuDeviceProtocol : public DeviceProtocol
     ~GpuDeviceProtocol() override;
 
     Ptr<Packet> CreateMetricsPacket(Ptr<const Accelerator> accel) override;
+    Ptr<Packet> CreatePoolMetricsPacket(Ptr<const AcceleratorPool> pool,
+                                        uint16_t deviceIndex) override;
+    Ptr<Packet> CreateMetricsTrailer(Ptr<const Accelerator> accel) override;
+    Ptr<Packet> CreatePoolMetricsTrailer(Ptr<const AcceleratorPool> pool) override;
     Ptr<DeviceMetrics> ParseMetrics(Ptr<Packet> packet) override;
     Ptr<Packet> CreateCommandPacket(Ptr<ScalingDecision> decision) override;
     void ApplyCommand(Ptr<Packet> packet, Ptr<Accelerator> accel) override;
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#include "learned-latency-scheduler.h"
+
+#include "ns3/double.h"
+#include "ns3/log.h"
+#include "ns3/trace-source-accessor.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("LearnedLatencyScheduler");
+NS_OBJECT_ENSURE_REGISTERED(LearnedLatencyScheduler);
+
+TypeId
+LearnedLatencyScheduler::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::LearnedLatencyScheduler")
+            .SetParent<EarliestFinishTimeScheduler>()
+            .SetGroupName("Distributed")
+            .AddConstructor<LearnedLatencyScheduler>()
+            .AddAttribute("Gain",
+                          "Weight of a new sample in the learned moving averages",
+                          DoubleValue(0.25),
+                          MakeDoubleAccessor(&LearnedLatencyScheduler::m_gain),
+                          MakeDoubleChecker<double>(0.01, 1.0))
+            .AddAttribute("Exploration",
+                          "Confidence bound multiplier for trying uncertain backends "
+                          "(0 = always use the learned mean)",
+                          DoubleValue(0.0),
+                          MakeDoubleAccessor(&LearnedLatencyScheduler::m_exploration),
+                          MakeDoubleChecker<double>(0.0))
+            .AddTraceSource(
+                "PredictionOutcome",
+                "Predicted versus observed latency of each completed task",
+                MakeTraceSourceAccessor(&LearnedLatencyScheduler::m_predictionOutcomeTrace),
+                "ns3::LearnedLatencyScheduler::PredictionOutcomeTracedCallback");
+    return tid;
+}
+
+LearnedLatencyScheduler::LearnedLatencyScheduler()
+    : m_gain(0.25),
+      m_exploration(0.0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+LearnedLatencyScheduler::~LearnedLatencyScheduler()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+LearnedLatencyScheduler::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    m_profile.Clear();
+    m_frequency.clear();
+    m_placements.clear();
+    EarliestFinishTimeScheduler::DoDispose();
+}
+
+Time
+LearnedLatencyScheduler::PredictLatency(uint32_t backendIdx,
+                                        const ClusterState::BackendState& backend,
+                                        Ptr<const Task> task,
+                                        uint32_t totalSamples) const
+{
+    const PerformanceProfile::Estimate* estimate =
+        m_profile.Find(backendIdx, task->GetTaskType(), GetFrequency(backend));
+    if (!estimate)
+    {
+        if (m_exploration > 0 && backend.activeTasks == 0)
+        {
+            return Seconds(0);
+        }
+        return EstimateFinishTime(backend, task);
+    }
+
+    double cost = estimate->mean;
+    if (m_exploration > 0 && totalSamples > 1)
+    {
+        double bound = std::sqrt(std::log(totalSamples) / estimate->samples);
+        double spread = std::sqrt(estimate->variance);
+        cost = std::max(0.0, cost - m_exploration * (cost + spread) * bound);
+    }
+    double flops = backend.outstandingFlops + std::max(task->GetComputeDemand(), 1.0);
+    return Seconds(flops * cost);
+}
+
+int32_t
+LearnedLatencyScheduler::ScheduleTask(Ptr<Task> task,
+                                      const Cluster& cluster,
+                                      const ClusterState& state)
+{
+    NS_LOG_FUNCTION(this << task);
+
+    std::string required = task->GetRequiredAcceleratorType();
+
+    const std::vector<uint32_t>& pool = required.empty()
+                                            ? cluster.GetAvailableBackends()
+                                            : cluster.GetAvailableBackendsByType(required);
+
+    if (pool.empty())
+    {
+        NS_LOG_DEBUG("LearnedLatency: no suitable backends");
+        return -1;
+    }
+
+    if (m_frequency.size() < cluster.GetN())
+    {
+        m_frequency.resize(cluster.GetN(), 0);
+    }
+
+    // Reservoir tie-break: the k-th tied backend replaces the choice with probability 1/k
+    uint32_t totalSamples = m_profile.GetSamples(task->GetTaskType());
+    int32_t bestIdx = -1;
+    Time bestLatency = Time::Max();
+    uint32_t ties = 0;
+    for (uint32_t idx : pool)
+    {
+        const ClusterState::BackendState& backend = state.Get(idx);
+        m_frequency[idx] = GetFrequency(backend);
+        Time latency = PredictLatency(idx, backend, task, totalSamples);
+        if (bestIdx < 0 || latency < bestLatency)
+        {
+            bestLatency = latency;
+            bestIdx = static_cast<int32_t>(idx);
+            ties = 1;
+        }
+        else if (latency == bestLatency && m_tiebreaker->GetInteger(0, ties++) == 0)
+        {
+            bestIdx = static_cast<int32_t>(idx);
+        }
+    }
+
+    m_placements[task->GetTaskId()] = {static_cast<uint32_t>(bestIdx),
+                                       m_frequency[bestIdx],
+                                       bestLatency};
+
+    NS_LOG_DEBUG("LearnedLatency: scheduled task " << task->GetTaskId() << " to backend "
+                                                   << bestIdx << " (predicted " << bestLatency
+                                                   << ", tied=" << ties << ")");
+    return bestIdx;
+}
+
+void
+LearnedLatencyScheduler::NotifyTaskCompleted(uint32_t backendIdx, Ptr<Task> task)
+{
+    NS_LOG_FUNCTION(this << backendIdx << task);
+
+    // Learn at the clock the task was placed at, if it ran where it was placed
+    double frequency = backendIdx < m_frequency.size() ? m_frequency[backendIdx] : 0;
+    auto it = m_placements.find(task->GetTaskId());
+    if (it != m_placements.end())
+    {
+        if (it->second.backendIdx == backendIdx)
+        {
+            frequency = it->second.frequency;
+            m_predictionOutcomeTrace(task->GetTaskId(),
+                                     backendIdx,
+                                     it->second.predicted,
+                                     task->GetBackendTime());
+        }
+        m_placements.erase(it);
+    }
+
+    // Without a recorded compute time there is nothing to learn
+    Time computeTime = task->GetComputeTime();
+    if (!computeTime.IsStrictlyPositive() || backendIdx >= m_frequency.size())
+    {
+        return;
+    }
+
+    double cost = computeTime.GetSeconds() / std::max(task->GetComputeDemand(), 1.0);
+    m_profile.Record(backendIdx, task->GetTaskType(), frequency, cost, m_gain);
+    NS_LOG_DEBUG("LearnedLatency: backend " << backendIdx << " served task " << task->GetTaskId()
+                                            << " in " << computeTime << " at " << frequency
+                                            << " Hz");
+}
+
+void
+LearnedLatencyScheduler::NotifyTaskCancelled(Ptr<Task> task)
+{
+    NS_LOG_FUNCTION(this << task);
+    m_placements.erase(task->GetTaskId());
+}
+
+const PerformanceProfile&
+LearnedLatencyScheduler::GetProfile() const
+{
+    return m_profile;
+}
+
+std::string
+LearnedLatencyScheduler::GetName() const
+{
+    return "LearnedLatency";
+}
+
+} // namespace ns3
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#ifndef LEARNED_LATENCY_SCHEDULER_H
+#define LEARNED_LATENCY_SCHEDULER_H
+
+#include "earliest-finish-time-scheduler.h"
+#include "performance-profile.h"
+
+#include "ns3/nstime.h"
+#include "ns3/traced-callback.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @ingroup distributed
+ * @brief Scheduler that predicts task latency from each backend's observed speed.
+ *
+ * EarliestFinishTimeScheduler trusts the compute rates it is given, which
+ * may be wrong for heterogeneous hardware or unknown for new backends.
+ * LearnedLatencyScheduler instead learns, from every completed task, the
+ * backend's service time per FLOP for that task type at the clock the
+ * backend ran at, keeping a moving average and variance in a
+ * PerformanceProfile. The service time is the task's compute time as
+ * measured by its backend and carried back in the response. A task's
+ * latency on a backend is then predicted as
+ *
+ * T = (outstandingFlops + demand) * c
+ *
+ * where c is the learned cost for the task's type at the backend's current
+ * clock. Backends without a learned cost fall back to the modelled
+ * finish time of EarliestFinishTimeScheduler. The lowest prediction wins,
+ * with ties broken at random.
+ *
+ * A sample is learned at the clock the task was placed at, so a backend
+ * whose clock changes while the task runs does not credit the new clock
+ * with it. Tasks that finish elsewhere (hedged or stolen) are learned at the
+ * clock the serving backend had when it was last scanned.
+ *
+ * With a positive Exploration the scheduler is optimistic in the face of
+ * uncertainty (a lower confidence bound, as the cost is minimised):
+ *
+ * c_lcb = max(0, c - Exploration * (c + s) * sqrt(ln N / n))
+ *
+ * where s is the learned standard deviation of the cost, n the number of
+ * samples of the cost and N the samples of the task type on all backends.
+ * The bonus is scaled by the mean, so it is comparable across task sizes
+ * and a backend measured once is still explored however steady its one
+ * sample; the spread widens it for backends whose service time varies.
+ * Idle backends never measured for the task type are predicted to finish
+ * at once, so each is tried before the learned costs are trusted.
+ *
+ * The PredictionOutcome trace pairs each prediction with the task's
+ * observed backend time (queueing and service at the backend).
+ */
+class LearnedLatencyScheduler : public EarliestFinishTimeScheduler
+{
+  public:
+    /**
+     * @brief Get the type ID.
+     * @return The object TypeId.
+     */
+    static TypeId GetTypeId();
+
+    LearnedLatencyScheduler();
+    ~LearnedLatencyScheduler() override;
+
+    /**
+     * @brief Select the backend with the lowest predicted latency.
+     *
+     * @param task The task to schedule.
+     * @param cluster The cluster of backends.
+     * @param state Per-backend load state.
+     * @return Backend index, or -1 if no suitable backend.
+     */
+    int32_t ScheduleTask(Ptr<Task> task,
+                         const Cluster& cluster,
+                         const ClusterState& state) override;
+
+    /**
+     * @brief Learn from a completed task's compute time.
+     * @param backendIdx The backend index where the task completed.
+     * @param task The task that completed.
+     */
+    void NotifyTaskCompleted(uint32_t backendIdx, Ptr<Task> task) override;
+
+    /**
+     * @brief Forget the placement of a cancelled task.
+     * @param task The task that was cancelled.
+     */
+    void NotifyTaskCancelled(Ptr<Task> task) override;
+
+    /**
+     * @brief Get the scheduler name.
+     * @return "LearnedLatency"
+     */
+    std::string GetName() const override;
+
+    /**
+     * @brief Predict how long a backend would take to finish a task.
+     * @param backendIdx The backend index.
+     * @param backend The backend's state.
+     * @param task The task to place.
+     * @param totalSamples Samples of the task's type on all backends.
+     * @return Time from now until the task would finish.
+     */
+    Time PredictLatency(uint32_t backendIdx,
+                        const ClusterState::BackendState& backend,
+                        Ptr<const Task> task,
+                        uint32_t totalSamples) const;
+
+    /**
+     * @brief Get the learned profile.
+     * @return The profile of service seconds per FLOP.
+     */
+    const PerformanceProfile& GetProfile() const;
+
+    /**
+     * @brief TracedCallback signature for predicted-versus-observed latency.
+     * @param taskId The completed task.
+     * @param backendIdx The backend that ran it.
+     * @param predicted Latency predicted at placement.
+     * @param observed Observed backend time.
+     */
+    typedef void (*PredictionOutcomeTracedCallback)(uint64_t taskId,
+                                                    uint32_t backendIdx,
+                                                    Time predicted,
+                                                    Time observed);
+
+  protected:
+    void DoDispose() override;
+
+  private:
+    /**
+     * @brief Where and at what clock a task was placed.
+     */
+    struct Placement
+    {
+        uint32_t backendIdx; //!< Backend chosen
+        double frequency;    //!< Backend clock at placement, in Hz
+        Time predicted;      //!< Predicted latency
+    };
+
+    double m_gain;        //!< Weight of a new sample in the learned averages
+    double m_exploration; //!< Confidence bound multiplier (0 = exploit only)
+
+    PerformanceProfile m_profile;    //!< Learned service seconds per FLOP
+    std::vector<double> m_frequency; //!< Per-backend clock when last scheduled, in Hz
+    std::map<uint64_t, Placement> m_placements; //!< Task ID → placement of placed tasks
+
+    TracedCallback<uint64_t, uint32_t, Time, Time>
+        m_predictionOutcomeTrace; //!< Predicted versus observed latency at completion
+};
+
+} // namespace ns3
+
+#endif // LEARNED_LATENCY_SCHEDULER_H
@@ -8,9 +8,8 @@
 
 #include "least-loaded-scheduler.h"
 
-#include "cluster-state.h"
-
 #include "ns3/log.h"
+#include "ns3/uinteger.h"
 
 namespace ns3
 {
@@ -21,14 +20,22 @@ NS_OBJECT_ENSURE_REGISTERED(LeastLoadedScheduler);
 TypeId
 LeastLoadedScheduler::GetTypeId()
 {
-    static TypeId tid = TypeId("ns3::LeastLoadedScheduler")
-                            .SetParent<ClusterScheduler>()
-                            .SetGroupName("Distributed")
-                            .AddConstructor<LeastLoadedScheduler>();
+    static TypeId tid =
+        TypeId("ns3::LeastLoadedScheduler")
+            .SetParent<ClusterScheduler>()
+            .SetGroupName("Distributed")
+            .AddConstructor<LeastLoadedScheduler>()
+            .AddAttribute("WarmSlack",
+                          "Extra active tasks tolerated on a backend that already holds the "
+                          "task's model, to avoid a cold start elsewhere",
+                          UintegerValue(1),
+                          MakeUintegerAccessor(&LeastLoadedScheduler::m_warmSlack),
+                          MakeUintegerChecker<uint32_t>());
     return tid;
 }
 
 LeastLoadedScheduler::LeastLoadedScheduler()
+    : m_warmSlack(1)
 {
     NS_LOG_FUNCTION(this);
     m_tiebreaker = CreateObject<UniformRandomVariable>();
@@ -56,28 +63,26 @@ LeastLoadedScheduler::ScheduleTask(Ptr<Task> task,
 
     std::string required = task->GetRequiredAcceleratorType();
 
-    std::vector<uint32_t> pool;
-    if (required.empty())
-    {
-        uint32_t n = cluster.GetN();
-        pool.reserve(n);
-        for (uint32_t i = 0; i < n; i++)
-        {
-            pool.push_back(i);
-        }
-    }
-    else
+    if (state.IsLoadIndexed(cluster))
     {
-        pool = cluster.GetBackendsByType(required);
+        return ScheduleIndexed(task,
+                               required.empty() ? state.GetLoadGroup()
+                                                : state.GetLoadGroup(required));
     }
 
+    const std::vector<uint32_t>& pool = required.empty()
+                                            ? cluster.GetAvailableBackends()
+                                            : cluster.GetAvailableBackendsByType(required);
+
     if (pool.empty())
     {
         NS_LOG_DEBUG("LeastLoaded: no suitable backends");
         return -1;
     }
 
+    const std::string& modelId = task->GetModelId();
     uint32_t minLoad = UINT32_MAX;
+    uint32_t minWarmLoad = UINT32_MAX;
     for (uint32_t idx : pool)
     {
         uint32_t load = state.Get(idx).activeTasks;
@@ -85,12 +90,21 @@ LeastLoadedScheduler::ScheduleTask(Ptr<Task> task,
         {
             minLoad = load;
         }
+        if (load < minWarmLoad && state.IsModelWarm(idx, modelId))
+        {
+            minWarmLoad = load;
+        }
     }
 
+    // Prefer a backend holding the model unless it is noticeably busier
+    bool useWarm = minWarmLoad != UINT32_MAX && minWarmLoad - minLoad <= m_warmSlack;
+    uint32_t targetLoad = useWarm ? minWarmLoad : minLoad;
+
     std::vector<uint32_t> tied;
     for (uint32_t idx : pool)
     {
-        if (state.Get(idx).activeTasks == minLoad)
+        if (state.Get(idx).activeTasks == targetLoad &&
+            (!useWarm || state.IsModelWarm(idx, modelId)))
         {
             tied.push_back(idx);
         }
@@ -100,8 +114,63 @@ LeastLoadedScheduler::ScheduleTask(Ptr<Task> task,
     int32_t bestIdx = static_cast<int32_t>(tied[pick]);
 
     NS_LOG_DEBUG("LeastLoaded: scheduled task " << task->GetTaskId() << " to backend " << bestIdx
-                                                << " (load=" << minLoad << ", tied=" << tied.size()
-                                                << ")");
+                                                << " (load=" << targetLoad << ", warm=" << useWarm
+                                                << ", tied=" << tied.size() << ")");
+    return bestIdx;
+}
+
+int32_t
+LeastLoadedScheduler::ScheduleIndexed(Ptr<Task> task, const ClusterState::LoadGroup* group)
+{
+    if (!group || group->backends.IsEmpty())
+    {
+        NS_LOG_DEBUG("LeastLoaded: no suitable backends");
+        return -1;
+    }
+
+    uint32_t minLoad = group->backends.GetMinLoad();
+    const std::vector<uint32_t>* tied = &group->backends.GetBucket(minLoad);
+    const std::vector<uint32_t>* warmTied = nullptr;
+    uint32_t targetLoad = minLoad;
+    bool useWarm = true;
+
+    // Every backend is warm unless the task names a model and some backends track models
+    const std::string& modelId = task->GetModelId();
+    if (!modelId.empty() && group->untracked.GetSize() < group->backends.GetSize())
+    {
+        const LoadIndex* holders = nullptr;
+        auto it = group->models.find(modelId);
+        if (it != group->models.end())
+        {
+            holders = &it->second;
+        }
+
+        uint32_t minWarmLoad = group->untracked.IsEmpty() ? UINT32_MAX
+                                                          : group->untracked.GetMinLoad();
+        if (holders && holders->GetMinLoad() < minWarmLoad)
+        {
+            minWarmLoad = holders->GetMinLoad();
+        }
+
+        // Prefer a backend holding the model unless it is noticeably busier
+        useWarm = minWarmLoad != UINT32_MAX && minWarmLoad - minLoad <= m_warmSlack;
+        if (useWarm)
+        {
+            targetLoad = minWarmLoad;
+            tied = &group->untracked.GetBucket(targetLoad);
+            warmTied = holders ? &holders->GetBucket(targetLoad) : nullptr;
+        }
+    }
+
+    // The untracked and model indexes are disjoint, so their union is a plain concatenation
+    uint32_t nTied = tied->size() + (warmTied ? warmTied->size() : 0);
+    uint32_t pick = m_tiebreaker->GetInteger(0, nTied - 1);
+    int32_t bestIdx = static_cast<int32_t>(pick < tied->size() ? (*tied)[pick]
+                                                               : (*warmTied)[pick - tied->size()]);
+
+    NS_LOG_DEBUG("LeastLoaded: scheduled task " << task->GetTaskId() << " to backend " << bestIdx
+                                                << " (load=" << targetLoad << ", warm=" << useWarm
+                                                << ", tied=" << nTied << ", indexed)");
     return bestIdx;
 }
 
@@ -10,6 +10,7 @@
 #define LEAST_LOADED_SCHEDULER_H
 
 #include "cluster-scheduler.h"
+#include "cluster-state.h"
 
 #include "ns3/random-variable-stream.h"
 
@@ -26,6 +27,15 @@ namespace ns3
  * tasks (dispatched but not yet completed), as tracked in ClusterState.
  * If the task specifies a required accelerator type, only matching backends
  * are considered. Ties are broken by uniform random selection.
+ *
+ * If the task names a model, backends expected to hold its weights (see
+ * ClusterState::IsModelWarm) are preferred as long as their load is within
+ * WarmSlack tasks of the least-loaded backend.
+ *
+ * When the ClusterState's load index is current for the cluster (see
+ * ClusterState::IndexLoad), candidates are taken from its bucket queues, so
+ * a decision costs O(1) regardless of cluster size. Otherwise the available
+ * backends are scanned, which is O(N) per task.
  */
 class LeastLoadedScheduler : public ClusterScheduler
 {
@@ -61,7 +71,16 @@ class LeastLoadedScheduler : public ClusterScheduler
     void DoDispose() override;
 
   private:
+    /**
+     * @brief Select the least-loaded backend from ClusterState's load indexes.
+     * @param task The task to schedule.
+     * @param group Indexes over the candidate backends (nullptr if none are available).
+     * @return Backend index, or -1 if no suitable backend.
+     */
+    int32_t ScheduleIndexed(Ptr<Task> task, const ClusterState::LoadGroup* group);
+
     Ptr<UniformRandomVariable> m_tiebreaker; //!< RNG for breaking ties
+    uint32_t m_warmSlack;                    //!< Extra load tolerated to avoid a cold start
 };
 
 } // namespace ns3
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#include "load-index.h"
+
+#include "ns3/assert.h"
+
+namespace ns3
+{
+
+void
+LoadIndex::Insert(uint32_t backendIdx, uint32_t load)
+{
+    NS_ASSERT_MSG(!Contains(backendIdx), "Backend " << backendIdx << " already indexed");
+    if (backendIdx >= m_slot.size())
+    {
+        m_slot.resize(backendIdx + 1, ABSENT);
+        m_load.resize(backendIdx + 1, 0);
+    }
+    Link(backendIdx, load);
+    if (m_size++ == 0 || load < m_minLoad)
+    {
+        m_minLoad = load;
+    }
+}
+
+void
+LoadIndex::Remove(uint32_t backendIdx)
+{
+    NS_ASSERT_MSG(Contains(backendIdx), "Backend " << backendIdx << " not indexed");
+    uint32_t load = Unlink(backendIdx);
+    m_size--;
+    if (load == m_minLoad)
+    {
+        RaiseMinLoad(load);
+    }
+}
+
+void
+LoadIndex::Update(uint32_t backendIdx, uint32_t load)
+{
+    NS_ASSERT_MSG(Contains(backendIdx), "Backend " << backendIdx << " not indexed");
+    uint32_t oldLoad = m_load[backendIdx];
+    if (oldLoad == load)
+    {
+        return;
+    }
+    Unlink(backendIdx);
+    Link(backendIdx, load);
+    if (load < m_minLoad)
+    {
+        m_minLoad = load;
+    }
+    else if (oldLoad == m_minLoad)
+    {
+        // The scan stops at the new load at the latest
+        RaiseMinLoad(oldLoad);
+    }
+}
+
+bool
+LoadIndex::Contains(uint32_t backendIdx) const
+{
+    return backendIdx < m_slot.size() && m_slot[backendIdx] != ABSENT;
+}
+
+uint32_t
+LoadIndex::GetLoad(uint32_t backendIdx) const
+{
+    NS_ASSERT_MSG(Contains(backendIdx), "Backend " << backendIdx << " not indexed");
+    return m_load[backendIdx];
+}
+
+uint32_t
+LoadIndex::GetSize() const
+{
+    return m_size;
+}
+
+bool
+LoadIndex::IsEmpty() const
+{
+    return m_size == 0;
+}
+
+uint32_t
+LoadIndex::GetMinLoad() const
+{
+    NS_ASSERT_MSG(m_size > 0, "Empty load index has no minimum");
+    return m_minLoad;
+}
+
+const std::vector<uint32_t>&
+LoadIndex::GetBucket(uint32_t load) const
+{
+    static const std::vector<uint32_t> empty;
+    return load < m_buckets.size() ? m_buckets[load] : empty;
+}
+
+void
+LoadIndex::Clear()
+{
+    m_buckets.clear();
+    m_slot.clear();
+    m_load.clear();
+    m_size = 0;
+    m_minLoad = 0;
+}
+
+uint32_t
+LoadIndex::Unlink(uint32_t backendIdx)
+{
+    uint32_t load = m_load[backendIdx];
+    std::vector<uint32_t>& bucket = m_buckets[load];
+
+    // Swap-remove keeps the operation O(1)
+    uint32_t slot = m_slot[backendIdx];
+    uint32_t moved = bucket.back();
+    bucket[slot] = moved;
+    m_slot[moved] = slot;
+    bucket.pop_back();
+
+    m_slot[backendIdx] = ABSENT;
+    return load;
+}
+
+void
+LoadIndex::Link(uint32_t backendIdx, uint32_t load)
+{
+    if (load >= m_buckets.size())
+    {
+        m_buckets.resize(load + 1);
+    }
+    m_slot[backendIdx] = m_buckets[load].size();
+    m_load[backendIdx] = load;
+    m_buckets[load].push_back(backendIdx);
+}
+
+void
+LoadIndex::RaiseMinLoad(uint32_t from)
+{
+    if (m_size == 0)
+    {
+        m_minLoad = 0;
+        return;
+    }
+    m_minLoad = from;
+    while (m_buckets[m_minLoad].empty())
+    {
+        m_minLoad++;
+    }
+}
+
+} // namespace ns3
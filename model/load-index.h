@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#ifndef LOAD_INDEX_H
+#define LOAD_INDEX_H
+
+#include <cstdint>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @ingroup distributed
+ * @brief Bucket queue of backend indices keyed by load.
+ *
+ * Loads are small non-negative integers (active task counts), so backends
+ * are kept in one bucket per load level and the minimum non-empty level is
+ * tracked incrementally. Finding the least-loaded backends is O(1), and
+ * moving a backend from one load to another costs O(|delta|), which is O(1)
+ * for the unit steps caused by dispatches and completions.
+ *
+ * Backends within a bucket are in no particular order; callers that need a
+ * fair choice among ties should pick uniformly from GetBucket().
+ */
+class LoadIndex
+{
+  public:
+    /**
+     * @brief Add a backend to the index.
+     * @param backendIdx The backend index (must not already be present).
+     * @param load The backend's current load.
+     */
+    void Insert(uint32_t backendIdx, uint32_t load);
+
+    /**
+     * @brief Remove a backend from the index.
+     * @param backendIdx The backend index (must be present).
+     */
+    void Remove(uint32_t backendIdx);
+
+    /**
+     * @brief Move a backend to a new load level.
+     * @param backendIdx The backend index (must be present).
+     * @param load The backend's new load.
+     */
+    void Update(uint32_t backendIdx, uint32_t load);
+
+    /**
+     * @brief Check whether a backend is in the index.
+     * @param backendIdx The backend index.
+     * @return True if the backend is present.
+     */
+    bool Contains(uint32_t backendIdx) const;
+
+    /**
+     * @brief Get the load a backend is indexed under.
+     * @param backendIdx The backend index (must be present).
+     * @return The backend's load.
+     */
+    uint32_t GetLoad(uint32_t backendIdx) const;
+
+    /**
+     * @brief Get the number of backends in the index.
+     * @return Number of backends.
+     */
+    uint32_t GetSize() const;
+
+    /**
+     * @brief Check whether the index is empty.
+     * @return True if no backends are indexed.
+     */
+    bool IsEmpty() const;
+
+    /**
+     * @brief Get the lowest load of any indexed backend.
+     * @return The minimum load (the index must not be empty).
+     */
+    uint32_t GetMinLoad() const;
+
+    /**
+     * @brief Get the backends at a load level.
+     * @param load The load level.
+     * @return Backend indices with exactly this load, in no particular order.
+     */
+    const std::vector<uint32_t>& GetBucket(uint32_t load) const;
+
+    /**
+     * @brief Remove all backends.
+     */
+    void Clear();
+
+  private:
+    /**
+     * @brief Take a backend out of its bucket without fixing the minimum.
+     * @param backendIdx The backend index.
+     * @return The load the backend was indexed under.
+     */
+    uint32_t Unlink(uint32_t backendIdx);
+
+    /**
+     * @brief Put a backend into a bucket without fixing the minimum.
+     * @param backendIdx The backend index.
+     * @param load The load level.
+     */
+    void Link(uint32_t backendIdx, uint32_t load);
+
+    /**
+     * @brief Advance the minimum past empty buckets, starting from a load level.
+     * @param from The lowest load level that may still be occupied.
+     */
+    void RaiseMinLoad(uint32_t from);
+
+    static constexpr uint32_t ABSENT = UINT32_MAX; //!< Slot of a backend not in the index
+
+    std::vector<std::vector<uint32_t>> m_buckets; //!< Backend indices per load level
+    std::vector<uint32_t> m_slot;                 //!< Per-backend position in its bucket
+    std::vector<uint32_t> m_load;                 //!< Per-backend indexed load
+    uint32_t m_size{0};                           //!< Number of indexed backends
+    uint32_t m_minLoad{0};                        //!< Lowest occupied load level
+};
+
+} // namespace ns3
+
+#endif // LOAD_INDEX_H
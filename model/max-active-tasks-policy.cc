@@ -74,9 +74,10 @@ MaxActiveTasksPolicy::ShouldAdmit(Ptr<DagTask> dag,
 
         if (type.empty())
         {
-            for (uint32_t i = 0; i < state.GetN(); i++)
+            for (uint32_t i : cluster.GetAvailableBackends())
             {
-                if (state.Get(i).activeTasks < m_maxActiveTasks)
+                const ClusterState::BackendState& backend = state.Get(i);
+                if (backend.activeTasks + backend.reservedTasks < m_maxActiveTasks)
                 {
                     hasCapacity = true;
                     break;
@@ -85,9 +86,10 @@ MaxActiveTasksPolicy::ShouldAdmit(Ptr<DagTask> dag,
         }
         else
         {
-            for (uint32_t idx : cluster.GetBackendsByType(type))
+            for (uint32_t idx : cluster.GetAvailableBackendsByType(type))
             {
-                if (state.Get(idx).activeTasks < m_maxActiveTasks)
+                const ClusterState::BackendState& backend = state.Get(idx);
+                if (backend.activeTasks + backend.reservedTasks < m_maxActiveTasks)
                 {
                     hasCapacity = true;
                     break;
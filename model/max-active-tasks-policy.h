@@ -21,8 +21,10 @@ namespace ns3
  *
  * MaxActiveTasksPolicy checks whether backends compatible with the workload's
  * required accelerator types have fewer active tasks than the configured
- * threshold. For each required type, at least one matching backend must have
- * capacity. Tasks with no required type are matched against any backend.
+ * threshold. Tasks reserved for workloads admitted but still awaiting their
+ * data count as active. For each required type, at least one matching
+ * backend must have capacity. Tasks with no required type are matched
+ * against any backend.
  */
 class MaxActiveTasksPolicy : public AdmissionPolicy
 {
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#include "metrics-trailer-header.h"
+
+#include "ns3/log.h"
+
+#include <cstring>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("MetricsTrailerHeader");
+
+NS_OBJECT_ENSURE_REGISTERED(MetricsTrailerHeader);
+
+TypeId
+MetricsTrailerHeader::GetTypeId()
+{
+    static TypeId tid = TypeId("ns3::MetricsTrailerHeader")
+                            .SetParent<Header>()
+                            .SetGroupName("Distributed")
+                            .AddConstructor<MetricsTrailerHeader>();
+    return tid;
+}
+
+MetricsTrailerHeader::MetricsTrailerHeader()
+    : m_messageType(METRICS_TRAILER),
+      m_queueLength(0),
+      m_frequency(0),
+      m_currentPower(0),
+      m_busyTimeNs(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+MetricsTrailerHeader::~MetricsTrailerHeader()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+uint8_t
+MetricsTrailerHeader::GetMessageType() const
+{
+    return m_messageType;
+}
+
+void
+MetricsTrailerHeader::SetMessageType(uint8_t type)
+{
+    NS_LOG_FUNCTION(this << static_cast<int>(type));
+    m_messageType = type;
+}
+
+uint32_t
+MetricsTrailerHeader::GetQueueLength() const
+{
+    return m_queueLength;
+}
+
+void
+MetricsTrailerHeader::SetQueueLength(uint32_t queueLength)
+{
+    NS_LOG_FUNCTION(this << queueLength);
+    m_queueLength = queueLength;
+}
+
+double
+MetricsTrailerHeader::GetFrequency() const
+{
+    return m_frequency;
+}
+
+void
+MetricsTrailerHeader::SetFrequency(double frequency)
+{
+    NS_LOG_FUNCTION(this << frequency);
+    m_frequency = frequency;
+}
+
+double
+MetricsTrailerHeader::GetCurrentPower() const
+{
+    return m_currentPower;
+}
+
+void
+MetricsTrailerHeader::SetCurrentPower(double power)
+{
+    NS_LOG_FUNCTION(this << power);
+    m_currentPower = power;
+}
+
+int64_t
+MetricsTrailerHeader::GetBusyTimeNs() const
+{
+    return m_busyTimeNs;
+}
+
+void
+MetricsTrailerHeader::SetBusyTimeNs(int64_t busyTimeNs)
+{
+    NS_LOG_FUNCTION(this << busyTimeNs);
+    m_busyTimeNs = busyTimeNs;
+}
+
+TypeId
+MetricsTrailerHeader::GetInstanceTypeId() const
+{
+    return GetTypeId();
+}
+
+uint32_t
+MetricsTrailerHeader::GetSerializedSize() const
+{
+    return SERIALIZED_SIZE;
+}
+
+void
+MetricsTrailerHeader::Serialize(Buffer::Iterator start) const
+{
+    NS_LOG_FUNCTION(this);
+
+    start.WriteU8(m_messageType);
+    start.WriteHtonU32(m_queueLength);
+
+    uint64_t freqBits;
+    std::memcpy(&freqBits, &m_frequency, sizeof(freqBits));
+    start.WriteHtonU64(freqBits);
+
+    uint64_t powerBits;
+    std::memcpy(&powerBits, &m_currentPower, sizeof(powerBits));
+    start.WriteHtonU64(powerBits);
+
+    start.WriteHtonU64(static_cast<uint64_t>(m_busyTimeNs));
+}
+
+uint32_t
+MetricsTrailerHeader::Deserialize(Buffer::Iterator start)
+{
+    NS_LOG_FUNCTION(this);
+
+    m_messageType = start.ReadU8();
+    m_queueLength = start.ReadNtohU32();
+
+    uint64_t freqBits = start.ReadNtohU64();
+    std::memcpy(&m_frequency, &freqBits, sizeof(m_frequency));
+
+    uint64_t powerBits = start.ReadNtohU64();
+    std::memcpy(&m_currentPower, &powerBits, sizeof(m_currentPower));
+
+    m_busyTimeNs = static_cast<int64_t>(start.ReadNtohU64());
+
+    return SERIALIZED_SIZE;
+}
+
+void
+MetricsTrailerHeader::Print(std::ostream& os) const
+{
+    os << "MetricsTrailerHeader(type=" << static_cast<int>(m_messageType)
+       << ", queueLength=" << m_queueLength << ", freq=" << m_frequency
+       << ", power=" << m_currentPower << ", busyTimeNs=" << m_busyTimeNs << ")";
+}
+
+} // namespace ns3
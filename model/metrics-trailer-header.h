@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#ifndef METRICS_TRAILER_HEADER_H
+#define METRICS_TRAILER_HEADER_H
+
+#include "ns3/header.h"
+
+#include <cstdint>
+#include <ostream>
+
+namespace ns3
+{
+
+/**
+ * @ingroup distributed
+ * @brief Compact device metrics appended to task responses.
+ *
+ * MetricsTrailerHeader carries the subset of device state a backend
+ * piggybacks on each task response when PeriodicServer's PiggybackMetrics
+ * is enabled, replacing separate DeviceMetricsHeader reports. It follows
+ * the response on the same connection and is identified by message type 7.
+ *
+ * Wire format (29 bytes):
+ * - messageType: 1 byte (METRICS_TRAILER = 7)
+ * - queueLength: 4 bytes (uint32_t, network byte order)
+ * - frequency: 8 bytes (double as uint64_t via memcpy, network byte order)
+ * - currentPower: 8 bytes (double as uint64_t via memcpy, network byte order)
+ * - busyTimeNs: 8 bytes (int64_t cumulative busy time in nanoseconds)
+ */
+class MetricsTrailerHeader : public Header
+{
+  public:
+    /**
+     * @brief Message type value for metrics trailers.
+     */
+    static constexpr uint8_t METRICS_TRAILER = 7;
+
+    /**
+     * @brief Serialized size of the header in bytes.
+     */
+    static constexpr uint32_t SERIALIZED_SIZE = 29;
+
+    /**
+     * @brief Get the type ID.
+     * @return The object TypeId.
+     */
+    static TypeId GetTypeId();
+
+    MetricsTrailerHeader();
+    ~MetricsTrailerHeader() override;
+
+    uint8_t GetMessageType() const;
+    void SetMessageType(uint8_t type);
+
+    uint32_t GetQueueLength() const;
+    void SetQueueLength(uint32_t queueLength);
+
+    double GetFrequency() const;
+    void SetFrequency(double frequency);
+
+    double GetCurrentPower() const;
+    void SetCurrentPower(double power);
+
+    int64_t GetBusyTimeNs() const;
+    void SetBusyTimeNs(int64_t busyTimeNs);
+
+    // Header interface
+    TypeId GetInstanceTypeId() const override;
+    uint32_t GetSerializedSize() const override;
+    void Serialize(Buffer::Iterator start) const override;
+    uint32_t Deserialize(Buffer::Iterator start) override;
+    void Print(std::ostream& os) const override;
+
+  private:
+    uint8_t m_messageType{METRICS_TRAILER}; //!< Message type (always 7)
+    uint32_t m_queueLength{0};              //!< Tasks in queue (including current)
+    double m_frequency{0};                  //!< Current frequency in Hz
+    double m_currentPower{0};               //!< Current power consumption in Watts
+    int64_t m_busyTimeNs{0};                //!< Cumulative busy time in nanoseconds
+};
+
+} // namespace ns3
+
+#endif // METRICS_TRAILER_HEADER_H
@@ -31,6 +31,7 @@ OrchestratorHeader::OrchestratorHeader()
     : m_messageType(ADMISSION_REQUEST), // 2
       m_taskId(0),
       m_admitted(false),
+      m_variant(0),
       m_payloadSize(0)
 {
     NS_LOG_FUNCTION(this);
@@ -80,6 +81,20 @@ OrchestratorHeader::SetAdmitted(bool admitted)
     m_admitted = admitted;
 }
 
+uint8_t
+OrchestratorHeader::GetVariant() const
+{
+    return m_variant;
+}
+
+void
+OrchestratorHeader::SetVariant(uint8_t variant)
+{
+    NS_LOG_FUNCTION(this << static_cast<uint32_t>(variant));
+    NS_ASSERT_MSG(variant < 255, "Variant does not fit the admitted byte");
+    m_variant = variant;
+}
+
 uint64_t
 OrchestratorHeader::GetPayloadSize() const
 {
@@ -146,7 +161,7 @@ OrchestratorHeader::Serialize(Buffer::Iterator start) const
 
     start.WriteU8(static_cast<uint8_t>(m_messageType));
     start.WriteHtonU64(m_taskId);
-    start.WriteU8(m_admitted ? 1 : 0);
+    start.WriteU8(m_admitted ? 1 + m_variant : 0);
     start.WriteHtonU64(m_payloadSize);
 }
 
@@ -167,7 +182,9 @@ OrchestratorHeader::Deserialize(Buffer::Iterator start)
         m_messageType = static_cast<MessageType>(messageTypeByte);
     }
     m_taskId = start.ReadNtohU64();
-    m_admitted = (start.ReadU8() != 0);
+    uint8_t admitted = start.ReadU8();
+    m_admitted = (admitted != 0);
+    m_variant = m_admitted ? admitted - 1 : 0;
     m_payloadSize = start.ReadNtohU64();
 
     return SERIALIZED_SIZE;
@@ -177,7 +194,8 @@ void
 OrchestratorHeader::Print(std::ostream& os) const
 {
     os << "OrchestratorHeader(type=" << GetMessageTypeName() << ", taskId=" << m_taskId
-       << ", admitted=" << (m_admitted ? "true" : "false") << ", payloadSize=" << m_payloadSize
+       << ", admitted=" << (m_admitted ? "true" : "false")
+       << ", variant=" << static_cast<uint32_t>(m_variant) << ", payloadSize=" << m_payloadSize
        << ")";
 }
 
@@ -29,7 +29,7 @@ namespace ns3
  * Wire format (18 bytes):
  * - messageType: 1 byte
  * - taskId: 8 bytes (from TaskHeader for request, echoed in response)
- * - admitted: 1 byte (for ADMISSION_RESPONSE: 0=rejected, 1=admitted)
+ * - admitted: 1 byte (for ADMISSION_RESPONSE: 0=rejected, 1+v=admitted as variant v)
  * - payloadSize: 8 bytes (size of following data for header-agnostic parsing)
  */
 class OrchestratorHeader : public Header
@@ -103,6 +103,22 @@ class OrchestratorHeader : public Header
      */
     void SetAdmitted(bool admitted);
 
+    /**
+     * @brief Get the variant the workload was admitted as (for ADMISSION_RESPONSE).
+     * @return The variant (0 = original, or rejected).
+     */
+    uint8_t GetVariant() const;
+
+    /**
+     * @brief Set the variant the workload was admitted as (for ADMISSION_RESPONSE).
+     *
+     * The variant shares the admitted byte on the wire, so it is only
+     * meaningful for admitted workloads.
+     *
+     * @param variant The variant (0 = original, at most 254).
+     */
+    void SetVariant(uint8_t variant);
+
     /**
      * @brief Get the payload size.
      *
@@ -157,6 +173,7 @@ class OrchestratorHeader : public Header
     MessageType m_messageType{ADMISSION_REQUEST}; //!< Message type
     uint64_t m_taskId{0};                         //!< Task ID for correlation
     bool m_admitted{false};                       //!< Admission status (for response)
+    uint8_t m_variant{0};                         //!< Admitted variant (for response)
     uint64_t m_payloadSize{0};                    //!< Size of following payload bytes
 };
 
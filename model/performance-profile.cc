@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#include "performance-profile.h"
+
+#include "ns3/assert.h"
+
+namespace ns3
+{
+
+void
+PerformanceProfile::Record(uint32_t backendIdx,
+                           uint8_t taskType,
+                           double frequency,
+                           double value,
+                           double gain)
+{
+    NS_ASSERT_MSG(gain > 0 && gain <= 1, "Sample weight " << gain << " out of (0, 1]");
+
+    Estimate& estimate = m_estimates[{backendIdx, taskType, frequency}];
+    if (estimate.samples++ == 0)
+    {
+        estimate.mean = value;
+        estimate.variance = 0;
+    }
+    else
+    {
+        double delta = value - estimate.mean;
+        estimate.mean += gain * delta;
+        estimate.variance = (1 - gain) * (estimate.variance + gain * delta * delta);
+    }
+    m_totals[taskType]++;
+}
+
+const PerformanceProfile::Estimate*
+PerformanceProfile::Find(uint32_t backendIdx, uint8_t taskType, double frequency) const
+{
+    auto it = m_estimates.find({backendIdx, taskType, frequency});
+    return it != m_estimates.end() ? &it->second : nullptr;
+}
+
+uint32_t
+PerformanceProfile::GetSamples(uint8_t taskType) const
+{
+    auto it = m_totals.find(taskType);
+    return it != m_totals.end() ? it->second : 0;
+}
+
+void
+PerformanceProfile::Clear()
+{
+    m_estimates.clear();
+    m_totals.clear();
+}
+
+} // namespace ns3
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#ifndef PERFORMANCE_PROFILE_H
+#define PERFORMANCE_PROFILE_H
+
+#include <cstdint>
+#include <map>
+#include <tuple>
+
+namespace ns3
+{
+
+/**
+ * @ingroup distributed
+ * @brief Learned per-backend performance, keyed by task type and clock.
+ *
+ * Each (backend, task type, frequency) key holds an exponentially weighted
+ * moving average of the observed samples and their variance:
+ *
+ * d = x - mean
+ * mean += g * d
+ * variance = (1 - g) * (variance + g * d^2)
+ *
+ * where g is the weight of a new sample. The first sample of a key sets
+ * its mean with zero variance. Frequencies are matched exactly, as DVFS
+ * clocks come from a discrete table of operating points.
+ *
+ * The store does not interpret the samples; LearnedLatencyScheduler
+ * records seconds of service per FLOP.
+ */
+class PerformanceProfile
+{
+  public:
+    /**
+     * @brief Learned estimate of one key.
+     */
+    struct Estimate
+    {
+        uint32_t samples{0}; //!< Samples recorded
+        double mean{0};      //!< Moving average of the samples
+        double variance{0};  //!< Moving variance of the samples
+    };
+
+    /**
+     * @brief Record a sample.
+     * @param backendIdx The backend index.
+     * @param taskType The task type.
+     * @param frequency The backend's clock in Hz (0 = unknown).
+     * @param value The observed sample.
+     * @param gain Weight of the new sample, in (0, 1].
+     */
+    void Record(uint32_t backendIdx,
+                uint8_t taskType,
+                double frequency,
+                double value,
+                double gain);
+
+    /**
+     * @brief Find the estimate of a key.
+     * @param backendIdx The backend index.
+     * @param taskType The task type.
+     * @param frequency The backend's clock in Hz (0 = unknown).
+     * @return The estimate, or nullptr if no sample was recorded.
+     */
+    const Estimate* Find(uint32_t backendIdx, uint8_t taskType, double frequency) const;
+
+    /**
+     * @brief Get the number of samples recorded for a task type on any backend.
+     * @param taskType The task type.
+     * @return Number of samples.
+     */
+    uint32_t GetSamples(uint8_t taskType) const;
+
+    /**
+     * @brief Forget all estimates.
+     */
+    void Clear();
+
+  private:
+    std::map<std::tuple<uint32_t, uint8_t, double>, Estimate>
+        m_estimates;                      //!< (backend, task type, frequency) → estimate
+    std::map<uint8_t, uint32_t> m_totals; //!< Samples per task type
+};
+
+} // namespace ns3
+
+#endif // PERFORMANCE_PROFILE_H
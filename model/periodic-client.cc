@@ -18,6 +18,7 @@
 #include "ns3/pointer.h"
 #include "ns3/simulator.h"
 #include "ns3/string.h"
+#include "ns3/uinteger.h"
 
 namespace ns3
 {
@@ -78,6 +79,27 @@ PeriodicClient::GetTypeId()
                           StringValue("ns3::ConstantRandomVariable[Constant=1.0]"),
                           MakePointerAccessor(&PeriodicClient::m_outputSize),
                           MakePointerChecker<RandomVariableStream>())
+            .AddAttribute("ModelId",
+                          "Model each frame needs resident on the backend. Empty means none.",
+                          StringValue(""),
+                          MakeStringAccessor(&PeriodicClient::m_modelId),
+                          MakeStringChecker())
+            .AddAttribute("ModelSize",
+                          "Model weight size in bytes",
+                          UintegerValue(0),
+                          MakeUintegerAccessor(&PeriodicClient::m_modelSize),
+                          MakeUintegerChecker<uint64_t>())
+            .AddAttribute("Variants",
+                          "Number of cheaper variants attached to each frame for degraded "
+                          "admission. 0 means frames are admitted as they are or rejected.",
+                          UintegerValue(0),
+                          MakeUintegerAccessor(&PeriodicClient::m_variants),
+                          MakeUintegerChecker<uint32_t>(0, 254))
+            .AddAttribute("VariantScale",
+                          "Factor applied to compute demand and output size per variant",
+                          DoubleValue(0.5),
+                          MakeDoubleAccessor(&PeriodicClient::m_variantScale),
+                          MakeDoubleChecker<double>(0.0, 1.0))
             .AddTraceSource("FrameSent",
                             "Trace fired when a frame admission request is sent",
                             MakeTraceSourceAccessor(&PeriodicClient::m_frameSentTrace),
@@ -94,7 +116,11 @@ PeriodicClient::GetTypeId()
                 "FrameDropped",
                 "Trace fired when a frame is dropped because the previous frame is still pending",
                 MakeTraceSourceAccessor(&PeriodicClient::m_frameDroppedTrace),
-                "ns3::PeriodicClient::FrameDroppedTracedCallback");
+                "ns3::PeriodicClient::FrameDroppedTracedCallback")
+            .AddTraceSource("FrameDegraded",
+                            "Trace fired when a frame is admitted as a cheaper variant",
+                            MakeTraceSourceAccessor(&PeriodicClient::m_frameDegradedTrace),
+                            "ns3::PeriodicClient::FrameDegradedTracedCallback");
     return tid;
 }
 
@@ -103,10 +129,15 @@ PeriodicClient::PeriodicClient()
       m_frameRate(30.0),
       m_deadlineBudget(Seconds(0)),
       m_commBudget(Seconds(0)),
+      m_modelId(""),
+      m_modelSize(0),
+      m_variants(0),
+      m_variantScale(0.5),
       m_clientId(s_nextClientId++),
       m_framesSent(0),
       m_frameCount(0),
       m_framesDropped(0),
+      m_framesDegraded(0),
       m_nextDagId(1),
       m_totalTx(0),
       m_totalRx(0),
@@ -168,6 +199,12 @@ PeriodicClient::GetFramesDropped() const
     return m_framesDropped;
 }
 
+uint64_t
+PeriodicClient::GetFramesDegraded() const
+{
+    return m_framesDegraded;
+}
+
 uint64_t
 PeriodicClient::GetResponsesReceived() const
 {
@@ -293,6 +330,15 @@ PeriodicClient::GenerateFrame()
     task->SetComputeDemand(computeDemand);
     task->SetInputSize(frameSize);
     task->SetOutputSize(outputSize);
+    task->SetModelId(m_modelId);
+    task->SetModelSize(m_modelSize);
+
+    double scale = 1.0;
+    for (uint32_t v = 0; v < m_variants; v++)
+    {
+        scale *= m_variantScale;
+        task->AddVariant(computeDemand * scale, static_cast<uint64_t>(outputSize * scale));
+    }
 
     Time budget =
         m_deadlineBudget.IsStrictlyPositive() ? m_deadlineBudget : Seconds(1.0 / m_frameRate);
@@ -422,6 +468,21 @@ PeriodicClient::HandleAdmissionResponse(const OrchestratorHeader& orchHeader)
     if (orchHeader.IsAdmitted())
     {
         NS_LOG_INFO("PeriodicClient " << m_clientId << " admission ACCEPTED for dagId " << dagId);
+
+        uint32_t variant = orchHeader.GetVariant();
+        if (variant > 0)
+        {
+            Ptr<DagTask> dag = it->second.dag;
+            dag->ApplyVariant(variant);
+            m_framesDegraded++;
+            NS_LOG_INFO("PeriodicClient " << m_clientId << " degraded dagId " << dagId
+                                          << " to variant " << variant);
+            for (uint32_t i = 0; i < dag->GetTaskCount(); i++)
+            {
+                m_frameDegradedTrace(dag->GetTask(i), variant);
+            }
+        }
+
         SendFullData(dagId);
     }
     else
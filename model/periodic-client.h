@@ -21,6 +21,7 @@
 #include "ns3/traced-callback.h"
 
 #include <map>
+#include <string>
 
 namespace ns3
 {
@@ -34,6 +35,12 @@ class Packet;
  * PeriodicClient models a device that captures frames
  * at a fixed frame rate and offloads them to an edge server for processing.
  *
+ * With Variants set above zero, each frame also carries that many cheaper
+ * variants of its task, variant k scaling the compute demand and output
+ * size by VariantScale^k (e.g. a lower resolution or a smaller model). An
+ * orchestrator short of capacity may then admit the frame as a variant
+ * instead of rejecting it, and the frame is uploaded in that form.
+ *
  * Example usage:
  * @code
  * Ptr<PeriodicClient> client = CreateObject<PeriodicClient>();
@@ -87,6 +94,12 @@ class PeriodicClient : public Application
      */
     uint64_t GetFramesDropped() const;
 
+    /**
+     * @brief Get the number of frames admitted as a cheaper variant.
+     * @return Number of degraded frames.
+     */
+    uint64_t GetFramesDegraded() const;
+
     /**
      * @brief Get the number of responses received.
      * @return Number of processed frame results received.
@@ -138,6 +151,13 @@ class PeriodicClient : public Application
      */
     typedef void (*FrameDroppedTracedCallback)(uint64_t frameNumber);
 
+    /**
+     * @brief TracedCallback signature for frames admitted as a cheaper variant.
+     * @param task The task, as degraded.
+     * @param variant The variant the frame was admitted as.
+     */
+    typedef void (*FrameDegradedTracedCallback)(Ptr<const Task> task, uint32_t variant);
+
   protected:
     void DoDispose() override;
 
@@ -175,6 +195,10 @@ class PeriodicClient : public Application
     Ptr<RandomVariableStream> m_frameSize;     //!< Input image size in bytes
     Ptr<RandomVariableStream> m_computeDemand; //!< FLOPS per frame
     Ptr<RandomVariableStream> m_outputSize;    //!< Result size in bytes
+    std::string m_modelId;                     //!< Model needed per frame (empty = none)
+    uint64_t m_modelSize;                      //!< Model weight size in bytes
+    uint32_t m_variants;                       //!< Cheaper variants attached to each frame
+    double m_variantScale;                     //!< Demand and output scale per variant
 
     // State
     static uint32_t s_nextClientId; //!< Counter for assigning unique client IDs
@@ -183,6 +207,7 @@ class PeriodicClient : public Application
     uint64_t m_framesSent;          //!< Frames successfully submitted for admission
     uint64_t m_frameCount;          //!< Total frame generation events (sent + dropped)
     uint64_t m_framesDropped;       //!< Frames dropped due to pending workload
+    uint64_t m_framesDegraded;      //!< Frames admitted as a cheaper variant
     uint64_t m_nextDagId;           //!< Next DAG ID
     uint64_t m_totalTx;             //!< Total bytes transmitted
     uint64_t m_totalRx;             //!< Total bytes received
@@ -201,10 +226,11 @@ class PeriodicClient : public Application
     uint64_t m_responsesReceived; //!< Number of responses received
 
     // Trace sources
-    TracedCallback<Ptr<const Task>> m_frameSentTrace;            //!< Frame sent
-    TracedCallback<Ptr<const Task>, Time> m_frameProcessedTrace; //!< Frame processed
-    TracedCallback<Ptr<const Task>> m_frameRejectedTrace;        //!< Frame rejected
-    TracedCallback<uint64_t> m_frameDroppedTrace;                //!< Frame dropped
+    TracedCallback<Ptr<const Task>> m_frameSentTrace;               //!< Frame sent
+    TracedCallback<Ptr<const Task>, Time> m_frameProcessedTrace;    //!< Frame processed
+    TracedCallback<Ptr<const Task>> m_frameRejectedTrace;           //!< Frame rejected
+    TracedCallback<uint64_t> m_frameDroppedTrace;                   //!< Frame dropped
+    TracedCallback<Ptr<const Task>, uint32_t> m_frameDegradedTrace; //!< Frame degraded
 };
 
 } // namespace ns3
@@ -8,16 +8,22 @@
 
 #include "periodic-server.h"
 
+#include "device-metrics-header.h"
 #include "scaling-command-header.h"
 #include "simple-task.h"
+#include "task-cancel-header.h"
+#include "task-steal-header.h"
 #include "tcp-connection-manager.h"
 
+#include "ns3/boolean.h"
 #include "ns3/log.h"
 #include "ns3/node.h"
 #include "ns3/pointer.h"
 #include "ns3/simulator.h"
 #include "ns3/uinteger.h"
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -43,6 +49,17 @@ PeriodicServer::GetTypeId()
                           PointerValue(),
                           MakePointerAccessor(&PeriodicServer::m_connMgr),
                           MakePointerChecker<ConnectionManager>())
+            .AddAttribute("DeviceProtocol",
+                          "Protocol for device metrics reports (none if unset)",
+                          PointerValue(),
+                          MakePointerAccessor(&PeriodicServer::m_deviceProtocol),
+                          MakePointerChecker<DeviceProtocol>())
+            .AddAttribute("PiggybackMetrics",
+                          "Append a compact metrics trailer to each response instead of "
+                          "sending separate metrics reports (requires DeviceProtocol)",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&PeriodicServer::m_piggybackMetrics),
+                          MakeBooleanChecker())
             .AddTraceSource("FrameReceived",
                             "A frame has been received for processing",
                             MakeTraceSourceAccessor(&PeriodicServer::m_frameReceivedTrace),
@@ -50,16 +67,24 @@ PeriodicServer::GetTypeId()
             .AddTraceSource("FrameProcessed",
                             "A frame has been processed and response sent",
                             MakeTraceSourceAccessor(&PeriodicServer::m_frameProcessedTrace),
-                            "ns3::PeriodicServer::FrameProcessedTracedCallback");
+                            "ns3::PeriodicServer::FrameProcessedTracedCallback")
+            .AddTraceSource("FrameStolen",
+                            "A queued frame has been given up to another backend",
+                            MakeTraceSourceAccessor(&PeriodicServer::m_frameStolenTrace),
+                            "ns3::PeriodicServer::FrameStolenTracedCallback");
     return tid;
 }
 
 PeriodicServer::PeriodicServer()
     : m_port(9000),
       m_connMgr(nullptr),
-      m_accelerator(nullptr),
+      m_pool(nullptr),
+      m_deviceProtocol(nullptr),
+      m_piggybackMetrics(false),
       m_framesReceived(0),
       m_framesProcessed(0),
+      m_framesCancelled(0),
+      m_framesStolen(0),
       m_totalRx(0)
 {
     NS_LOG_FUNCTION(this);
@@ -75,11 +100,12 @@ PeriodicServer::DoDispose()
 {
     NS_LOG_FUNCTION(this);
 
-    if (m_accelerator)
+    for (const auto& accel : m_accelerators)
     {
-        m_accelerator->TraceDisconnectWithoutContext(
-            "TaskCompleted",
-            MakeCallback(&PeriodicServer::OnTaskCompleted, this));
+        accel->TraceDisconnectWithoutContext("TaskCompleted",
+                                             MakeCallback(&PeriodicServer::OnTaskCompleted, this));
+        accel->TraceDisconnectWithoutContext("TaskFailed",
+                                             MakeCallback(&PeriodicServer::OnTaskFailed, this));
     }
 
     if (m_connMgr)
@@ -90,7 +116,9 @@ PeriodicServer::DoDispose()
 
     m_rxBuffer.clear();
     m_pendingTasks.clear();
-    m_accelerator = nullptr;
+    m_accelerators.clear();
+    m_pool = nullptr;
+    m_deviceProtocol = nullptr;
 
     Application::DoDispose();
 }
@@ -107,6 +135,18 @@ PeriodicServer::GetFramesProcessed() const
     return m_framesProcessed;
 }
 
+uint64_t
+PeriodicServer::GetFramesCancelled() const
+{
+    return m_framesCancelled;
+}
+
+uint64_t
+PeriodicServer::GetFramesStolen() const
+{
+    return m_framesStolen;
+}
+
 uint64_t
 PeriodicServer::GetTotalRx() const
 {
@@ -119,21 +159,48 @@ PeriodicServer::GetPort() const
     return m_port;
 }
 
+uint32_t
+PeriodicServer::GetDeviceCount() const
+{
+    return static_cast<uint32_t>(m_accelerators.size());
+}
+
 void
 PeriodicServer::StartApplication()
 {
     NS_LOG_FUNCTION(this);
 
-    m_accelerator = GetNode()->GetObject<Accelerator>();
-    if (!m_accelerator)
+    m_accelerators.clear();
+    m_pool = GetNode()->GetObject<AcceleratorPool>();
+    if (m_pool && m_pool->GetN() > 0)
     {
-        NS_LOG_WARN("No Accelerator aggregated to this node. Frames will be dropped.");
+        for (uint32_t i = 0; i < m_pool->GetN(); i++)
+        {
+            m_accelerators.push_back(m_pool->Get(i));
+        }
+        NS_LOG_INFO("Using accelerator pool with " << m_pool->GetN() << " devices");
     }
     else
     {
-        m_accelerator->TraceConnectWithoutContext(
-            "TaskCompleted",
-            MakeCallback(&PeriodicServer::OnTaskCompleted, this));
+        m_pool = nullptr;
+        Ptr<Accelerator> accel = GetNode()->GetObject<Accelerator>();
+        if (accel)
+        {
+            m_accelerators.push_back(accel);
+        }
+    }
+
+    if (m_accelerators.empty())
+    {
+        NS_LOG_WARN("No Accelerator aggregated to this node. Frames will be dropped.");
+    }
+
+    for (const auto& accel : m_accelerators)
+    {
+        accel->TraceConnectWithoutContext("TaskCompleted",
+                                          MakeCallback(&PeriodicServer::OnTaskCompleted, this));
+        accel->TraceConnectWithoutContext("TaskFailed",
+                                          MakeCallback(&PeriodicServer::OnTaskFailed, this));
     }
 
     if (!m_connMgr)
@@ -160,11 +227,12 @@ PeriodicServer::StopApplication()
 {
     NS_LOG_FUNCTION(this);
 
-    if (m_accelerator)
+    for (const auto& accel : m_accelerators)
     {
-        m_accelerator->TraceDisconnectWithoutContext(
-            "TaskCompleted",
-            MakeCallback(&PeriodicServer::OnTaskCompleted, this));
+        accel->TraceDisconnectWithoutContext("TaskCompleted",
+                                             MakeCallback(&PeriodicServer::OnTaskCompleted, this));
+        accel->TraceDisconnectWithoutContext("TaskFailed",
+                                             MakeCallback(&PeriodicServer::OnTaskFailed, this));
     }
 
     if (m_connMgr)
@@ -237,6 +305,26 @@ PeriodicServer::ProcessBuffer(const Address& clientAddr)
             continue;
         }
 
+        if (firstByte == TaskCancelHeader::TASK_CANCEL)
+        {
+            if (buffer->GetSize() < TaskCancelHeader::SERIALIZED_SIZE)
+            {
+                break;
+            }
+            HandleTaskCancel(buffer, clientAddr);
+            continue;
+        }
+
+        if (firstByte == TaskStealHeader::STEAL_REQUEST)
+        {
+            if (buffer->GetSize() < TaskStealHeader::SERIALIZED_SIZE)
+            {
+                break;
+            }
+            HandleStealRequest(buffer, clientAddr);
+            continue;
+        }
+
         uint64_t consumedBytes = 0;
         Ptr<Task> task = SimpleTask::Deserialize(buffer, consumedBytes);
 
@@ -276,21 +364,50 @@ PeriodicServer::ProcessTask(Ptr<Task> task, const Address& clientAddr)
                                         << ", compute=" << task->GetComputeDemand()
                                         << ", input=" << task->GetInputSize() << ")");
 
-    if (!m_accelerator)
+    if (m_accelerators.empty())
     {
         NS_LOG_ERROR("No accelerator available, dropping frame " << task->GetTaskId());
         return;
     }
 
+    uint32_t deviceIdx = 0;
+    if (m_pool)
+    {
+        deviceIdx = static_cast<uint32_t>(m_pool->Select(task));
+    }
+
     task->SetArrivalTime(Simulator::Now());
 
     PendingTask pending;
     pending.clientAddr = clientAddr;
     pending.task = task;
+    pending.deviceIdx = deviceIdx;
+    pending.cancelled = false;
     m_pendingTasks[task->GetTaskId()] = pending;
 
-    m_accelerator->SubmitTask(task);
-    NS_LOG_DEBUG("Submitted task " << task->GetTaskId() << " to accelerator");
+    // A piggybacked hint stands in for a scaling command, so it is node-level too
+    if (task->GetTargetFrequency() > 0)
+    {
+        for (const auto& accel : m_accelerators)
+        {
+            accel->SetFrequency(task->GetTargetFrequency());
+            accel->SetVoltage(task->GetTargetVoltage());
+        }
+        NS_LOG_DEBUG("Applied frequency hint " << task->GetTargetFrequency() << " to "
+                                               << m_accelerators.size() << " devices");
+
+        // Applied once; a task given up to a steal must not carry it elsewhere
+        task->SetTargetFrequency(0);
+        task->SetTargetVoltage(0);
+    }
+
+    m_accelerators[deviceIdx]->SubmitTask(task);
+    NS_LOG_DEBUG("Submitted task " << task->GetTaskId() << " to device " << deviceIdx);
+
+    if (!m_piggybackMetrics)
+    {
+        SendMetrics(clientAddr, deviceIdx);
+    }
 }
 
 void
@@ -307,11 +424,59 @@ PeriodicServer::OnTaskCompleted(Ptr<const Task> task, Time duration)
 
     Address clientAddr = it->second.clientAddr;
     Ptr<Task> pendingTask = it->second.task;
+    uint32_t deviceIdx = it->second.deviceIdx;
+    bool cancelled = it->second.cancelled;
     m_pendingTasks.erase(it);
 
+    if (cancelled)
+    {
+        AcknowledgeCancel(task->GetTaskId(), clientAddr);
+        if (!m_piggybackMetrics)
+        {
+            SendMetrics(clientAddr, deviceIdx);
+        }
+        return;
+    }
+
     pendingTask->SetBackendTime(Simulator::Now() - pendingTask->GetArrivalTime());
 
     SendResponse(clientAddr, pendingTask, duration);
+    if (!m_piggybackMetrics)
+    {
+        SendMetrics(clientAddr, deviceIdx);
+    }
+}
+
+void
+PeriodicServer::OnTaskFailed(Ptr<const Task> task, std::string reason)
+{
+    NS_LOG_FUNCTION(this << task->GetTaskId() << reason);
+
+    auto it = m_pendingTasks.find(task->GetTaskId());
+    if (it == m_pendingTasks.end())
+    {
+        NS_LOG_DEBUG("Task " << task->GetTaskId() << " not found in pending tasks (not ours)");
+        return;
+    }
+
+    Address clientAddr = it->second.clientAddr;
+    uint32_t deviceIdx = it->second.deviceIdx;
+    bool cancelled = it->second.cancelled;
+    m_pendingTasks.erase(it);
+
+    // The protocol has no failure response; the orchestrator screens out what devices reject
+    if (cancelled)
+    {
+        AcknowledgeCancel(task->GetTaskId(), clientAddr);
+    }
+    else
+    {
+        NS_LOG_WARN("Task " << task->GetTaskId() << " failed on device " << deviceIdx << ": "
+                            << reason);
+    }
+
+    // Report the shorter queue even though no response carries it
+    SendMetrics(clientAddr, deviceIdx);
 }
 
 void
@@ -321,6 +486,12 @@ PeriodicServer::SendResponse(const Address& clientAddr, Ptr<const Task> task, Ti
 
     Ptr<Packet> packet = task->Serialize(true);
 
+    if (m_piggybackMetrics && m_deviceProtocol)
+    {
+        packet->AddAtEnd(m_pool ? m_deviceProtocol->CreatePoolMetricsTrailer(m_pool)
+                                : m_deviceProtocol->CreateMetricsTrailer(m_accelerators[0]));
+    }
+
     if (!m_connMgr->Send(packet, clientAddr))
     {
         NS_LOG_WARN("Failed to send response for task " << task->GetTaskId() << " to "
@@ -347,15 +518,170 @@ PeriodicServer::HandleScalingCommand(Ptr<Packet> buffer)
     ScalingCommandHeader header;
     fragment->RemoveHeader(header);
 
-    if (m_accelerator)
+    // Scaling commands are node-level: every local device follows them
+    for (const auto& accel : m_accelerators)
+    {
+        accel->SetFrequency(header.GetTargetFrequency());
+        accel->SetVoltage(header.GetTargetVoltage());
+    }
+    NS_LOG_INFO("Applied scaling command to " << m_accelerators.size()
+                                              << " devices: freq=" << header.GetTargetFrequency()
+                                              << " volt=" << header.GetTargetVoltage());
+}
+
+void
+PeriodicServer::HandleTaskCancel(Ptr<Packet> buffer, const Address& clientAddr)
+{
+    NS_LOG_FUNCTION(this << clientAddr);
+
+    Ptr<Packet> fragment = buffer->CreateFragment(0, TaskCancelHeader::SERIALIZED_SIZE);
+    buffer->RemoveAtStart(TaskCancelHeader::SERIALIZED_SIZE);
+
+    TaskCancelHeader header;
+    fragment->RemoveHeader(header);
+    uint64_t taskId = header.GetTaskId();
+
+    // A task already answered has nothing left to withdraw
+    auto it = m_pendingTasks.find(taskId);
+    if (it == m_pendingTasks.end() || it->second.clientAddr != clientAddr ||
+        it->second.cancelled)
+    {
+        NS_LOG_DEBUG("Cancel for task " << taskId << " which is not pending");
+        return;
+    }
+
+    // A running task keeps its device busy, so it is acknowledged when it finishes
+    uint32_t deviceIdx = it->second.deviceIdx;
+    if (!m_accelerators[deviceIdx]->RemoveQueuedTask(taskId))
+    {
+        it->second.cancelled = true;
+        NS_LOG_INFO("Cancelled running frame (task " << taskId << ")");
+        return;
+    }
+
+    m_pendingTasks.erase(it);
+    AcknowledgeCancel(taskId, clientAddr);
+    if (!m_piggybackMetrics)
+    {
+        SendMetrics(clientAddr, deviceIdx);
+    }
+}
+
+void
+PeriodicServer::AcknowledgeCancel(uint64_t taskId, const Address& clientAddr)
+{
+    NS_LOG_FUNCTION(this << taskId << clientAddr);
+
+    TaskCancelHeader header;
+    header.SetTaskId(taskId);
+    Ptr<Packet> packet = Create<Packet>();
+    packet->AddHeader(header);
+    m_connMgr->Send(packet, clientAddr);
+
+    m_framesCancelled++;
+    NS_LOG_INFO("Cancelled frame (task " << taskId << ")");
+}
+
+void
+PeriodicServer::HandleStealRequest(Ptr<Packet> buffer, const Address& clientAddr)
+{
+    NS_LOG_FUNCTION(this << clientAddr);
+
+    buffer->RemoveAtStart(TaskStealHeader::SERIALIZED_SIZE);
+
+    // Longest queues first; only tasks no device has started can be given up
+    std::vector<uint32_t> devices(m_accelerators.size());
+    for (uint32_t i = 0; i < devices.size(); i++)
+    {
+        devices[i] = i;
+    }
+    std::stable_sort(devices.begin(), devices.end(), [this](uint32_t a, uint32_t b) {
+        return m_accelerators[a]->GetQueueLength() > m_accelerators[b]->GetQueueLength();
+    });
+
+    TaskStealHeader header;
+    header.SetMessageType(TaskStealHeader::STEAL_RESPONSE);
+    Ptr<Packet> payload;
+    uint32_t stolenDevice = 0;
+    for (uint32_t deviceIdx : devices)
+    {
+        // Tasks whose sender has gone, or that were withdrawn, are dropped
+        Ptr<Task> task = m_accelerators[deviceIdx]->StealQueuedTask();
+        auto it = m_pendingTasks.end();
+        while (task)
+        {
+            it = m_pendingTasks.find(task->GetTaskId());
+            if (it != m_pendingTasks.end() && !it->second.cancelled)
+            {
+                break;
+            }
+            if (it != m_pendingTasks.end())
+            {
+                Address sender = it->second.clientAddr;
+                m_pendingTasks.erase(it);
+                AcknowledgeCancel(task->GetTaskId(), sender);
+            }
+            task = m_accelerators[deviceIdx]->StealQueuedTask();
+        }
+        if (!task)
+        {
+            continue;
+        }
+
+        if (it->second.clientAddr != clientAddr)
+        {
+            // Only the task's own sender may move it
+            m_accelerators[deviceIdx]->SubmitTask(task);
+            continue;
+        }
+
+        m_pendingTasks.erase(it);
+        m_framesStolen++;
+        m_frameStolenTrace(task);
+        header.SetTaskId(task->GetTaskId());
+        payload = task->Serialize(false);
+        header.SetPayloadSize(payload->GetSize());
+        stolenDevice = deviceIdx;
+        NS_LOG_INFO("Gave up queued frame (task " << task->GetTaskId() << ") from device "
+                                                  << deviceIdx);
+        break;
+    }
+
+    Ptr<Packet> packet = payload ? payload : Create<Packet>();
+    packet->AddHeader(header);
+    m_connMgr->Send(packet, clientAddr);
+
+    if (payload && !m_piggybackMetrics)
     {
-        m_accelerator->SetFrequency(header.GetTargetFrequency());
-        m_accelerator->SetVoltage(header.GetTargetVoltage());
-        NS_LOG_INFO("Applied scaling command: freq=" << header.GetTargetFrequency()
-                                                     << " volt=" << header.GetTargetVoltage());
+        SendMetrics(clientAddr, stolenDevice);
     }
 }
 
+void
+PeriodicServer::SendMetrics(const Address& clientAddr, uint32_t deviceIdx)
+{
+    NS_LOG_FUNCTION(this << clientAddr << deviceIdx);
+
+    if (!m_deviceProtocol)
+    {
+        return;
+    }
+
+    if (!m_pool)
+    {
+        m_connMgr->Send(m_deviceProtocol->CreateMetricsPacket(m_accelerators[deviceIdx]),
+                        clientAddr);
+        return;
+    }
+
+    m_connMgr->Send(
+        m_deviceProtocol->CreatePoolMetricsPacket(m_pool, static_cast<uint16_t>(deviceIdx)),
+        clientAddr);
+    m_connMgr->Send(
+        m_deviceProtocol->CreatePoolMetricsPacket(m_pool, DeviceMetricsHeader::AGGREGATE_DEVICE),
+        clientAddr);
+}
+
 void
 PeriodicServer::CleanupClient(const Address& clientAddr)
 {
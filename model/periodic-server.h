@@ -9,8 +9,10 @@
 #ifndef PERIODIC_SERVER_H
 #define PERIODIC_SERVER_H
 
+#include "accelerator-pool.h"
 #include "accelerator.h"
 #include "connection-manager.h"
+#include "device-protocol.h"
 #include "task.h"
 
 #include "ns3/address.h"
@@ -19,7 +21,9 @@
 #include "ns3/traced-callback.h"
 
 #include <map>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace ns3
 {
@@ -31,6 +35,32 @@ namespace ns3
  * PeriodicServer receives frames from an EdgeOrchestrator, submits them
  * to the Accelerator aggregated on the node and sends processing results back when frames complete.
  *
+ * If an AcceleratorPool is aggregated on the node, frames are dispatched
+ * across its devices using the pool's DispatchPolicy. When a DeviceProtocol
+ * is configured, the server reports device metrics to the orchestrator after
+ * every submission and completion: one report for a single accelerator, or a
+ * per-device report followed by a node-level aggregate for a pool. With
+ * PiggybackMetrics enabled, these reports are replaced by a compact
+ * node-level MetricsTrailerHeader appended to each task response.
+ *
+ * A frequency hint carried by a task (Task::GetTargetFrequency()) stands in
+ * for a scaling command: it is applied to every local device just before
+ * the task is submitted, matching the node-level clock the DeviceManager
+ * records for the backend. The hint is then cleared, so it is not sent on
+ * with a task given up to a steal.
+ *
+ * A TaskCancelHeader for a task still pending withdraws it: its result is
+ * not sent and the header is echoed back as acknowledgement once the task
+ * no longer occupies a device. A queued task is taken off its device's
+ * queue and acknowledged at once; a running one is acknowledged when it
+ * finishes, so the sender can count the device busy until then.
+ *
+ * A STEAL_REQUEST TaskStealHeader asks the server to give up a queued
+ * task that no device has started: the last task queued on the device
+ * with the longest queue is withdrawn and its request returned after a
+ * STEAL_RESPONSE header, for the orchestrator to run elsewhere. The
+ * response carries no payload if there was nothing to give up.
+ *
  * Example usage:
  * @code
  * Ptr<PeriodicServer> server = CreateObject<PeriodicServer>();
@@ -63,6 +93,18 @@ class PeriodicServer : public Application
      */
     uint64_t GetFramesProcessed() const;
 
+    /**
+     * @brief Get the number of frames withdrawn by the orchestrator.
+     * @return Number of frames cancelled before their response was sent.
+     */
+    uint64_t GetFramesCancelled() const;
+
+    /**
+     * @brief Get the number of queued frames given up to another backend.
+     * @return Number of frames withdrawn by steal requests.
+     */
+    uint64_t GetFramesStolen() const;
+
     /**
      * @brief Get the total bytes received.
      * @return Total bytes received.
@@ -75,6 +117,12 @@ class PeriodicServer : public Application
      */
     uint16_t GetPort() const;
 
+    /**
+     * @brief Get the number of local accelerators in use.
+     * @return Number of devices frames are dispatched across.
+     */
+    uint32_t GetDeviceCount() const;
+
     /**
      * @brief TracedCallback signature for frame received events.
      * @param task The task representing the received frame.
@@ -88,6 +136,12 @@ class PeriodicServer : public Application
      */
     typedef void (*FrameProcessedTracedCallback)(Ptr<const Task> task, Time duration);
 
+    /**
+     * @brief TracedCallback signature for frame stolen events.
+     * @param task The queued task given up to another backend.
+     */
+    typedef void (*FrameStolenTracedCallback)(Ptr<const Task> task);
+
   protected:
     void DoDispose() override;
 
@@ -100,8 +154,13 @@ class PeriodicServer : public Application
     void ProcessBuffer(const Address& clientAddr);
     void ProcessTask(Ptr<Task> task, const Address& clientAddr);
     void OnTaskCompleted(Ptr<const Task> task, Time duration);
+    void OnTaskFailed(Ptr<const Task> task, std::string reason);
     void SendResponse(const Address& clientAddr, Ptr<const Task> task, Time duration);
     void HandleScalingCommand(Ptr<Packet> buffer);
+    void HandleTaskCancel(Ptr<Packet> buffer, const Address& clientAddr);
+    void AcknowledgeCancel(uint64_t taskId, const Address& clientAddr);
+    void HandleStealRequest(Ptr<Packet> buffer, const Address& clientAddr);
+    void SendMetrics(const Address& clientAddr, uint32_t deviceIdx);
     void CleanupClient(const Address& clientAddr);
 
     // Configuration
@@ -110,8 +169,13 @@ class PeriodicServer : public Application
     // Transport
     Ptr<ConnectionManager> m_connMgr; //!< Connection manager for transport
 
-    // Accelerator
-    Ptr<Accelerator> m_accelerator; //!< Cached accelerator reference
+    // Accelerators
+    Ptr<AcceleratorPool> m_pool;                  //!< Node accelerator pool (nullable)
+    std::vector<Ptr<Accelerator>> m_accelerators; //!< Cached local devices
+
+    // Device management
+    Ptr<DeviceProtocol> m_deviceProtocol; //!< Protocol for metrics reports (nullable)
+    bool m_piggybackMetrics;              //!< Append metrics trailers to responses
 
     // Per-client receive buffers
     std::map<Address, Ptr<Packet>> m_rxBuffer;
@@ -121,6 +185,8 @@ class PeriodicServer : public Application
     {
         Address clientAddr; //!< Client address for response routing
         Ptr<Task> task;     //!< The task being processed
+        uint32_t deviceIdx; //!< Local device executing the task
+        bool cancelled;     //!< Withdrawn while running; acknowledged when done
     };
 
     std::unordered_map<uint64_t, PendingTask> m_pendingTasks;
@@ -128,11 +194,14 @@ class PeriodicServer : public Application
     // Statistics
     uint64_t m_framesReceived;  //!< Number of frames received
     uint64_t m_framesProcessed; //!< Number of frames processed
+    uint64_t m_framesCancelled; //!< Number of frames withdrawn before completion
+    uint64_t m_framesStolen;    //!< Number of queued frames given up to another backend
     uint64_t m_totalRx;         //!< Total bytes received
 
     // Trace sources
     TracedCallback<Ptr<const Task>> m_frameReceivedTrace;        //!< Frame received
     TracedCallback<Ptr<const Task>, Time> m_frameProcessedTrace; //!< Frame processed
+    TracedCallback<Ptr<const Task>> m_frameStolenTrace;          //!< Frame given up
 };
 
 } // namespace ns3
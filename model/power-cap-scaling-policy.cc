@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#include "power-cap-scaling-policy.h"
+
+#include "ns3/double.h"
+#include "ns3/log.h"
+#include "ns3/pointer.h"
+
+#include <algorithm>
+#include <limits>
+#include <queue>
+#include <tuple>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("PowerCapScalingPolicy");
+
+NS_OBJECT_ENSURE_REGISTERED(PowerCapScalingPolicy);
+
+TypeId
+PowerCapScalingPolicy::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::PowerCapScalingPolicy")
+            .SetParent<ClusterScalingPolicy>()
+            .SetGroupName("Distributed")
+            .AddConstructor<PowerCapScalingPolicy>()
+            .AddAttribute("PowerBudget",
+                          "Cluster-wide power budget in Watts",
+                          DoubleValue(1000.0),
+                          MakeDoubleAccessor(&PowerCapScalingPolicy::m_powerBudget),
+                          MakeDoubleChecker<double>(0.0))
+            .AddAttribute("DeadlinePolicy",
+                          "Policy giving the frequency each backend needs to meet its "
+                          "deadlines (null = throughput only)",
+                          PointerValue(),
+                          MakePointerAccessor(&PowerCapScalingPolicy::m_deadlinePolicy),
+                          MakePointerChecker<DeadlineScalingPolicy>());
+    return tid;
+}
+
+PowerCapScalingPolicy::PowerCapScalingPolicy()
+    : m_powerBudget(1000.0),
+      m_deadlinePolicy(nullptr),
+      m_predictedPower(0.0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+PowerCapScalingPolicy::~PowerCapScalingPolicy()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+std::vector<Ptr<ScalingDecision>>
+PowerCapScalingPolicy::Decide(const ClusterState& state,
+                              const std::vector<BackendProfile>& profiles)
+{
+    NS_LOG_FUNCTION(this);
+
+    uint32_t n = std::min<uint32_t>(state.GetN(), profiles.size());
+    std::vector<size_t> level(n, 0);
+    std::vector<bool> managed(n, false);
+
+    double used = 0;
+    for (uint32_t i = 0; i < n; i++)
+    {
+        if (profiles[i].operatingPoints.empty() || !profiles[i].energyModel)
+        {
+            continue;
+        }
+        managed[i] = true;
+        used += GetPower(state.Get(i), profiles[i], 0);
+    }
+    if (used > m_powerBudget)
+    {
+        NS_LOG_WARN("Power budget " << m_powerBudget << " W below the cluster minimum of "
+                                    << used << " W");
+    }
+
+    auto stepCost = [&](uint32_t i, size_t to) {
+        return GetPower(state.Get(i), profiles[i], to) -
+               GetPower(state.Get(i), profiles[i], level[i]);
+    };
+
+    // Deadline floors, cheapest first so that as many backends as possible meet theirs
+    if (m_deadlinePolicy)
+    {
+        std::vector<std::tuple<double, uint32_t, size_t>> floors;
+        for (uint32_t i = 0; i < n; i++)
+        {
+            if (!managed[i] || state.Get(i).activeTasks == 0)
+            {
+                continue;
+            }
+            // As in DeadlineScalingPolicy, deadlines no OPP can meet ask for the top one
+            double required = m_deadlinePolicy->GetRequiredFrequency(state.Get(i));
+            const std::vector<OperatingPoint>& opps = profiles[i].operatingPoints;
+            size_t k = 0;
+            while (k + 1 < opps.size() && opps[k].frequency < required)
+            {
+                k++;
+            }
+            if (k > 0)
+            {
+                floors.emplace_back(stepCost(i, k), i, k);
+            }
+        }
+        std::sort(floors.begin(), floors.end());
+        for (const auto& floor : floors)
+        {
+            if (used + std::get<0>(floor) <= m_powerBudget)
+            {
+                used += std::get<0>(floor);
+                level[std::get<1>(floor)] = std::get<2>(floor);
+            }
+        }
+    }
+
+    // Spend the rest of the budget on the steps with the most throughput per Watt
+    auto stepValue = [&](uint32_t i) {
+        const std::vector<OperatingPoint>& opps = profiles[i].operatingPoints;
+        double gain = state.Get(i).activeTasks *
+                      (opps[level[i] + 1].frequency - opps[level[i]].frequency);
+        double cost = stepCost(i, level[i] + 1);
+        return cost > 0 ? gain / cost : std::numeric_limits<double>::infinity();
+    };
+
+    std::priority_queue<std::pair<double, uint32_t>> steps;
+    for (uint32_t i = 0; i < n; i++)
+    {
+        if (managed[i] && state.Get(i).activeTasks > 0 &&
+            level[i] + 1 < profiles[i].operatingPoints.size())
+        {
+            steps.emplace(stepValue(i), i);
+        }
+    }
+    while (!steps.empty())
+    {
+        uint32_t i = steps.top().second;
+        steps.pop();
+
+        // Higher steps of the same backend cost more, so a step that does not
+        // fit retires the backend while cheaper steps elsewhere remain
+        double cost = stepCost(i, level[i] + 1);
+        if (used + cost > m_powerBudget)
+        {
+            continue;
+        }
+        used += cost;
+        level[i]++;
+        if (level[i] + 1 < profiles[i].operatingPoints.size())
+        {
+            steps.emplace(stepValue(i), i);
+        }
+    }
+
+    m_predictedPower = used;
+    NS_LOG_DEBUG("Predicted cluster power " << used << " W of " << m_powerBudget << " W");
+
+    std::vector<Ptr<ScalingDecision>> decisions(state.GetN());
+    for (uint32_t i = 0; i < n; i++)
+    {
+        if (!managed[i])
+        {
+            continue;
+        }
+        const OperatingPoint& target = profiles[i].operatingPoints[level[i]];
+        if (target.frequency != state.Get(i).commandedFrequency)
+        {
+            decisions[i] = Create<ScalingDecision>();
+            decisions[i]->targetFrequency = target.frequency;
+            decisions[i]->targetVoltage = target.voltage;
+        }
+    }
+    return decisions;
+}
+
+double
+PowerCapScalingPolicy::GetPower(const ClusterState::BackendState& backend,
+                                const BackendProfile& profile,
+                                size_t level) const
+{
+    if (backend.activeTasks == 0)
+    {
+        return profile.deviceCount * profile.energyModel->GetStaticPower();
+    }
+    const OperatingPoint& opp = profile.operatingPoints[level];
+    return profile.deviceCount *
+           profile.energyModel->CalculatePower(opp.frequency, opp.voltage, 1.0).GetTotalPower();
+}
+
+double
+PowerCapScalingPolicy::GetPredictedPower() const
+{
+    return m_predictedPower;
+}
+
+std::string
+PowerCapScalingPolicy::GetName() const
+{
+    return "PowerCap";
+}
+
+} // namespace ns3
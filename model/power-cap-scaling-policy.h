@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#ifndef POWER_CAP_SCALING_POLICY_H
+#define POWER_CAP_SCALING_POLICY_H
+
+#include "cluster-scaling-policy.h"
+#include "deadline-scaling-policy.h"
+
+namespace ns3
+{
+
+/**
+ * @ingroup distributed
+ * @brief Cluster DVFS policy that maximises throughput under a shared power budget.
+ *
+ * The power of each backend at each OPP is predicted from its
+ * DvfsEnergyModel: busy backends are budgeted at full utilization
+ * (P_static + C * V^2 * f per device), idle backends at their static power.
+ * Every backend starts at its lowest OPP, then the budget is divided in two
+ * passes:
+ *
+ * 1. Deadline pressure. If a DeadlinePolicy is configured, busy backends are
+ *    raised to the lowest OPP meeting their outstanding deadlines, or to
+ *    the top OPP if none does, cheapest first, while the budget allows.
+ * 2. Load. The remaining budget is spent greedily one OPP step at a time,
+ *    always taking the step with the most throughput per Watt, weighted by
+ *    the backend's active task count: activeTasks * df / dP.
+ *
+ * Idle backends stay at the lowest OPP. Backends without a DvfsEnergyModel
+ * or OPP table are not managed and their power is not counted.
+ *
+ * The budget bounds the predicted power of the chosen OPPs, not measured
+ * power: a budget below every managed backend at its lowest OPP cannot be
+ * met, and a backend that turns busy runs above its idle prediction until
+ * the next decision. The DeviceManager applies reductions before increases
+ * (see DeviceManager), but commands take effect as they reach each backend.
+ */
+class PowerCapScalingPolicy : public ClusterScalingPolicy
+{
+  public:
+    /**
+     * @brief Get the type ID.
+     * @return The object TypeId.
+     */
+    static TypeId GetTypeId();
+
+    PowerCapScalingPolicy();
+    ~PowerCapScalingPolicy() override;
+
+    std::vector<Ptr<ScalingDecision>> Decide(const ClusterState& state,
+                                             const std::vector<BackendProfile>& profiles) override;
+    std::string GetName() const override;
+
+    /**
+     * @brief Get the predicted cluster power of the last decision.
+     * @return Predicted power in Watts.
+     */
+    double GetPredictedPower() const;
+
+  private:
+    /**
+     * @brief Predict the power of a backend at an OPP.
+     * @param backend The backend state.
+     * @param profile The backend's OPP table and power model.
+     * @param level Index into the OPP table.
+     * @return Predicted power in Watts.
+     */
+    double GetPower(const ClusterState::BackendState& backend,
+                    const BackendProfile& profile,
+                    size_t level) const;
+
+    double m_powerBudget;                        //!< Cluster power budget in Watts
+    Ptr<DeadlineScalingPolicy> m_deadlinePolicy; //!< Source of per-backend deadline floors
+    double m_predictedPower;                     //!< Predicted power of the last decision
+};
+
+} // namespace ns3
+
+#endif // POWER_CAP_SCALING_POLICY_H
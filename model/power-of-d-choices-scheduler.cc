@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#include "power-of-d-choices-scheduler.h"
+
+#include "cluster-state.h"
+
+#include "ns3/log.h"
+#include "ns3/uinteger.h"
+
+#include <algorithm>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("PowerOfDChoicesScheduler");
+NS_OBJECT_ENSURE_REGISTERED(PowerOfDChoicesScheduler);
+
+TypeId
+PowerOfDChoicesScheduler::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::PowerOfDChoicesScheduler")
+            .SetParent<ClusterScheduler>()
+            .SetGroupName("Distributed")
+            .AddConstructor<PowerOfDChoicesScheduler>()
+            .AddAttribute("Choices",
+                          "Number of distinct backends sampled per scheduling decision",
+                          UintegerValue(2),
+                          MakeUintegerAccessor(&PowerOfDChoicesScheduler::m_choices),
+                          MakeUintegerChecker<uint32_t>(1));
+    return tid;
+}
+
+PowerOfDChoicesScheduler::PowerOfDChoicesScheduler()
+    : m_choices(2)
+{
+    NS_LOG_FUNCTION(this);
+    m_rng = CreateObject<UniformRandomVariable>();
+}
+
+PowerOfDChoicesScheduler::~PowerOfDChoicesScheduler()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+PowerOfDChoicesScheduler::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    m_rng = nullptr;
+    m_sample.clear();
+    ClusterScheduler::DoDispose();
+}
+
+int32_t
+PowerOfDChoicesScheduler::ScheduleTask(Ptr<Task> task,
+                                       const Cluster& cluster,
+                                       const ClusterState& state)
+{
+    NS_LOG_FUNCTION(this << task);
+
+    std::string required = task->GetRequiredAcceleratorType();
+
+    const std::vector<uint32_t>& pool = required.empty()
+                                            ? cluster.GetAvailableBackends()
+                                            : cluster.GetAvailableBackendsByType(required);
+
+    if (pool.empty())
+    {
+        NS_LOG_DEBUG("PowerOfDChoices: no suitable backends");
+        return -1;
+    }
+
+    // Floyd's algorithm draws d distinct positions with exactly d random numbers
+    uint32_t n = pool.size();
+    uint32_t d = std::min(m_choices, n);
+    m_sample.clear();
+    if (d == n)
+    {
+        m_sample = pool;
+    }
+    else
+    {
+        for (uint32_t j = n - d; j < n; j++)
+        {
+            uint32_t t = m_rng->GetInteger(0, j);
+            bool taken = std::find(m_sample.begin(), m_sample.end(), pool[t]) != m_sample.end();
+            m_sample.push_back(taken ? pool[j] : pool[t]);
+        }
+    }
+
+    // Reservoir tie-break: the k-th tied candidate replaces the choice with probability 1/k
+    int32_t bestIdx = -1;
+    uint32_t minLoad = UINT32_MAX;
+    uint32_t ties = 0;
+    for (uint32_t idx : m_sample)
+    {
+        uint32_t load = state.Get(idx).activeTasks;
+        if (load < minLoad)
+        {
+            minLoad = load;
+            bestIdx = static_cast<int32_t>(idx);
+            ties = 1;
+        }
+        else if (load == minLoad && m_rng->GetInteger(0, ties++) == 0)
+        {
+            bestIdx = static_cast<int32_t>(idx);
+        }
+    }
+
+    NS_LOG_DEBUG("PowerOfDChoices: scheduled task " << task->GetTaskId() << " to backend "
+                                                    << bestIdx << " (load=" << minLoad
+                                                    << ", sampled=" << d << " of " << n << ")");
+    return bestIdx;
+}
+
+std::string
+PowerOfDChoicesScheduler::GetName() const
+{
+    return "PowerOfDChoices";
+}
+
+int64_t
+PowerOfDChoicesScheduler::AssignStreams(int64_t stream)
+{
+    NS_LOG_FUNCTION(this << stream);
+    m_rng->SetStream(stream);
+    return 1;
+}
+
+} // namespace ns3
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#ifndef POWER_OF_D_CHOICES_SCHEDULER_H
+#define POWER_OF_D_CHOICES_SCHEDULER_H
+
+#include "cluster-scheduler.h"
+
+#include "ns3/random-variable-stream.h"
+
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @ingroup distributed
+ * @brief Randomised scheduler that picks the least loaded of d sampled backends.
+ *
+ * For each task, PowerOfDChoicesScheduler samples Choices distinct backends
+ * uniformly at random from the available backends matching the task's
+ * accelerator type and picks the one with the fewest active tasks, breaking
+ * ties uniformly. With d = 2 the maximum load is exponentially lower than
+ * random placement, at O(d) cost per decision independent of cluster size.
+ *
+ * Sampling also spreads simultaneous decisions made from the same (possibly
+ * stale) load view, avoiding the herd onto a single "least-loaded" backend
+ * that a global minimum search exhibits.
+ *
+ * If Choices is at least the number of candidates, every candidate is
+ * considered and the scheduler behaves like LeastLoadedScheduler without
+ * the warm-model preference.
+ */
+class PowerOfDChoicesScheduler : public ClusterScheduler
+{
+  public:
+    /**
+     * @brief Get the type ID.
+     * @return The object TypeId.
+     */
+    static TypeId GetTypeId();
+
+    PowerOfDChoicesScheduler();
+    ~PowerOfDChoicesScheduler() override;
+
+    /**
+     * @brief Select the least-loaded of d sampled backends for the task.
+     *
+     * @param task The task to schedule.
+     * @param cluster The cluster of backends.
+     * @param state Per-backend load state.
+     * @return Backend index, or -1 if no suitable backend.
+     */
+    int32_t ScheduleTask(Ptr<Task> task,
+                         const Cluster& cluster,
+                         const ClusterState& state) override;
+
+    /**
+     * @brief Get the scheduler name.
+     * @return "PowerOfDChoices"
+     */
+    std::string GetName() const override;
+
+    /**
+     * @brief Assign a fixed random variable stream number to the random variables used by this
+     * scheduler.
+     * @param stream First stream index to use.
+     * @return The number of stream indices assigned.
+     */
+    int64_t AssignStreams(int64_t stream);
+
+  protected:
+    void DoDispose() override;
+
+  private:
+    Ptr<UniformRandomVariable> m_rng; //!< RNG for sampling and breaking ties
+    uint32_t m_choices;               //!< Number of backends sampled per decision
+    std::vector<uint32_t> m_sample;   //!< Reused sample buffer
+};
+
+} // namespace ns3
+
+#endif // POWER_OF_D_CHOICES_SCHEDULER_H
@@ -35,6 +35,18 @@ QueueScheduler::~QueueScheduler()
     NS_LOG_FUNCTION(this);
 }
 
+Ptr<Task>
+QueueScheduler::RemoveLast()
+{
+    return nullptr;
+}
+
+Ptr<Task>
+QueueScheduler::Remove(uint64_t taskId)
+{
+    return nullptr;
+}
+
 void
 QueueScheduler::DoDispose()
 {
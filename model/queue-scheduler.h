@@ -85,6 +85,28 @@ class QueueScheduler : public Object
      */
     virtual Ptr<Task> Peek() const = 0;
 
+    /**
+     * @brief Remove and return the task that would be served last.
+     *
+     * Used to hand queued work to another device. Default implementation
+     * returns nullptr. Override in subclasses whose tasks may be taken.
+     *
+     * @return The task, or nullptr if there is none to give up.
+     */
+    virtual Ptr<Task> RemoveLast();
+
+    /**
+     * @brief Remove a queued task by ID.
+     *
+     * Used to withdraw a cancelled task before it starts. Default
+     * implementation returns nullptr. Override in subclasses whose tasks
+     * may be taken.
+     *
+     * @param taskId The task ID.
+     * @return The task, or nullptr if it is not queued.
+     */
+    virtual Ptr<Task> Remove(uint64_t taskId);
+
     /**
      * @brief Check if the queue is empty.
      *
@@ -33,11 +33,17 @@ class DeviceMetrics : public SimpleRefCount<DeviceMetrics>
   public:
     virtual ~DeviceMetrics() = default;
 
-    double frequency{0};     //!< Current frequency in Hz
-    double voltage{0};       //!< Current voltage in Volts
-    bool busy{false};        //!< Currently processing a task?
-    uint32_t queueLength{0}; //!< Tasks in queue (including current)
-    double currentPower{0};  //!< Current power consumption in Watts
+    double frequency{0};       //!< Current frequency in Hz
+    double voltage{0};         //!< Current voltage in Volts
+    bool busy{false};          //!< Currently processing a task?
+    uint32_t queueLength{0};   //!< Tasks in queue (including current)
+    double currentPower{0};    //!< Current power consumption in Watts
+    bool aggregate{true};      //!< Node-level summary rather than a single device
+    uint16_t deviceIndex{0};   //!< Device index within the backend (per-device reports)
+    uint16_t deviceCount{1};   //!< Number of devices on the backend
+    double temperature{0};     //!< Device temperature in degrees Celsius
+    bool throttled{false};     //!< Thermally throttled below the commanded OPP?
+    Time busyTime{Seconds(0)}; //!< Cumulative busy time (metrics trailers only)
 };
 
 /**
@@ -27,7 +27,13 @@ SimpleTaskHeader::SimpleTaskHeader()
       m_inputSize(0),
       m_outputSize(0),
       m_deadlineNs(-1),
-      m_acceleratorType("")
+      m_acceleratorType(""),
+      m_modelId(""),
+      m_modelSize(0),
+      m_targetFrequency(0.0),
+      m_targetVoltage(0.0),
+      m_computeTimeNs(0),
+      m_backendTimeNs(0)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -62,7 +68,13 @@ SimpleTaskHeader::GetSerializedSize() const
            sizeof(uint64_t) + // m_inputSize
            sizeof(uint64_t) + // m_outputSize
            sizeof(int64_t) +  // m_deadlineNs
-           ACCEL_TYPE_SIZE;   // m_acceleratorType (fixed 16 bytes)
+           ACCEL_TYPE_SIZE +  // m_acceleratorType (fixed 16 bytes)
+           MODEL_ID_SIZE +    // m_modelId (fixed 16 bytes)
+           sizeof(uint64_t) + // m_modelSize
+           sizeof(uint64_t) + // m_targetFrequency
+           sizeof(uint64_t) + // m_targetVoltage
+           sizeof(int64_t) +  // m_computeTimeNs
+           sizeof(int64_t);   // m_backendTimeNs
 }
 
 void
@@ -86,6 +98,24 @@ SimpleTaskHeader::Serialize(Buffer::Iterator start) const
     {
         start.WriteU8(i < m_acceleratorType.size() ? m_acceleratorType[i] : 0);
     }
+
+    for (uint32_t i = 0; i < MODEL_ID_SIZE; i++)
+    {
+        start.WriteU8(i < m_modelId.size() ? m_modelId[i] : 0);
+    }
+
+    start.WriteHtonU64(m_modelSize);
+
+    uint64_t frequencyBits;
+    std::memcpy(&frequencyBits, &m_targetFrequency, sizeof(m_targetFrequency));
+    start.WriteHtonU64(frequencyBits);
+
+    uint64_t voltageBits;
+    std::memcpy(&voltageBits, &m_targetVoltage, sizeof(m_targetVoltage));
+    start.WriteHtonU64(voltageBits);
+
+    start.WriteHtonU64(static_cast<uint64_t>(m_computeTimeNs));
+    start.WriteHtonU64(static_cast<uint64_t>(m_backendTimeNs));
 }
 
 uint32_t
@@ -124,6 +154,24 @@ SimpleTaskHeader::Deserialize(Buffer::Iterator start)
     }
     m_acceleratorType = std::string(accelBuf);
 
+    char modelBuf[MODEL_ID_SIZE + 1] = {0};
+    for (uint32_t i = 0; i < MODEL_ID_SIZE; i++)
+    {
+        modelBuf[i] = static_cast<char>(start.ReadU8());
+    }
+    m_modelId = std::string(modelBuf);
+
+    m_modelSize = start.ReadNtohU64();
+
+    uint64_t frequencyBits = start.ReadNtohU64();
+    std::memcpy(&m_targetFrequency, &frequencyBits, sizeof(m_targetFrequency));
+
+    uint64_t voltageBits = start.ReadNtohU64();
+    std::memcpy(&m_targetVoltage, &voltageBits, sizeof(m_targetVoltage));
+
+    m_computeTimeNs = static_cast<int64_t>(start.ReadNtohU64());
+    m_backendTimeNs = static_cast<int64_t>(start.ReadNtohU64());
+
     return start.GetDistanceFrom(original);
 }
 
@@ -148,7 +196,18 @@ SimpleTaskHeader::Print(std::ostream& os) const
     os << ", TaskId: " << m_taskId << ", ComputeDemand: " << m_computeDemand
        << ", InputSize: " << m_inputSize << ", OutputSize: " << m_outputSize
        << ", Deadline: " << (m_deadlineNs >= 0 ? std::to_string(m_deadlineNs) + "ns" : "none")
-       << ", AcceleratorType: " << (m_acceleratorType.empty() ? "any" : m_acceleratorType) << ")";
+       << ", AcceleratorType: " << (m_acceleratorType.empty() ? "any" : m_acceleratorType)
+       << ", Model: " << (m_modelId.empty() ? "none" : m_modelId);
+    if (m_targetFrequency > 0)
+    {
+        os << ", TargetFrequency: " << m_targetFrequency;
+    }
+    if (m_messageType == TASK_RESPONSE)
+    {
+        os << ", ComputeTime: " << m_computeTimeNs << "ns, BackendTime: " << m_backendTimeNs
+           << "ns";
+    }
+    os << ")";
 }
 
 std::string
@@ -270,4 +329,83 @@ SimpleTaskHeader::SetAcceleratorType(const std::string& type)
     m_acceleratorType = type.substr(0, ACCEL_TYPE_SIZE);
 }
 
+std::string
+SimpleTaskHeader::GetModelId() const
+{
+    return m_modelId;
+}
+
+void
+SimpleTaskHeader::SetModelId(const std::string& modelId)
+{
+    NS_LOG_FUNCTION(this << modelId);
+    // Truncate if longer than MODEL_ID_SIZE
+    m_modelId = modelId.substr(0, MODEL_ID_SIZE);
+}
+
+uint64_t
+SimpleTaskHeader::GetModelSize() const
+{
+    return m_modelSize;
+}
+
+void
+SimpleTaskHeader::SetModelSize(uint64_t modelSize)
+{
+    NS_LOG_FUNCTION(this << modelSize);
+    m_modelSize = modelSize;
+}
+
+double
+SimpleTaskHeader::GetTargetFrequency() const
+{
+    return m_targetFrequency;
+}
+
+void
+SimpleTaskHeader::SetTargetFrequency(double frequency)
+{
+    NS_LOG_FUNCTION(this << frequency);
+    m_targetFrequency = frequency;
+}
+
+double
+SimpleTaskHeader::GetTargetVoltage() const
+{
+    return m_targetVoltage;
+}
+
+void
+SimpleTaskHeader::SetTargetVoltage(double voltage)
+{
+    NS_LOG_FUNCTION(this << voltage);
+    m_targetVoltage = voltage;
+}
+
+int64_t
+SimpleTaskHeader::GetComputeTimeNs() const
+{
+    return m_computeTimeNs;
+}
+
+void
+SimpleTaskHeader::SetComputeTimeNs(int64_t computeTimeNs)
+{
+    NS_LOG_FUNCTION(this << computeTimeNs);
+    m_computeTimeNs = computeTimeNs;
+}
+
+int64_t
+SimpleTaskHeader::GetBackendTimeNs() const
+{
+    return m_backendTimeNs;
+}
+
+void
+SimpleTaskHeader::SetBackendTimeNs(int64_t backendTimeNs)
+{
+    NS_LOG_FUNCTION(this << backendTimeNs);
+    m_backendTimeNs = backendTimeNs;
+}
+
 } // namespace ns3
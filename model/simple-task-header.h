@@ -23,7 +23,9 @@ namespace ns3
  *
  * This header serializes task metadata for transmission between
  * clients and backends. It includes the task identifier,
- * compute demand, and input/output data sizes.
+ * compute demand, and input/output data sizes. Responses also carry the
+ * backend's timings of the task, so the orchestrator learns the service
+ * time the backend measured rather than one seen across the network.
  *
  */
 class SimpleTaskHeader : public TaskHeader
@@ -34,6 +36,11 @@ class SimpleTaskHeader : public TaskHeader
      */
     static constexpr uint32_t ACCEL_TYPE_SIZE = 16;
 
+    /**
+     * @brief Fixed size for model identifier string.
+     */
+    static constexpr uint32_t MODEL_ID_SIZE = 16;
+
     /**
      * @brief Serialized size of the header in bytes.
      *
@@ -45,8 +52,14 @@ class SimpleTaskHeader : public TaskHeader
      * - outputSize: 8 bytes
      * - deadline: 8 bytes (int64_t nanoseconds, -1 = no deadline)
      * - acceleratorType: 16 bytes
+     * - modelId: 16 bytes
+     * - modelSize: 8 bytes
+     * - targetFrequency: 8 bytes (double Hz, 0 = no hint)
+     * - targetVoltage: 8 bytes (double Volts)
+     * - computeTime: 8 bytes (int64_t nanoseconds, 0 in requests)
+     * - backendTime: 8 bytes (int64_t nanoseconds, 0 in requests)
      */
-    static constexpr uint32_t SERIALIZED_SIZE = 57;
+    static constexpr uint32_t SERIALIZED_SIZE = 113;
 
     /**
      * @brief Get the type ID.
@@ -131,6 +144,78 @@ class SimpleTaskHeader : public TaskHeader
      */
     void SetAcceleratorType(const std::string& type);
 
+    /**
+     * @brief Get the model identifier.
+     * @return The model identifier. Empty means no model.
+     */
+    std::string GetModelId() const;
+
+    /**
+     * @brief Set the model identifier.
+     * @param modelId The model identifier (max 16 chars, will be truncated if longer).
+     */
+    void SetModelId(const std::string& modelId);
+
+    /**
+     * @brief Get the model weight size in bytes.
+     * @return The model size.
+     */
+    uint64_t GetModelSize() const;
+
+    /**
+     * @brief Set the model weight size in bytes.
+     * @param modelSize The model size.
+     */
+    void SetModelSize(uint64_t modelSize);
+
+    /**
+     * @brief Get the operating point frequency hint for the executing device.
+     * @return The target frequency in Hz. 0 means no hint.
+     */
+    double GetTargetFrequency() const;
+
+    /**
+     * @brief Set the operating point frequency hint for the executing device.
+     * @param frequency The target frequency in Hz. 0 means no hint.
+     */
+    void SetTargetFrequency(double frequency);
+
+    /**
+     * @brief Get the operating point voltage hint for the executing device.
+     * @return The target voltage in Volts.
+     */
+    double GetTargetVoltage() const;
+
+    /**
+     * @brief Set the operating point voltage hint for the executing device.
+     * @param voltage The target voltage in Volts.
+     */
+    void SetTargetVoltage(double voltage);
+
+    /**
+     * @brief Get the time the backend's device spent executing the task.
+     * @return The compute time in nanoseconds. 0 if not measured.
+     */
+    int64_t GetComputeTimeNs() const;
+
+    /**
+     * @brief Set the time the backend's device spent executing the task.
+     * @param computeTimeNs The compute time in nanoseconds.
+     */
+    void SetComputeTimeNs(int64_t computeTimeNs);
+
+    /**
+     * @brief Get the time from the task's arrival at the backend to its response.
+     * @return The backend time in nanoseconds. 0 if not measured.
+     */
+    int64_t GetBackendTimeNs() const;
+
+    /**
+     * @brief Set the time from the task's arrival at the backend to its response.
+     * @param backendTimeNs The backend time in nanoseconds.
+     */
+    void SetBackendTimeNs(int64_t backendTimeNs);
+
     /**
      * @brief Get a string representation of the header.
      * @return String representation.
@@ -152,6 +237,12 @@ class SimpleTaskHeader : public TaskHeader
     uint64_t m_outputSize;         //!< Output data size in bytes
     int64_t m_deadlineNs;          //!< Task deadline in nanoseconds (-1 = no deadline)
     std::string m_acceleratorType; //!< Required accelerator type (empty = any)
+    std::string m_modelId;         //!< Model identifier (empty = none)
+    uint64_t m_modelSize;          //!< Model weight size in bytes
+    double m_targetFrequency;      //!< Frequency hint in Hz (0 = none)
+    double m_targetVoltage;        //!< Voltage hint in Volts
+    int64_t m_computeTimeNs;       //!< Device execution time in nanoseconds (0 = none)
+    int64_t m_backendTimeNs;       //!< Arrival to response at the backend in nanoseconds
 };
 
 } // namespace ns3
@@ -70,6 +70,15 @@ SimpleTask::Serialize(bool isResponse) const
     header.SetOutputSize(m_outputSize);
     header.SetDeadlineNs(m_deadline.IsNegative() ? -1 : m_deadline.GetNanoSeconds());
     header.SetAcceleratorType(GetRequiredAcceleratorType());
+    header.SetModelId(m_modelId);
+    header.SetModelSize(m_modelSize);
+    header.SetTargetFrequency(m_targetFrequency);
+    header.SetTargetVoltage(m_targetVoltage);
+    if (isResponse)
+    {
+        header.SetComputeTimeNs(m_computeTime.GetNanoSeconds());
+        header.SetBackendTimeNs(m_backendTime.GetNanoSeconds());
+    }
 
     Ptr<Packet> packet = Create<Packet>();
     packet->AddHeader(header);
@@ -123,11 +132,20 @@ SimpleTask::Deserialize(Ptr<Packet> packet, uint64_t& consumedBytes)
     task->SetInputSize(header.GetInputSize());
     task->SetOutputSize(header.GetOutputSize());
     task->SetRequiredAcceleratorType(header.GetAcceleratorType());
+    task->SetModelId(header.GetModelId());
+    task->SetModelSize(header.GetModelSize());
+    task->SetTargetFrequency(header.GetTargetFrequency());
+    task->SetTargetVoltage(header.GetTargetVoltage());
 
     if (header.HasDeadline())
     {
         task->SetDeadline(NanoSeconds(header.GetDeadlineNs()));
     }
+    if (header.IsResponse())
+    {
+        task->SetComputeTime(NanoSeconds(header.GetComputeTimeNs()));
+        task->SetBackendTime(NanoSeconds(header.GetBackendTimeNs()));
+    }
 
     consumedBytes = totalSize;
     return task;
@@ -155,11 +173,20 @@ SimpleTask::DeserializeHeader(Ptr<Packet> packet, uint64_t& consumedBytes)
     task->SetInputSize(header.GetInputSize());
     task->SetOutputSize(header.GetOutputSize());
     task->SetRequiredAcceleratorType(header.GetAcceleratorType());
+    task->SetModelId(header.GetModelId());
+    task->SetModelSize(header.GetModelSize());
+    task->SetTargetFrequency(header.GetTargetFrequency());
+    task->SetTargetVoltage(header.GetTargetVoltage());
 
     if (header.HasDeadline())
     {
         task->SetDeadline(NanoSeconds(header.GetDeadlineNs()));
     }
+    if (header.IsResponse())
+    {
+        task->SetComputeTime(NanoSeconds(header.GetComputeTimeNs()));
+        task->SetBackendTime(NanoSeconds(header.GetBackendTimeNs()));
+    }
 
     consumedBytes = SimpleTaskHeader::SERIALIZED_SIZE;
     return task;
@@ -50,6 +50,8 @@ class SimpleTask : public Task
     /**
      * @brief Serialize this task to a packet using SimpleTaskHeader.
      *
+     * A response also carries the task's recorded compute and backend times.
+     *
      * @param isResponse true for response (output payload), false for request (input payload).
      * @return A packet with SimpleTaskHeader and payload.
      */
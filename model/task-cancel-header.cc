@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#include "task-cancel-header.h"
+
+#include "ns3/log.h"
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("TaskCancelHeader");
+
+NS_OBJECT_ENSURE_REGISTERED(TaskCancelHeader);
+
+TypeId
+TaskCancelHeader::GetTypeId()
+{
+    static TypeId tid = TypeId("ns3::TaskCancelHeader")
+                            .SetParent<Header>()
+                            .SetGroupName("Distributed")
+                            .AddConstructor<TaskCancelHeader>();
+    return tid;
+}
+
+TaskCancelHeader::TaskCancelHeader()
+    : m_messageType(TASK_CANCEL),
+      m_taskId(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+TaskCancelHeader::~TaskCancelHeader()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+uint8_t
+TaskCancelHeader::GetMessageType() const
+{
+    return m_messageType;
+}
+
+void
+TaskCancelHeader::SetMessageType(uint8_t type)
+{
+    NS_LOG_FUNCTION(this << static_cast<int>(type));
+    m_messageType = type;
+}
+
+uint64_t
+TaskCancelHeader::GetTaskId() const
+{
+    return m_taskId;
+}
+
+void
+TaskCancelHeader::SetTaskId(uint64_t taskId)
+{
+    NS_LOG_FUNCTION(this << taskId);
+    m_taskId = taskId;
+}
+
+TypeId
+TaskCancelHeader::GetInstanceTypeId() const
+{
+    return GetTypeId();
+}
+
+uint32_t
+TaskCancelHeader::GetSerializedSize() const
+{
+    return SERIALIZED_SIZE;
+}
+
+void
+TaskCancelHeader::Serialize(Buffer::Iterator start) const
+{
+    NS_LOG_FUNCTION(this);
+    start.WriteU8(m_messageType);
+    start.WriteHtonU64(m_taskId);
+}
+
+uint32_t
+TaskCancelHeader::Deserialize(Buffer::Iterator start)
+{
+    NS_LOG_FUNCTION(this);
+    m_messageType = start.ReadU8();
+    m_taskId = start.ReadNtohU64();
+    return SERIALIZED_SIZE;
+}
+
+void
+TaskCancelHeader::Print(std::ostream& os) const
+{
+    os << "TaskCancelHeader(type=" << static_cast<int>(m_messageType) << ", taskId=" << m_taskId
+       << ")";
+}
+
+} // namespace ns3
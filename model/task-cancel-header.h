@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#ifndef TASK_CANCEL_HEADER_H
+#define TASK_CANCEL_HEADER_H
+
+#include "ns3/header.h"
+
+#include <cstdint>
+#include <ostream>
+
+namespace ns3
+{
+
+/**
+ * @ingroup distributed
+ * @brief Header for cancelling a dispatched task on a backend.
+ *
+ * TaskCancelHeader is sent by the EdgeOrchestrator to withdraw a task it
+ * no longer needs, such as the losing copy of a hedged task. A backend
+ * that still holds the task drops it without responding and echoes the
+ * header back as acknowledgement; a backend that has already responded
+ * ignores it. It is multiplexed on the same connection as task data using
+ * message type 8.
+ *
+ * Wire format (9 bytes):
+ * - messageType: 1 byte (TASK_CANCEL = 8)
+ * - taskId: 8 bytes
+ */
+class TaskCancelHeader : public Header
+{
+  public:
+    /**
+     * @brief Message type value for task cancellations.
+     */
+    static constexpr uint8_t TASK_CANCEL = 8;
+
+    /**
+     * @brief Serialized size of the header in bytes.
+     */
+    static constexpr uint32_t SERIALIZED_SIZE = 9;
+
+    /**
+     * @brief Get the type ID.
+     * @return The object TypeId.
+     */
+    static TypeId GetTypeId();
+
+    TaskCancelHeader();
+    ~TaskCancelHeader() override;
+
+    uint8_t GetMessageType() const;
+    void SetMessageType(uint8_t type);
+
+    uint64_t GetTaskId() const;
+    void SetTaskId(uint64_t taskId);
+
+    // Header interface
+    TypeId GetInstanceTypeId() const override;
+    uint32_t GetSerializedSize() const override;
+    void Serialize(Buffer::Iterator start) const override;
+    uint32_t Deserialize(Buffer::Iterator start) override;
+    void Print(std::ostream& os) const override;
+
+  private:
+    uint8_t m_messageType{TASK_CANCEL}; //!< Message type (always 8)
+    uint64_t m_taskId{0};               //!< Task to cancel
+};
+
+} // namespace ns3
+
+#endif // TASK_CANCEL_HEADER_H
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#include "task-steal-header.h"
+
+#include "ns3/log.h"
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("TaskStealHeader");
+
+NS_OBJECT_ENSURE_REGISTERED(TaskStealHeader);
+
+TypeId
+TaskStealHeader::GetTypeId()
+{
+    static TypeId tid = TypeId("ns3::TaskStealHeader")
+                            .SetParent<Header>()
+                            .SetGroupName("Distributed")
+                            .AddConstructor<TaskStealHeader>();
+    return tid;
+}
+
+TaskStealHeader::TaskStealHeader()
+    : m_messageType(STEAL_REQUEST),
+      m_taskId(0),
+      m_payloadSize(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+TaskStealHeader::~TaskStealHeader()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+uint8_t
+TaskStealHeader::GetMessageType() const
+{
+    return m_messageType;
+}
+
+void
+TaskStealHeader::SetMessageType(uint8_t type)
+{
+    NS_LOG_FUNCTION(this << static_cast<int>(type));
+    m_messageType = type;
+}
+
+uint64_t
+TaskStealHeader::GetTaskId() const
+{
+    return m_taskId;
+}
+
+void
+TaskStealHeader::SetTaskId(uint64_t taskId)
+{
+    NS_LOG_FUNCTION(this << taskId);
+    m_taskId = taskId;
+}
+
+uint32_t
+TaskStealHeader::GetPayloadSize() const
+{
+    return m_payloadSize;
+}
+
+void
+TaskStealHeader::SetPayloadSize(uint32_t size)
+{
+    NS_LOG_FUNCTION(this << size);
+    m_payloadSize = size;
+}
+
+TypeId
+TaskStealHeader::GetInstanceTypeId() const
+{
+    return GetTypeId();
+}
+
+uint32_t
+TaskStealHeader::GetSerializedSize() const
+{
+    return SERIALIZED_SIZE;
+}
+
+void
+TaskStealHeader::Serialize(Buffer::Iterator start) const
+{
+    NS_LOG_FUNCTION(this);
+    start.WriteU8(m_messageType);
+    start.WriteHtonU64(m_taskId);
+    start.WriteHtonU32(m_payloadSize);
+}
+
+uint32_t
+TaskStealHeader::Deserialize(Buffer::Iterator start)
+{
+    NS_LOG_FUNCTION(this);
+    m_messageType = start.ReadU8();
+    m_taskId = start.ReadNtohU64();
+    m_payloadSize = start.ReadNtohU32();
+    return SERIALIZED_SIZE;
+}
+
+void
+TaskStealHeader::Print(std::ostream& os) const
+{
+    os << "TaskStealHeader(type=" << static_cast<int>(m_messageType) << ", taskId=" << m_taskId
+       << ", payloadSize=" << m_payloadSize << ")";
+}
+
+} // namespace ns3
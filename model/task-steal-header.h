@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#ifndef TASK_STEAL_HEADER_H
+#define TASK_STEAL_HEADER_H
+
+#include "ns3/header.h"
+
+#include <cstdint>
+#include <ostream>
+
+namespace ns3
+{
+
+/**
+ * @ingroup distributed
+ * @brief Header for moving a queued task from a busy backend to an idle one.
+ *
+ * The EdgeOrchestrator sends a STEAL_REQUEST on behalf of an idle backend
+ * to the backend with the longest queue. The busy backend answers with a
+ * STEAL_RESPONSE: either carrying a queued task it gave up, whose request
+ * message follows the header and is re-sent to the idle backend, or
+ * with an empty payload if it had nothing to give. Both are multiplexed on
+ * the same connection as task data using message types 9 and 10.
+ *
+ * Wire format (13 bytes):
+ * - messageType: 1 byte (STEAL_REQUEST = 9, STEAL_RESPONSE = 10)
+ * - taskId: 8 bytes (the task given up; 0 in requests and empty responses)
+ * - payloadSize: 4 bytes (bytes of task request following the header)
+ */
+class TaskStealHeader : public Header
+{
+  public:
+    /**
+     * @brief Message type value for steal requests.
+     */
+    static constexpr uint8_t STEAL_REQUEST = 9;
+
+    /**
+     * @brief Message type value for steal responses.
+     */
+    static constexpr uint8_t STEAL_RESPONSE = 10;
+
+    /**
+     * @brief Serialized size of the header in bytes.
+     */
+    static constexpr uint32_t SERIALIZED_SIZE = 13;
+
+    /**
+     * @brief Get the type ID.
+     * @return The object TypeId.
+     */
+    static TypeId GetTypeId();
+
+    TaskStealHeader();
+    ~TaskStealHeader() override;
+
+    uint8_t GetMessageType() const;
+    void SetMessageType(uint8_t type);
+
+    uint64_t GetTaskId() const;
+    void SetTaskId(uint64_t taskId);
+
+    uint32_t GetPayloadSize() const;
+    void SetPayloadSize(uint32_t size);
+
+    // Header interface
+    TypeId GetInstanceTypeId() const override;
+    uint32_t GetSerializedSize() const override;
+    void Serialize(Buffer::Iterator start) const override;
+    uint32_t Deserialize(Buffer::Iterator start) override;
+    void Print(std::ostream& os) const override;
+
+  private:
+    uint8_t m_messageType{STEAL_REQUEST}; //!< Message type (9 or 10)
+    uint64_t m_taskId{0};                 //!< Task given up (responses only)
+    uint32_t m_payloadSize{0};            //!< Bytes of task request following the header
+};
+
+} // namespace ns3
+
+#endif // TASK_STEAL_HEADER_H
@@ -14,6 +14,8 @@
 #include "ns3/trace-source-accessor.h"
 #include "ns3/uinteger.h"
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -86,6 +88,16 @@ Task::GetTypeId()
                           StringValue(""),
                           MakeStringAccessor(&Task::m_requiredAcceleratorType),
                           MakeStringChecker())
+            .AddAttribute("ModelId",
+                          "Model that must be resident in device memory. Empty means none.",
+                          StringValue(""),
+                          MakeStringAccessor(&Task::m_modelId),
+                          MakeStringChecker())
+            .AddAttribute("ModelSize",
+                          "Model weight size in bytes",
+                          UintegerValue(0),
+                          MakeUintegerAccessor(&Task::m_modelSize),
+                          MakeUintegerChecker<uint64_t>())
             .AddTraceSource("State",
                             "Task lifecycle state transitions",
                             MakeTraceSourceAccessor(&Task::m_state),
@@ -118,6 +130,7 @@ Task::DoDispose()
     m_requiredAcceleratorType.clear();
     m_computeTime = Seconds(0);
     m_backendTime = Seconds(0);
+    m_variants.clear();
     Object::DoDispose();
 }
 
@@ -173,6 +186,50 @@ Task::SetComputeDemand(double flops)
     m_computeDemand = flops;
 }
 
+void
+Task::AddVariant(double flops, uint64_t outputBytes)
+{
+    NS_LOG_FUNCTION(this << flops << outputBytes);
+    if (m_variants.empty())
+    {
+        m_variants.emplace_back(m_computeDemand, m_outputSize);
+    }
+    m_variants.emplace_back(flops, outputBytes);
+}
+
+uint32_t
+Task::GetVariantCount() const
+{
+    return m_variants.empty() ? 0 : static_cast<uint32_t>(m_variants.size() - 1);
+}
+
+double
+Task::GetVariantComputeDemand(uint32_t variant) const
+{
+    NS_ASSERT_MSG(variant >= 1 && variant <= GetVariantCount(), "Invalid variant " << variant);
+    return m_variants[variant].first;
+}
+
+uint64_t
+Task::GetVariantOutputSize(uint32_t variant) const
+{
+    NS_ASSERT_MSG(variant >= 1 && variant <= GetVariantCount(), "Invalid variant " << variant);
+    return m_variants[variant].second;
+}
+
+void
+Task::ApplyVariant(uint32_t variant)
+{
+    NS_LOG_FUNCTION(this << variant);
+    if (m_variants.empty())
+    {
+        return;
+    }
+    const auto& [flops, outputBytes] = m_variants[std::min<size_t>(variant, m_variants.size() - 1)];
+    m_computeDemand = flops;
+    m_outputSize = outputBytes;
+}
+
 Time
 Task::GetArrivalTime() const
 {
@@ -264,6 +321,58 @@ Task::SetRequiredAcceleratorType(const std::string& type)
     m_requiredAcceleratorType = type;
 }
 
+std::string
+Task::GetModelId() const
+{
+    return m_modelId;
+}
+
+void
+Task::SetModelId(const std::string& modelId)
+{
+    NS_LOG_FUNCTION(this << modelId);
+    m_modelId = modelId;
+}
+
+uint64_t
+Task::GetModelSize() const
+{
+    return m_modelSize;
+}
+
+void
+Task::SetModelSize(uint64_t modelSize)
+{
+    NS_LOG_FUNCTION(this << modelSize);
+    m_modelSize = modelSize;
+}
+
+double
+Task::GetTargetFrequency() const
+{
+    return m_targetFrequency;
+}
+
+void
+Task::SetTargetFrequency(double frequency)
+{
+    NS_LOG_FUNCTION(this << frequency);
+    m_targetFrequency = frequency;
+}
+
+double
+Task::GetTargetVoltage() const
+{
+    return m_targetVoltage;
+}
+
+void
+Task::SetTargetVoltage(double voltage)
+{
+    NS_LOG_FUNCTION(this << voltage);
+    m_targetVoltage = voltage;
+}
+
 TaskState
 Task::GetState() const
 {
@@ -17,6 +17,8 @@
 
 #include <ostream>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace ns3
 {
@@ -131,6 +133,48 @@ class Task : public Object
      */
     void SetComputeDemand(double flops);
 
+    /**
+     * @brief Attach a cheaper variant of the task for degraded-mode admission.
+     *
+     * Variants are ordered from the original downwards: variant 1 is the
+     * first one added, and each later one should be cheaper than the last.
+     *
+     * @param flops Compute demand of the variant in FLOPS.
+     * @param outputBytes Output size of the variant in bytes.
+     */
+    void AddVariant(double flops, uint64_t outputBytes);
+
+    /**
+     * @brief Get the number of variants attached to the task.
+     * @return The variant count (0 = the task can only run as it is).
+     */
+    uint32_t GetVariantCount() const;
+
+    /**
+     * @brief Get the compute demand of a variant.
+     * @param variant The variant (1 to GetVariantCount()).
+     * @return The variant's compute demand in FLOPS.
+     */
+    double GetVariantComputeDemand(uint32_t variant) const;
+
+    /**
+     * @brief Get the output size of a variant.
+     * @param variant The variant (1 to GetVariantCount()).
+     * @return The variant's output size in bytes.
+     */
+    uint64_t GetVariantOutputSize(uint32_t variant) const;
+
+    /**
+     * @brief Run the task as one of its variants.
+     *
+     * Sets the compute demand and output size to those of the variant. A
+     * variant beyond the last one selects the cheapest, and variant 0
+     * restores the values the task had when its first variant was added.
+     *
+     * @param variant The variant (0 = original).
+     */
+    void ApplyVariant(uint32_t variant);
+
     /**
      * @brief Get the task arrival time.
      * @return The arrival time.
@@ -214,6 +258,58 @@ class Task : public Object
      */
     void SetRequiredAcceleratorType(const std::string& type);
 
+    /**
+     * @brief Get the model this task needs resident in device memory.
+     * @return The model identifier. Empty string means no model.
+     */
+    std::string GetModelId() const;
+
+    /**
+     * @brief Set the model this task needs resident in device memory.
+     * @param modelId The model identifier. Empty string means no model.
+     */
+    void SetModelId(const std::string& modelId);
+
+    /**
+     * @brief Get the size of the model weights.
+     * @return The model weight size in bytes.
+     */
+    uint64_t GetModelSize() const;
+
+    /**
+     * @brief Set the size of the model weights.
+     * @param modelSize The model weight size in bytes.
+     */
+    void SetModelSize(uint64_t modelSize);
+
+    /**
+     * @brief Get the operating point frequency hint for the executing device.
+     *
+     * Set by the orchestrator on dispatch so the backend can apply a DVFS
+     * change just before the task is submitted, without a separate command.
+     *
+     * @return The target frequency in Hz. 0 means no hint.
+     */
+    double GetTargetFrequency() const;
+
+    /**
+     * @brief Set the operating point frequency hint for the executing device.
+     * @param frequency The target frequency in Hz. 0 means no hint.
+     */
+    void SetTargetFrequency(double frequency);
+
+    /**
+     * @brief Get the operating point voltage hint for the executing device.
+     * @return The target voltage in Volts.
+     */
+    double GetTargetVoltage() const;
+
+    /**
+     * @brief Set the operating point voltage hint for the executing device.
+     * @param voltage The target voltage in Volts.
+     */
+    void SetTargetVoltage(double voltage);
+
     /**
      * @brief Serialize this task to a packet for network transmission.
      *
@@ -274,8 +370,14 @@ class Task : public Object
     Time m_deadline{Time(-1)};                    //!< Task deadline (-1 = no deadline)
     uint32_t m_priority{0};                       //!< Task priority (higher = higher priority)
     std::string m_requiredAcceleratorType{""};    //!< Required accelerator type (empty = any)
+    std::string m_modelId{""};                    //!< Model needed in device memory (empty = none)
+    uint64_t m_modelSize{0};                      //!< Model weight size in bytes
+    double m_targetFrequency{0.0};                //!< Frequency hint in Hz (0 = none)
+    double m_targetVoltage{0.0};                  //!< Voltage hint in Volts
     Time m_computeTime{Seconds(0)};               //!< Accelerator execution time
     Time m_backendTime{Seconds(0)};               //!< Backend arrival to response (queue + compute)
+    std::vector<std::pair<double, uint64_t>>
+        m_variants; //!< (FLOPS, output bytes) per variant, with the original first
 };
 
 } // namespace ns3
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#include "thermal-model.h"
+
+#include "ns3/double.h"
+#include "ns3/log.h"
+#include "ns3/trace-source-accessor.h"
+
+#include <cmath>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("ThermalModel");
+
+NS_OBJECT_ENSURE_REGISTERED(ThermalModel);
+
+TypeId
+ThermalModel::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::ThermalModel")
+            .SetParent<Object>()
+            .SetGroupName("Distributed")
+            .AddConstructor<ThermalModel>()
+            .AddAttribute("AmbientTemperature",
+                          "Ambient (enclosure) temperature in degrees Celsius",
+                          DoubleValue(25.0),
+                          MakeDoubleAccessor(&ThermalModel::m_ambientTemperature),
+                          MakeDoubleChecker<double>())
+            .AddAttribute("ThermalResistance",
+                          "Junction-to-ambient thermal resistance in K/W",
+                          DoubleValue(0.25),
+                          MakeDoubleAccessor(&ThermalModel::m_thermalResistance),
+                          MakeDoubleChecker<double>(0.0))
+            .AddAttribute("ThermalCapacitance",
+                          "Heat capacity of the device in J/K (must be > 0)",
+                          DoubleValue(100.0),
+                          MakeDoubleAccessor(&ThermalModel::m_thermalCapacitance),
+                          MakeDoubleChecker<double>(1e-9))
+            .AddAttribute("ThrottleTemperature",
+                          "Temperature above which the accelerator throttles",
+                          DoubleValue(85.0),
+                          MakeDoubleAccessor(&ThermalModel::m_throttleTemperature),
+                          MakeDoubleChecker<double>())
+            .AddAttribute("ThrottleHysteresis",
+                          "Margin below ThrottleTemperature before throttling is released",
+                          DoubleValue(5.0),
+                          MakeDoubleAccessor(&ThermalModel::m_throttleHysteresis),
+                          MakeDoubleChecker<double>(0.0))
+            .AddAttribute("PollInterval",
+                          "Interval between throttling re-evaluations while hot",
+                          TimeValue(MilliSeconds(100)),
+                          MakeTimeAccessor(&ThermalModel::m_pollInterval),
+                          MakeTimeChecker(NanoSeconds(1)))
+            .AddTraceSource("Temperature",
+                            "Device temperature in degrees Celsius",
+                            MakeTraceSourceAccessor(&ThermalModel::m_temperature),
+                            "ns3::TracedValueCallback::Double");
+    return tid;
+}
+
+ThermalModel::ThermalModel()
+    : m_ambientTemperature(25.0),
+      m_thermalResistance(0.25),
+      m_thermalCapacitance(100.0),
+      m_throttleTemperature(85.0),
+      m_throttleHysteresis(5.0),
+      m_pollInterval(MilliSeconds(100)),
+      m_initialized(false),
+      m_temperature(25.0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+ThermalModel::~ThermalModel()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+ThermalModel::Update(double power, Time elapsed)
+{
+    NS_LOG_FUNCTION(this << power << elapsed);
+    double temperature = Project(power, elapsed);
+    m_initialized = true;
+    m_temperature = temperature;
+}
+
+double
+ThermalModel::GetTemperature() const
+{
+    // Devices start at ambient, which may be configured after construction
+    return m_initialized ? m_temperature.Get() : m_ambientTemperature;
+}
+
+double
+ThermalModel::Project(double power, Time elapsed) const
+{
+    double steadyState = m_ambientTemperature + m_thermalResistance * power;
+    double tau = m_thermalResistance * m_thermalCapacitance;
+    if (tau <= 0)
+    {
+        return steadyState;
+    }
+    return steadyState + (GetTemperature() - steadyState) * std::exp(-elapsed.GetSeconds() / tau);
+}
+
+Time
+ThermalModel::GetTimeToReach(double power, double target) const
+{
+    double steadyState = m_ambientTemperature + m_thermalResistance * power;
+    double current = GetTemperature();
+    if (current == target)
+    {
+        return Seconds(0);
+    }
+
+    // The target must lie strictly between the current and steady-state temperatures
+    if ((target - current) * (steadyState - target) <= 0)
+    {
+        return Time::Max();
+    }
+
+    double tau = m_thermalResistance * m_thermalCapacitance;
+    return Seconds(tau * std::log((steadyState - current) / (steadyState - target)));
+}
+
+double
+ThermalModel::GetThrottleTemperature() const
+{
+    return m_throttleTemperature;
+}
+
+double
+ThermalModel::GetReleaseTemperature() const
+{
+    return m_throttleTemperature - m_throttleHysteresis;
+}
+
+Time
+ThermalModel::GetPollInterval() const
+{
+    return m_pollInterval;
+}
+
+} // namespace ns3
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#ifndef THERMAL_MODEL_H
+#define THERMAL_MODEL_H
+
+#include "ns3/nstime.h"
+#include "ns3/object.h"
+#include "ns3/traced-value.h"
+
+namespace ns3
+{
+
+/**
+ * @ingroup distributed
+ * @brief First-order RC thermal model for accelerators.
+ *
+ * The die is modelled as a single thermal capacitance C connected to
+ * ambient through a thermal resistance R. Under constant power P the
+ * temperature relaxes exponentially towards T_amb + R * P with time
+ * constant R * C:
+ *
+ * T(t + dt) = T_ss + (T(t) - T_ss) * exp(-dt / (R * C))
+ *
+ * The model is advanced lazily by the Accelerator at each energy update
+ * point, since power is piecewise constant between them. Above
+ * ThrottleTemperature the accelerator steps down its OPP table until the
+ * temperature falls below ThrottleTemperature - ThrottleHysteresis.
+ *
+ * Example usage:
+ * @code
+ * Ptr<ThermalModel> thermal = CreateObject<ThermalModel>();
+ * thermal->SetAttribute("ThermalResistance", DoubleValue(0.5));  // K/W
+ * thermal->SetAttribute("ThermalCapacitance", DoubleValue(20));  // J/K
+ * gpu->SetAttribute("ThermalModel", PointerValue(thermal));
+ * @endcode
+ */
+class ThermalModel : public Object
+{
+  public:
+    /**
+     * @brief Get the type ID.
+     * @return The object TypeId.
+     */
+    static TypeId GetTypeId();
+
+    ThermalModel();
+    ~ThermalModel() override;
+
+    /**
+     * @brief Advance the temperature over an interval of constant power.
+     * @param power Power dissipated over the interval in Watts.
+     * @param elapsed Length of the interval.
+     */
+    void Update(double power, Time elapsed);
+
+    /**
+     * @brief Get the temperature at the last update.
+     * @return Temperature in degrees Celsius.
+     */
+    double GetTemperature() const;
+
+    /**
+     * @brief Project the temperature forward without updating state.
+     * @param power Power dissipated from the last update in Watts.
+     * @param elapsed Time since the last update.
+     * @return Projected temperature in degrees Celsius.
+     */
+    double Project(double power, Time elapsed) const;
+
+    /**
+     * @brief Compute when the temperature will reach a target.
+     * @param power Constant power dissipated from now in Watts.
+     * @param target Target temperature in degrees Celsius.
+     * @return Time until the target is reached, or Time::Max() if never.
+     */
+    Time GetTimeToReach(double power, double target) const;
+
+    /**
+     * @brief Get the temperature above which the accelerator throttles.
+     * @return Throttle temperature in degrees Celsius.
+     */
+    double GetThrottleTemperature() const;
+
+    /**
+     * @brief Get the temperature below which throttling is released.
+     * @return Release temperature in degrees Celsius.
+     */
+    double GetReleaseTemperature() const;
+
+    /**
+     * @brief Get the interval between throttling re-evaluations while hot.
+     * @return The poll interval.
+     */
+    Time GetPollInterval() const;
+
+  private:
+    double m_ambientTemperature;  //!< Ambient temperature in degrees Celsius
+    double m_thermalResistance;   //!< Junction-to-ambient resistance in K/W
+    double m_thermalCapacitance;  //!< Heat capacity in J/K
+    double m_throttleTemperature; //!< Throttle threshold in degrees Celsius
+    double m_throttleHysteresis;  //!< Release margin below the threshold in K
+    Time m_pollInterval;          //!< Re-evaluation interval while hot
+
+    bool m_initialized;                //!< Temperature has been advanced from ambient
+    TracedValue<double> m_temperature; //!< Temperature in degrees Celsius
+};
+
+} // namespace ns3
+
+#endif // THERMAL_MODEL_H
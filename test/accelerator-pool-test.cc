@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#include "ns3/accelerator-pool.h"
+#include "ns3/double.h"
+#include "ns3/enum.h"
+#include "ns3/fifo-queue-scheduler.h"
+#include "ns3/fixed-ratio-processing-model.h"
+#include "ns3/gpu-accelerator.h"
+#include "ns3/pointer.h"
+#include "ns3/simple-task.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+
+namespace ns3
+{
+namespace
+{
+
+Ptr<GpuAccelerator>
+CreateTestGpu(double frequency)
+{
+    Ptr<GpuAccelerator> gpu = CreateObject<GpuAccelerator>();
+    gpu->SetAttribute("ComputeRate", DoubleValue(1e12));
+    gpu->SetAttribute("MemoryBandwidth", DoubleValue(1e11));
+    gpu->SetAttribute("Frequency", DoubleValue(frequency));
+    gpu->SetAttribute("ProcessingModel", PointerValue(CreateObject<FixedRatioProcessingModel>()));
+    gpu->SetAttribute("QueueScheduler", PointerValue(CreateObject<FifoQueueScheduler>()));
+    return gpu;
+}
+
+Ptr<Task>
+CreateTestTask(uint64_t taskId)
+{
+    Ptr<Task> task = CreateObject<SimpleTask>();
+    task->SetTaskId(taskId);
+    task->SetComputeDemand(1e9);
+    task->SetInputSize(1000);
+    task->SetOutputSize(1000);
+    return task;
+}
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test AcceleratorPool least-queue selection and aggregate metrics
+ */
+class AcceleratorPoolLeastQueueTestCase : public TestCase
+{
+  public:
+    AcceleratorPoolLeastQueueTestCase()
+        : TestCase("Test AcceleratorPool least-queue selection and aggregates")
+    {
+    }
+
+  private:
+    void DoRun() override
+    {
+        Ptr<GpuAccelerator> gpu0 = CreateTestGpu(1.0e9);
+        Ptr<GpuAccelerator> gpu1 = CreateTestGpu(2.0e9);
+
+        Ptr<AcceleratorPool> pool = CreateObject<AcceleratorPool>();
+        pool->Add(gpu0);
+        pool->Add(gpu1);
+
+        NS_TEST_ASSERT_MSG_EQ(pool->GetN(), 2, "Pool should hold 2 devices");
+        NS_TEST_ASSERT_MSG_EQ(pool->Select(CreateTestTask(1)), 0, "Tie should pick lowest index");
+
+        gpu0->SubmitTask(CreateTestTask(1));
+        gpu0->SubmitTask(CreateTestTask(2));
+
+        NS_TEST_ASSERT_MSG_EQ(pool->Select(CreateTestTask(3)),
+                              1,
+                              "Should pick the device with the shorter queue");
+        NS_TEST_ASSERT_MSG_EQ(pool->GetQueueLength(), 2, "Aggregate queue length should be 2");
+        NS_TEST_ASSERT_MSG_EQ(pool->IsBusy(), true, "Pool should be busy");
+        NS_TEST_ASSERT_MSG_EQ_TOL(pool->GetFrequency(),
+                                  1.5e9,
+                                  1,
+                                  "Aggregate frequency should be the device mean");
+
+        Simulator::Run();
+        Simulator::Destroy();
+
+        NS_TEST_ASSERT_MSG_EQ(pool->IsBusy(), false, "Pool should be idle after processing");
+        NS_TEST_ASSERT_MSG_EQ(pool->GetQueueLength(), 0, "Aggregate queue should be empty");
+    }
+};
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test AcceleratorPool type-matching selection with fallback
+ */
+class AcceleratorPoolTypeMatchTestCase : public TestCase
+{
+  public:
+    AcceleratorPoolTypeMatchTestCase()
+        : TestCase("Test AcceleratorPool type-matching selection")
+    {
+    }
+
+  private:
+    void DoRun() override
+    {
+        Ptr<GpuAccelerator> gpu0 = CreateTestGpu(1.0e9);
+        Ptr<GpuAccelerator> gpu1 = CreateTestGpu(1.0e9);
+
+        Ptr<AcceleratorPool> pool = CreateObject<AcceleratorPool>();
+        pool->SetAttribute("DispatchPolicy", EnumValue(AcceleratorPool::TYPE_MATCH));
+        pool->Add(gpu0);
+        pool->Add(gpu1);
+
+        gpu0->SubmitTask(CreateTestTask(1));
+
+        Ptr<Task> gpuTask = CreateTestTask(2);
+        gpuTask->SetRequiredAcceleratorType("GPU");
+        NS_TEST_ASSERT_MSG_EQ(pool->Select(gpuTask), 1, "Should pick the idle matching device");
+
+        Ptr<Task> fpgaTask = CreateTestTask(3);
+        fpgaTask->SetRequiredAcceleratorType("FPGA");
+        NS_TEST_ASSERT_MSG_EQ(pool->Select(fpgaTask),
+                              1,
+                              "Unmatched type should fall back to the shortest queue");
+
+        Simulator::Run();
+        Simulator::Destroy();
+    }
+};
+
+} // namespace
+
+TestCase*
+CreateAcceleratorPoolLeastQueueTestCase()
+{
+    return new AcceleratorPoolLeastQueueTestCase;
+}
+
+TestCase*
+CreateAcceleratorPoolTypeMatchTestCase()
+{
+    return new AcceleratorPoolTypeMatchTestCase;
+}
+
+} // namespace ns3
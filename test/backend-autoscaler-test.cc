@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#include "ns3/backend-autoscaler.h"
+#include "ns3/cluster-state.h"
+#include "ns3/cluster.h"
+#include "ns3/double.h"
+#include "ns3/dvfs-energy-model.h"
+#include "ns3/fifo-queue-scheduler.h"
+#include "ns3/fixed-ratio-processing-model.h"
+#include "ns3/gpu-accelerator.h"
+#include "ns3/inet-socket-address.h"
+#include "ns3/ipv4-address.h"
+#include "ns3/node.h"
+#include "ns3/pointer.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+namespace
+{
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test BackendAutoscaler powers backends down, boots them, and drains
+ */
+class BackendAutoscalerTestCase : public TestCase
+{
+  public:
+    BackendAutoscalerTestCase()
+        : TestCase("Test BackendAutoscaler power-off, boot and drain")
+    {
+    }
+
+  private:
+    void DoRun() override
+    {
+        for (uint32_t i = 0; i < 3; i++)
+        {
+            Ptr<GpuAccelerator> gpu = CreateObject<GpuAccelerator>();
+            gpu->SetAttribute("ProcessingModel",
+                              PointerValue(CreateObject<FixedRatioProcessingModel>()));
+            gpu->SetAttribute("QueueScheduler",
+                              PointerValue(CreateObject<FifoQueueScheduler>()));
+            gpu->SetAttribute("BootDelay", TimeValue(MilliSeconds(500)));
+            Ptr<DvfsEnergyModel> energy = CreateObject<DvfsEnergyModel>();
+            energy->SetAttribute("StaticPower", DoubleValue(10.0));
+            gpu->SetAttribute("EnergyModel", PointerValue(energy));
+
+            Ptr<Node> node = CreateObject<Node>();
+            node->AggregateObject(gpu);
+            m_gpus.push_back(gpu);
+            std::string ip = "10.1." + std::to_string(i) + ".1";
+            m_cluster.AddBackend(node, InetSocketAddress(Ipv4Address(ip.c_str()), 9000));
+        }
+        m_state.Resize(3);
+
+        // One backend sustains 5 tasks/s at the target utilization
+        m_autoscaler = CreateObject<BackendAutoscaler>();
+        m_autoscaler->SetAttribute("ServiceRate", DoubleValue(10.0));
+        m_autoscaler->SetAttribute("TargetUtilization", DoubleValue(0.5));
+        m_autoscaler->SetAttribute("RateSmoothing", DoubleValue(1.0));
+        m_autoscaler->Start(m_cluster, m_state);
+
+        // Idle: one backend is powered down per interval, highest index first
+        Simulator::Schedule(Seconds(1.5), &BackendAutoscalerTestCase::CheckIdle, this);
+        Simulator::Schedule(Seconds(3.5), &BackendAutoscalerTestCase::Dispatch, this, 0, 12);
+
+        // 12 tasks/s needs three backends, which boot for 0.5 s
+        Simulator::Schedule(Seconds(4.2), &BackendAutoscalerTestCase::CheckBooting, this);
+        Simulator::Schedule(Seconds(4.6), &BackendAutoscalerTestCase::CheckBooted, this);
+        Simulator::Schedule(Seconds(4.7), &BackendAutoscalerTestCase::Dispatch, this, 1, 1);
+        Simulator::Schedule(Seconds(4.7), &BackendAutoscalerTestCase::Dispatch, this, 2, 2);
+
+        // 3 tasks/s needs one: the least-loaded backend drains first
+        Simulator::Schedule(Seconds(5.1), &BackendAutoscalerTestCase::CheckDraining, this);
+        Simulator::Schedule(Seconds(5.2), &BackendAutoscalerTestCase::Complete, this, 1);
+        Simulator::Schedule(Seconds(5.3), &BackendAutoscalerTestCase::CheckDrained, this);
+
+        Simulator::Stop(Seconds(5.5));
+        Simulator::Run();
+        m_autoscaler->Stop();
+        Simulator::Destroy();
+    }
+
+    void Dispatch(uint32_t backendIdx, uint32_t count)
+    {
+        for (uint32_t i = 0; i < count; i++)
+        {
+            m_state.NotifyTaskDispatched(backendIdx);
+        }
+    }
+
+    void Complete(uint32_t backendIdx)
+    {
+        m_state.NotifyTaskCompleted(backendIdx);
+        m_autoscaler->NotifyTaskCompleted(backendIdx);
+    }
+
+    void CheckIdle()
+    {
+        NS_TEST_EXPECT_MSG_EQ(m_cluster.GetNAvailable(), 2, "One backend powered down");
+        NS_TEST_EXPECT_MSG_EQ(m_autoscaler->GetPowerState(2),
+                              BackendAutoscaler::OFF,
+                              "Backend 2 should be off");
+        NS_TEST_EXPECT_MSG_EQ(m_gpus[2]->IsPoweredOn(), false, "GPU 2 should be off");
+        NS_TEST_EXPECT_MSG_EQ_TOL(m_gpus[2]->GetCurrentPower(), 0.0, 1e-9, "Zero power");
+    }
+
+    void CheckBooting()
+    {
+        NS_TEST_EXPECT_MSG_EQ(m_autoscaler->GetActiveBackendCount(), 3, "All backends active");
+        NS_TEST_EXPECT_MSG_EQ(m_cluster.GetNAvailable(), 1, "Booting backends are unavailable");
+        NS_TEST_EXPECT_MSG_EQ(m_autoscaler->GetPowerState(1),
+                              BackendAutoscaler::BOOTING,
+                              "Backend 1 should be booting");
+        NS_TEST_EXPECT_MSG_EQ(m_gpus[1]->IsPoweredOn(), true, "GPU 1 should be powered");
+        NS_TEST_EXPECT_MSG_EQ_TOL(m_gpus[1]->GetCurrentPower(), 10.0, 1e-9, "Idle power");
+    }
+
+    void CheckBooted()
+    {
+        NS_TEST_EXPECT_MSG_EQ(m_cluster.GetNAvailable(), 3, "Booted backends are available");
+    }
+
+    void CheckDraining()
+    {
+        NS_TEST_EXPECT_MSG_EQ(m_autoscaler->GetPowerState(1),
+                              BackendAutoscaler::DRAINING,
+                              "Backend 1 should drain its outstanding task");
+        NS_TEST_EXPECT_MSG_EQ(m_cluster.IsAvailable(1), false, "Draining takes no new tasks");
+        NS_TEST_EXPECT_MSG_EQ(m_gpus[1]->IsPoweredOn(), true, "Still powered while draining");
+    }
+
+    void CheckDrained()
+    {
+        NS_TEST_EXPECT_MSG_EQ(m_autoscaler->GetPowerState(1),
+                              BackendAutoscaler::OFF,
+                              "Backend 1 should power off once drained");
+        NS_TEST_EXPECT_MSG_EQ(m_gpus[1]->IsPoweredOn(), false, "GPU 1 should be off");
+    }
+
+    Cluster m_cluster;
+    ClusterState m_state;
+    std::vector<Ptr<GpuAccelerator>> m_gpus;
+    Ptr<BackendAutoscaler> m_autoscaler;
+};
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test BackendAutoscaler neither counts nor powers down quarantined backends
+ */
+class AutoscalerQuarantineTestCase : public TestCase
+{
+  public:
+    AutoscalerQuarantineTestCase()
+        : TestCase("Test BackendAutoscaler ignores quarantined backends")
+    {
+    }
+
+  private:
+    void DoRun() override
+    {
+        for (uint32_t i = 0; i < 3; i++)
+        {
+            Ptr<GpuAccelerator> gpu = CreateObject<GpuAccelerator>();
+            gpu->SetAttribute("ProcessingModel",
+                              PointerValue(CreateObject<FixedRatioProcessingModel>()));
+            gpu->SetAttribute("QueueScheduler",
+                              PointerValue(CreateObject<FifoQueueScheduler>()));
+
+            Ptr<Node> node = CreateObject<Node>();
+            node->AggregateObject(gpu);
+            std::string ip = "10.1." + std::to_string(i) + ".1";
+            m_cluster.AddBackend(node, InetSocketAddress(Ipv4Address(ip.c_str()), 9000));
+        }
+        m_state.Resize(3);
+
+        // One backend sustains 5 tasks/s at the target utilization
+        m_autoscaler = CreateObject<BackendAutoscaler>();
+        m_autoscaler->SetAttribute("ServiceRate", DoubleValue(10.0));
+        m_autoscaler->SetAttribute("TargetUtilization", DoubleValue(0.5));
+        m_autoscaler->SetAttribute("RateSmoothing", DoubleValue(1.0));
+        m_autoscaler->Start(m_cluster, m_state);
+
+        // 10 tasks/s needs the two backends still serving, not the quarantined third
+        m_cluster.SetQuarantined(2, true);
+        Simulator::Schedule(Seconds(0.5), &AutoscalerQuarantineTestCase::Dispatch, this, 0, 6);
+        Simulator::Schedule(Seconds(0.5), &AutoscalerQuarantineTestCase::Dispatch, this, 1, 4);
+        Simulator::Schedule(Seconds(1.1), &AutoscalerQuarantineTestCase::CheckKept, this);
+
+        // 4 tasks/s needs one: the least-loaded serving backend drains, not the quarantined one
+        Simulator::Schedule(Seconds(1.5), &AutoscalerQuarantineTestCase::Dispatch, this, 0, 4);
+        Simulator::Schedule(Seconds(2.1), &AutoscalerQuarantineTestCase::CheckVictim, this);
+
+        Simulator::Stop(Seconds(2.2));
+        Simulator::Run();
+        m_autoscaler->Stop();
+        Simulator::Destroy();
+    }
+
+    void Dispatch(uint32_t backendIdx, uint32_t count)
+    {
+        for (uint32_t i = 0; i < count; i++)
+        {
+            m_state.NotifyTaskDispatched(backendIdx);
+        }
+    }
+
+    void CheckKept()
+    {
+        for (uint32_t i = 0; i < 3; i++)
+        {
+            NS_TEST_EXPECT_MSG_EQ(m_autoscaler->GetPowerState(i),
+                                  BackendAutoscaler::ON,
+                                  "No backend is spare while one is quarantined");
+        }
+    }
+
+    void CheckVictim()
+    {
+        NS_TEST_EXPECT_MSG_EQ(m_autoscaler->GetPowerState(1),
+                              BackendAutoscaler::DRAINING,
+                              "The least-loaded serving backend drains");
+        NS_TEST_EXPECT_MSG_EQ(m_autoscaler->GetPowerState(2),
+                              BackendAutoscaler::ON,
+                              "The quarantined backend stays on for its probe");
+    }
+
+    Cluster m_cluster;
+    ClusterState m_state;
+    Ptr<BackendAutoscaler> m_autoscaler;
+};
+
+} // namespace
+
+TestCase*
+CreateBackendAutoscalerTestCase()
+{
+    return new BackendAutoscalerTestCase;
+}
+
+TestCase*
+CreateAutoscalerQuarantineTestCase()
+{
+    return new AutoscalerQuarantineTestCase;
+}
+
+} // namespace ns3
@@ -6,10 +6,13 @@
  * Author: John Mullan <122331816@umail.ucc.ie>
  */
 
+#include "ns3/cluster-state.h"
 #include "ns3/cluster.h"
+#include "ns3/first-fit-scheduler.h"
 #include "ns3/inet-socket-address.h"
 #include "ns3/ipv4-address.h"
 #include "ns3/node.h"
+#include "ns3/simple-task.h"
 #include "ns3/test.h"
 
 using namespace ns3;
@@ -135,6 +138,150 @@ ClusterIterationTestCase::DoRun()
     NS_TEST_ASSERT_MSG_EQ(count, 5, "Range-based for should iterate over all 5 backends");
 }
 
+/**
+ * @ingroup distributed-tests
+ * @brief Test Cluster availability indexes and scheduling around unavailable backends
+ */
+class ClusterAvailabilityTestCase : public TestCase
+{
+  public:
+    ClusterAvailabilityTestCase();
+    void DoRun() override;
+};
+
+ClusterAvailabilityTestCase::ClusterAvailabilityTestCase()
+    : TestCase("Test Cluster backend availability")
+{
+}
+
+void
+ClusterAvailabilityTestCase::DoRun()
+{
+    Cluster cluster;
+    Address addr0 = InetSocketAddress(Ipv4Address("10.1.1.1"), 9000);
+    Address addr1 = InetSocketAddress(Ipv4Address("10.1.2.1"), 9000);
+    Address addr2 = InetSocketAddress(Ipv4Address("10.1.3.1"), 9000);
+    cluster.AddBackend(CreateObject<Node>(), addr0, "GPU");
+    cluster.AddBackend(CreateObject<Node>(), addr1, "GPU");
+    cluster.AddBackend(CreateObject<Node>(), addr2, "TPU");
+
+    NS_TEST_ASSERT_MSG_EQ(cluster.GetNAvailable(), 3, "Backends start available");
+
+    cluster.SetAvailable(0, false);
+    NS_TEST_ASSERT_MSG_EQ(cluster.IsAvailable(0), false, "Backend 0 should be unavailable");
+    NS_TEST_ASSERT_MSG_EQ(cluster.GetNAvailable(), 2, "Two backends should remain");
+    NS_TEST_ASSERT_MSG_EQ(cluster.GetAvailableBackendsByType("GPU").size(),
+                          1,
+                          "One GPU backend should remain available");
+    NS_TEST_ASSERT_MSG_EQ(cluster.GetBackendsByType("GPU").size(),
+                          2,
+                          "The type index still covers unavailable backends");
+    NS_TEST_ASSERT_MSG_EQ(cluster.GetBackendIndex(addr0),
+                          0,
+                          "Responses from an unavailable backend should still resolve");
+
+    // Round-robin only cycles over available backends
+    Ptr<FirstFitScheduler> scheduler = CreateObject<FirstFitScheduler>();
+    ClusterState state;
+    state.Resize(3);
+    Ptr<Task> task = CreateObject<SimpleTask>();
+    NS_TEST_ASSERT_MSG_EQ(scheduler->ScheduleTask(task, cluster, state), 1, "First available");
+    NS_TEST_ASSERT_MSG_EQ(scheduler->ScheduleTask(task, cluster, state), 2, "Next available");
+    NS_TEST_ASSERT_MSG_EQ(scheduler->ScheduleTask(task, cluster, state), 1, "Wraps around");
+
+    cluster.SetAvailable(2, false);
+    task->SetRequiredAcceleratorType("TPU");
+    NS_TEST_ASSERT_MSG_EQ(scheduler->CanScheduleTask(task, cluster, state),
+                          false,
+                          "No TPU backend is available");
+
+    cluster.SetAvailable(0, true);
+    cluster.SetAvailable(2, true);
+    NS_TEST_ASSERT_MSG_EQ(cluster.GetAvailableBackends().size(), 3, "All available again");
+    NS_TEST_ASSERT_MSG_EQ(cluster.GetAvailableBackends()[0], 0, "Indexes stay sorted");
+
+    // Quarantine is independent of availability
+    cluster.SetQuarantined(1, true);
+    NS_TEST_ASSERT_MSG_EQ(cluster.IsAvailable(1), false, "Quarantined backends take no tasks");
+    NS_TEST_ASSERT_MSG_EQ(cluster.GetAvailableBackendsByType("GPU").size(),
+                          1,
+                          "Quarantine leaves the available index");
+    cluster.SetAvailable(1, false);
+    cluster.SetAvailable(1, true);
+    NS_TEST_ASSERT_MSG_EQ(cluster.IsAvailable(1), false, "Powering on does not lift quarantine");
+    cluster.SetQuarantined(1, false);
+    NS_TEST_ASSERT_MSG_EQ(cluster.IsAvailable(1), true, "Lifting quarantine restores the backend");
+    NS_TEST_ASSERT_MSG_EQ(cluster.GetNAvailable(), 3, "All available again after quarantine");
+}
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test ClusterState service time tracking and outlier detection
+ */
+class ClusterServiceTimeTestCase : public TestCase
+{
+  public:
+    ClusterServiceTimeTestCase();
+    void DoRun() override;
+};
+
+ClusterServiceTimeTestCase::ClusterServiceTimeTestCase()
+    : TestCase("Test ClusterState service time and slow response tracking")
+{
+}
+
+void
+ClusterServiceTimeTestCase::DoRun()
+{
+    ClusterState state;
+    state.Resize(1);
+    state.SetOutlierFactor(3.0);
+
+    Ptr<Task> task = CreateObject<SimpleTask>();
+    task->SetComputeDemand(1e9);
+
+    // Three tasks sent together are served one after another
+    NS_TEST_ASSERT_MSG_EQ(state.NotifyResponse(0, task, Seconds(0), Seconds(0.1)),
+                          false,
+                          "The first sample sets the healthy cost");
+    NS_TEST_ASSERT_MSG_EQ(state.NotifyResponse(0, task, Seconds(0), Seconds(0.2)),
+                          false,
+                          "Queueing behind the first task is not service");
+    NS_TEST_ASSERT_MSG_EQ_TOL(state.Get(0).serviceTime.GetSeconds(),
+                              0.1,
+                              1e-9,
+                              "Service time excludes queueing");
+    NS_TEST_ASSERT_MSG_EQ_TOL(state.Get(0).serviceCost, 1e-10, 1e-15, "Seconds per FLOP");
+
+    // A task of twice the demand taking twice as long is not slow
+    Ptr<Task> large = CreateObject<SimpleTask>();
+    large->SetComputeDemand(2e9);
+    NS_TEST_ASSERT_MSG_EQ(state.NotifyResponse(0, large, Seconds(1), Seconds(1.2)),
+                          false,
+                          "Cost is normalized by compute demand");
+
+    // Ten times slower: outliers accumulate and stay out of the healthy cost
+    NS_TEST_ASSERT_MSG_EQ(state.NotifyResponse(0, task, Seconds(2), Seconds(3)),
+                          true,
+                          "A 10x slow response is an outlier");
+    NS_TEST_ASSERT_MSG_EQ(state.NotifyResponse(0, task, Seconds(3), Seconds(4)),
+                          true,
+                          "A second slow response is an outlier");
+    NS_TEST_ASSERT_MSG_EQ(state.Get(0).slowResponses, 2, "Two slow responses in a row");
+    NS_TEST_ASSERT_MSG_EQ_TOL(state.Get(0).serviceCost,
+                              1e-10,
+                              1e-15,
+                              "Outliers do not move the healthy cost");
+    NS_TEST_ASSERT_MSG_GT(state.Get(0).serviceTime.GetSeconds(),
+                          0.1,
+                          "The service time follows every response");
+
+    NS_TEST_ASSERT_MSG_EQ(state.NotifyResponse(0, task, Seconds(5), Seconds(5.1)),
+                          false,
+                          "A healthy response is not an outlier");
+    NS_TEST_ASSERT_MSG_EQ(state.Get(0).slowResponses, 0, "A healthy response ends the run");
+}
+
 namespace ns3
 {
 
@@ -156,4 +303,22 @@ CreateClusterIterationTestCase()
     return new ClusterIterationTestCase();
 }
 
+/**
+ * @brief Factory function for ClusterAvailabilityTestCase
+ */
+TestCase*
+CreateClusterAvailabilityTestCase()
+{
+    return new ClusterAvailabilityTestCase();
+}
+
+/**
+ * @brief Factory function for ClusterServiceTimeTestCase
+ */
+TestCase*
+CreateClusterServiceTimeTestCase()
+{
+    return new ClusterServiceTimeTestCase();
+}
+
 } // namespace ns3
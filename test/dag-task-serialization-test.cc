@@ -304,6 +304,87 @@ class DagTaskDeserializeFailureTestCase : public TestCase
     }
 };
 
+/**
+ * @ingroup distributed-tests
+ * @brief Test DagTask variants survive metadata serialization and can be applied
+ */
+class DagTaskSerializeVariantsTestCase : public TestCase
+{
+  public:
+    DagTaskSerializeVariantsTestCase()
+        : TestCase("Test DagTask variant serialization and selection")
+    {
+    }
+
+  private:
+    void DoRun() override
+    {
+        Ptr<DagTask> dag = CreateObject<DagTask>();
+
+        Ptr<SimpleTask> taskA = CreateObject<SimpleTask>();
+        taskA->SetTaskId(10);
+        taskA->SetComputeDemand(4e9);
+        taskA->SetOutputSize(4000);
+
+        Ptr<SimpleTask> taskB = CreateObject<SimpleTask>();
+        taskB->SetTaskId(20);
+        taskB->SetComputeDemand(1e9);
+        taskB->SetOutputSize(1000);
+
+        uint32_t a = dag->AddTask(taskA);
+        uint32_t b = dag->AddTask(taskB);
+        dag->AddDataDependency(a, b);
+
+        uint32_t plainSize = dag->SerializeMetadata()->GetSize();
+        uint32_t plainFullSize = dag->SerializeFullData()->GetSize();
+
+        taskA->AddVariant(2e9, 2000);
+        taskA->AddVariant(1e9, 1000);
+        taskB->AddVariant(5e8, 500);
+        NS_TEST_ASSERT_MSG_EQ(dag->GetVariantCount(), 2, "The DAG has as many variants as A");
+        NS_TEST_ASSERT_MSG_EQ(dag->SerializeFullData()->GetSize(),
+                              plainFullSize,
+                              "Full data should not carry the variants");
+
+        Ptr<Packet> packet = dag->SerializeMetadata();
+        NS_TEST_ASSERT_MSG_EQ(packet->GetSize(),
+                              plainSize + 4 + 3 * 20,
+                              "Three variants should trail the edges");
+
+        uint64_t consumedBytes = 0;
+        Ptr<DagTask> restored =
+            DagTask::DeserializeMetadata(packet,
+                                         MakeCallback(&DeserializeHeaderWithTypePrefix),
+                                         consumedBytes);
+        NS_TEST_ASSERT_MSG_NE(restored, nullptr, "Deserialization should succeed");
+        NS_TEST_ASSERT_MSG_EQ(consumedBytes, packet->GetSize(), "All bytes should be consumed");
+        NS_TEST_ASSERT_MSG_EQ(restored->GetTask(0)->GetVariantCount(), 2, "A has two variants");
+        NS_TEST_ASSERT_MSG_EQ(restored->GetTask(1)->GetVariantCount(), 1, "B has one variant");
+        NS_TEST_ASSERT_MSG_EQ_TOL(restored->GetTask(0)->GetVariantComputeDemand(2),
+                                  1e9,
+                                  1,
+                                  "A's cheapest demand should match");
+        NS_TEST_ASSERT_MSG_EQ(restored->GetTask(0)->GetVariantOutputSize(1),
+                              2000,
+                              "A's first output size should match");
+
+        // Tasks with fewer variants run as their cheapest
+        restored->ApplyVariant(2);
+        NS_TEST_ASSERT_MSG_EQ_TOL(restored->GetTask(0)->GetComputeDemand(), 1e9, 1, "A degraded");
+        NS_TEST_ASSERT_MSG_EQ_TOL(restored->GetTask(1)->GetComputeDemand(), 5e8, 1, "B degraded");
+        NS_TEST_ASSERT_MSG_EQ(restored->GetTask(1)->GetOutputSize(), 500, "B output degraded");
+
+        restored->ApplyVariant(0);
+        NS_TEST_ASSERT_MSG_EQ_TOL(restored->GetTask(0)->GetComputeDemand(),
+                                  4e9,
+                                  1,
+                                  "Variant 0 restores the original");
+        NS_TEST_ASSERT_MSG_EQ(restored->GetTask(0)->GetOutputSize(), 4000, "Original output");
+
+        Simulator::Destroy();
+    }
+};
+
 } // namespace
 
 TestCase*
@@ -324,4 +405,10 @@ CreateDagTaskDeserializeFailureTestCase()
     return new DagTaskDeserializeFailureTestCase;
 }
 
+TestCase*
+CreateDagTaskSerializeVariantsTestCase()
+{
+    return new DagTaskSerializeVariantsTestCase;
+}
+
 } // namespace ns3
@@ -6,6 +6,8 @@
  * Author: John Mullan <122331816@umail.ucc.ie>
  */
 
+#include "distributed-test-utils.h"
+
 #include "ns3/cluster-state.h"
 #include "ns3/cluster.h"
 #include "ns3/dag-task.h"
@@ -229,6 +231,125 @@ class DagDependencyDeadlineTestCase : public TestCase
     }
 };
 
+/**
+ * @ingroup distributed-tests
+ * @brief Test that admission plans a placement over per-backend queues.
+ */
+class DeadlinePlacementTestCase : public TestCase
+{
+  public:
+    DeadlinePlacementTestCase()
+        : TestCase("DeadlineAwareAdmissionPolicy places tasks on per-backend queues")
+    {
+    }
+
+  private:
+    /**
+     * @brief Create a task with the given demand and deadline.
+     * @param taskId The task ID.
+     * @param flops The compute demand in FLOPS.
+     * @param deadline Deadline relative to now.
+     * @return The task.
+     */
+    static Ptr<SimpleTask> MakeDeadlineTask(uint64_t taskId, double flops, Time deadline)
+    {
+        Ptr<SimpleTask> task = MakeTask(taskId, flops);
+        task->SetDeadline(Simulator::Now() + deadline);
+        return task;
+    }
+
+    void DoRun() override
+    {
+        NodeContainer nodes;
+        nodes.Create(2);
+        InternetStackHelper internet;
+        internet.Install(nodes);
+
+        Cluster cluster;
+        cluster.AddBackend(nodes.Get(0), InetSocketAddress(Ipv4Address("10.0.0.1"), 9000));
+        cluster.AddBackend(nodes.Get(1), InetSocketAddress(Ipv4Address("10.0.0.2"), 9000));
+
+        ClusterState state;
+        state.Resize(2);
+
+        Ptr<DeadlineAwareAdmissionPolicy> policy = CreateObject<DeadlineAwareAdmissionPolicy>();
+        policy->SetAttribute("ComputeRate", DoubleValue(1e9));
+
+        // Backend 0: one 5 s task. Backend 1: three 0.1 s tasks.
+        // Counting tasks would prefer backend 0; outstanding work prefers 1.
+        Ptr<SimpleTask> queued = MakeDeadlineTask(100, 5e9, Seconds(10));
+        state.NotifyTaskDispatched(0, queued);
+        for (uint64_t id = 101; id <= 103; id++)
+        {
+            state.NotifyTaskDispatched(1, MakeDeadlineTask(id, 0.1e9, Seconds(10)));
+        }
+
+        Ptr<DagTask> dag = CreateObject<DagTask>();
+        dag->AddTask(MakeDeadlineTask(1, 1e9, Seconds(1.5)));
+        NS_TEST_ASSERT_MSG_EQ(policy->ShouldAdmit(dag, cluster, state),
+                              true,
+                              "0.3 s of queued work plus 1 s meets 1.5 s");
+        NS_TEST_ASSERT_MSG_EQ(policy->GetPlacement()[0], 1, "Should place on the shorter queue");
+        NS_TEST_ASSERT_MSG_EQ_TOL(policy->GetFinishTimes()[0].GetSeconds(),
+                                  1.3,
+                                  1e-9,
+                                  "Finish after the queued work");
+
+        // Clocking backend 1 to a tenth of the reference makes the task take 13 s
+        state.SetCommandedFrequency(1, 0.15e9);
+        NS_TEST_ASSERT_MSG_EQ(policy->ShouldAdmit(dag, cluster, state),
+                              false,
+                              "Commanded frequency should slow the estimate");
+        state.SetCommandedFrequency(1, 0);
+
+        // Two parallel tasks each fit alone, but not both on backend 1
+        dag->AddTask(MakeDeadlineTask(2, 1e9, Seconds(1.5)));
+        NS_TEST_ASSERT_MSG_EQ(policy->ShouldAdmit(dag, cluster, state),
+                              false,
+                              "Both tasks cannot finish in time on one backend");
+        state.NotifyTaskCompleted(0, queued->GetTaskId());
+        NS_TEST_ASSERT_MSG_EQ(policy->ShouldAdmit(dag, cluster, state),
+                              true,
+                              "Both tasks fit once backend 0 is free");
+        NS_TEST_ASSERT_MSG_EQ(policy->GetPlacement()[0] != policy->GetPlacement()[1],
+                              true,
+                              "Parallel tasks should be spread across backends");
+
+        // 20 MB of input at a measured 10 MB/s adds 2 s on either backend
+        Ptr<DagTask> upload = CreateObject<DagTask>();
+        Ptr<SimpleTask> frame = MakeDeadlineTask(3, 0.1e9, Seconds(1.5));
+        frame->SetInputSize(20000000);
+        upload->AddTask(frame);
+        NS_TEST_ASSERT_MSG_EQ(policy->ShouldAdmit(upload, cluster, state),
+                              true,
+                              "Transfers are ignored until a link rate is known");
+        for (uint32_t b = 0; b < 2; b++)
+        {
+            // A small frame sets the 10 ms latency; the upload's excess gives the rate
+            state.NotifyTransfer(b, 1000, MilliSeconds(10));
+            NS_TEST_ASSERT_MSG_EQ(state.Get(b).linkRate, 0, "Small frames carry no rate");
+            state.NotifyTransfer(b, 10000000, MilliSeconds(1010));
+            state.NotifyTransfer(b, 1000, MilliSeconds(12));
+        }
+        NS_TEST_ASSERT_MSG_EQ(state.Get(0).linkLatency, MilliSeconds(10), "Latency baseline");
+        NS_TEST_ASSERT_MSG_EQ_TOL(state.Get(0).linkRate, 1e7, 1e-3, "Rate beyond the latency");
+        NS_TEST_ASSERT_MSG_EQ(policy->ShouldAdmit(upload, cluster, state),
+                              false,
+                              "Input transfer should delay the estimate");
+
+        // A small frame pays the latency, not the measured rate of large uploads
+        Ptr<DagTask> small = CreateObject<DagTask>();
+        Ptr<SimpleTask> smallFrame = MakeDeadlineTask(4, 0.1e9, Seconds(1.5));
+        smallFrame->SetInputSize(1000);
+        small->AddTask(smallFrame);
+        NS_TEST_ASSERT_MSG_EQ(policy->ShouldAdmit(small, cluster, state),
+                              true,
+                              "Small frames should stay feasible");
+
+        Simulator::Destroy();
+    }
+};
+
 } // namespace
 
 TestCase*
@@ -255,4 +376,10 @@ CreateDagDependencyDeadlineTestCase()
     return new DagDependencyDeadlineTestCase;
 }
 
+TestCase*
+CreateDeadlinePlacementTestCase()
+{
+    return new DeadlinePlacementTestCase;
+}
+
 } // namespace ns3
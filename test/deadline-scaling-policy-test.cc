@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#include "ns3/accelerator.h"
+#include "ns3/cluster-state.h"
+#include "ns3/deadline-scaling-policy.h"
+#include "ns3/double.h"
+#include "ns3/scaling-policy.h"
+#include "ns3/simple-task.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+
+#include <vector>
+
+namespace ns3
+{
+namespace
+{
+
+static std::vector<OperatingPoint>
+MakeTestOpps()
+{
+    return {{500e6, 0.65}, {1.0e9, 0.85}, {1.5e9, 1.05}};
+}
+
+Ptr<Task>
+CreateDeadlineTask(uint64_t taskId, double flops, Time deadline)
+{
+    Ptr<Task> task = CreateObject<SimpleTask>();
+    task->SetTaskId(taskId);
+    task->SetComputeDemand(flops);
+    task->SetDeadline(deadline);
+    return task;
+}
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test DeadlineScalingPolicy picks the slowest OPP meeting all deadlines.
+ */
+class DeadlineScalingMinimumOppTestCase : public TestCase
+{
+  public:
+    DeadlineScalingMinimumOppTestCase()
+        : TestCase("DeadlineScalingPolicy selects the slowest feasible OPP")
+    {
+    }
+
+  private:
+    void DoRun() override
+    {
+        // 1 TFLOPS at 1.5 GHz, so 1 GHz sustains 2/3 TFLOPS
+        Ptr<DeadlineScalingPolicy> policy = CreateObject<DeadlineScalingPolicy>();
+        policy->SetAttribute("ComputeRate", DoubleValue(1e12));
+        policy->SetAttribute("ReferenceFrequency", DoubleValue(1.5e9));
+        std::vector<OperatingPoint> opps = MakeTestOpps();
+
+        ClusterState state;
+        state.Resize(1);
+        state.SetCommandedFrequency(0, 1.5e9);
+
+        // 0.2 TFLOP due at 0.5 s needs 0.6 GHz, 0.6 TFLOP cumulative due at 1 s
+        // needs 0.9 GHz; the no-deadline task only adds work behind them
+        state.NotifyTaskDispatched(0, CreateDeadlineTask(1, 4e11, Seconds(1)));
+        state.NotifyTaskDispatched(0, CreateDeadlineTask(2, 2e11, Seconds(0.5)));
+        state.NotifyTaskDispatched(0, CreateDeadlineTask(3, 5e12, Time(-1)));
+
+        NS_TEST_ASSERT_MSG_EQ_TOL(state.Get(0).outstandingFlops,
+                                  5.6e12,
+                                  1,
+                                  "Outstanding work should be tracked");
+
+        Ptr<ScalingDecision> decision = policy->Decide(state.Get(0), opps);
+        NS_TEST_ASSERT_MSG_NE(decision, nullptr, "Should scale down from max OPP");
+        NS_TEST_ASSERT_MSG_EQ_TOL(decision->targetFrequency,
+                                  1.0e9,
+                                  1e-3,
+                                  "0.9 GHz requirement should round up to 1 GHz");
+        NS_TEST_ASSERT_MSG_EQ_TOL(decision->targetVoltage,
+                                  0.85,
+                                  1e-6,
+                                  "Voltage should come from OPP table");
+
+        // Without the 1 s task only 0.6 GHz is needed, which still rounds up to 1 GHz
+        state.NotifyTaskCompleted(0, 1);
+        state.SetCommandedFrequency(0, 1.0e9);
+        decision = policy->Decide(state.Get(0), opps);
+        NS_TEST_ASSERT_MSG_EQ(decision, nullptr, "No change when already at the target");
+
+        // Idle apart from work without deadlines, the lowest OPP suffices
+        state.NotifyTaskCompleted(0, 2);
+        decision = policy->Decide(state.Get(0), opps);
+        NS_TEST_ASSERT_MSG_NE(decision, nullptr, "Should scale down further");
+        NS_TEST_ASSERT_MSG_EQ_TOL(decision->targetFrequency, 500e6, 1e-3, "Lowest OPP suffices");
+
+        state.NotifyTaskCompleted(0, 3);
+        NS_TEST_ASSERT_MSG_EQ(state.Get(0).outstandingTasks.size(), 0, "No work outstanding");
+        NS_TEST_ASSERT_MSG_EQ_TOL(state.Get(0).outstandingFlops, 0, 1e-9, "No FLOPs outstanding");
+
+        Simulator::Destroy();
+    }
+};
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test DeadlineScalingPolicy runs at max OPP when a deadline is unreachable.
+ */
+class DeadlineScalingInfeasibleTestCase : public TestCase
+{
+  public:
+    DeadlineScalingInfeasibleTestCase()
+        : TestCase("DeadlineScalingPolicy selects max OPP for unreachable deadlines")
+    {
+    }
+
+  private:
+    void DoRun() override
+    {
+        Ptr<DeadlineScalingPolicy> policy = CreateObject<DeadlineScalingPolicy>();
+        std::vector<OperatingPoint> opps = MakeTestOpps();
+
+        ClusterState state;
+        state.Resize(1);
+        state.SetCommandedFrequency(0, 500e6);
+
+        // 2 TFLOP in 1 s needs 3 GHz, beyond the OPP table
+        state.NotifyTaskDispatched(0, CreateDeadlineTask(1, 2e12, Seconds(1)));
+
+        Ptr<ScalingDecision> decision = policy->Decide(state.Get(0), opps);
+        NS_TEST_ASSERT_MSG_NE(decision, nullptr, "Should produce a scaling decision");
+        NS_TEST_ASSERT_MSG_EQ_TOL(decision->targetFrequency, 1.5e9, 1e-3, "Should pick max OPP");
+
+        Simulator::Destroy();
+    }
+};
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test DeadlineScalingPolicy uses the rates recorded for each backend.
+ */
+class DeadlineScalingBackendRatesTestCase : public TestCase
+{
+  public:
+    DeadlineScalingBackendRatesTestCase()
+        : TestCase("DeadlineScalingPolicy uses each backend's recorded rates")
+    {
+    }
+
+  private:
+    void DoRun() override
+    {
+        // The attributes assume 1 TFLOPS at 1.5 GHz; the backend is twice as fast
+        Ptr<DeadlineScalingPolicy> policy = CreateObject<DeadlineScalingPolicy>();
+        std::vector<OperatingPoint> opps = MakeTestOpps();
+
+        ClusterState state;
+        state.Resize(1);
+        state.SetCommandedFrequency(0, 1.5e9);
+        state.SetDeviceRates(0, 2e12, 1.5e9, 0, 1);
+
+        // 1 TFLOP due in 1 s needs 0.75 GHz at 2 TFLOPS, not 1.5 GHz
+        state.NotifyTaskDispatched(0, CreateDeadlineTask(1, 1e12, Seconds(1)));
+        NS_TEST_EXPECT_MSG_EQ_TOL(policy->GetRequiredFrequency(state.Get(0)),
+                                  0.75e9,
+                                  1,
+                                  "Required frequency at the backend's rate");
+        Ptr<ScalingDecision> decision = policy->Decide(state.Get(0), opps);
+        NS_TEST_ASSERT_MSG_NE(decision, nullptr, "Should scale down from max OPP");
+        NS_TEST_EXPECT_MSG_EQ_TOL(decision->targetFrequency, 1.0e9, 1e-3, "Rounds up to 1 GHz");
+
+        // Moving 0.5 GB at 1 GB/s leaves 0.5 s for the same work, needing 1.5 GHz
+        state.SetDeviceRates(0, 2e12, 1.5e9, 1e9, 1);
+        state.NotifyTaskCompleted(0, 1);
+        Ptr<Task> task = CreateDeadlineTask(2, 1e12, Seconds(1));
+        task->SetInputSize(500000000);
+        state.NotifyTaskDispatched(0, task);
+        NS_TEST_EXPECT_MSG_EQ_TOL(policy->GetRequiredFrequency(state.Get(0)),
+                                  1.5e9,
+                                  1,
+                                  "Transfers shorten the time left for compute");
+
+        // On two devices the first of two 1 TFLOP tasks holds up the second by half
+        state.SetDeviceRates(0, 2e12, 1.5e9, 0, 2);
+        state.NotifyTaskCompleted(0, 2);
+        state.NotifyTaskDispatched(0, CreateDeadlineTask(3, 1e12, Seconds(1)));
+        state.NotifyTaskDispatched(0, CreateDeadlineTask(4, 1e12, Seconds(1)));
+        NS_TEST_EXPECT_MSG_EQ_TOL(policy->GetRequiredFrequency(state.Get(0)),
+                                  1.125e9,
+                                  1,
+                                  "1.5 TFLOP of one device's work in 1 s");
+
+        Simulator::Destroy();
+    }
+};
+
+} // namespace
+
+TestCase*
+CreateDeadlineScalingMinimumOppTestCase()
+{
+    return new DeadlineScalingMinimumOppTestCase;
+}
+
+TestCase*
+CreateDeadlineScalingInfeasibleTestCase()
+{
+    return new DeadlineScalingInfeasibleTestCase;
+}
+
+TestCase*
+CreateDeadlineScalingBackendRatesTestCase()
+{
+    return new DeadlineScalingBackendRatesTestCase;
+}
+
+} // namespace ns3
@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#include "ns3/boolean.h"
+#include "ns3/cluster-state.h"
+#include "ns3/cluster.h"
+#include "ns3/connection-manager.h"
+#include "ns3/device-manager.h"
+#include "ns3/double.h"
+#include "ns3/gpu-accelerator.h"
+#include "ns3/gpu-device-protocol.h"
+#include "ns3/inet-socket-address.h"
+#include "ns3/node.h"
+#include "ns3/nstime.h"
+#include "ns3/pointer.h"
+#include "ns3/simple-task.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+#include "ns3/utilization-scaling-policy.h"
+
+#include <vector>
+
+namespace ns3
+{
+namespace
+{
+
+/**
+ * @ingroup distributed-tests
+ * @brief ConnectionManager that accepts every send without a network.
+ */
+class NullConnectionManager : public ConnectionManager
+{
+  public:
+    void SetNode(Ptr<Node> node) override
+    {
+        m_node = node;
+    }
+
+    Ptr<Node> GetNode() const override
+    {
+        return m_node;
+    }
+
+    void Bind(uint16_t) override
+    {
+    }
+
+    void Bind(const Address&) override
+    {
+    }
+
+    void Connect(const Address&) override
+    {
+    }
+
+    bool Send(Ptr<Packet>) override
+    {
+        return true;
+    }
+
+    bool Send(Ptr<Packet>, const Address&) override
+    {
+        return true;
+    }
+
+    void SetReceiveCallback(ReceiveCallback) override
+    {
+    }
+
+    void Close() override
+    {
+    }
+
+    void Close(const Address&) override
+    {
+    }
+
+    std::string GetName() const override
+    {
+        return "Null";
+    }
+
+    bool IsReliable() const override
+    {
+        return true;
+    }
+
+    bool IsConnected() const override
+    {
+        return true;
+    }
+
+  private:
+    Ptr<Node> m_node; //!< Node set by SetNode()
+};
+
+Ptr<DeviceManager>
+CreateTestDeviceManager(Cluster& cluster)
+{
+    Ptr<GpuAccelerator> gpu = CreateObject<GpuAccelerator>();
+    gpu->SetAttribute("Frequency", DoubleValue(1.5e9));
+    gpu->AddOperatingPoint(0.5e9, 0.7);
+    gpu->AddOperatingPoint(1.0e9, 0.9);
+    gpu->AddOperatingPoint(1.5e9, 1.0);
+    Ptr<Node> node = CreateObject<Node>();
+    node->AggregateObject(gpu);
+    cluster.AddBackend(node, InetSocketAddress(Ipv4Address("10.0.0.1"), 9000));
+
+    Ptr<DeviceManager> deviceManager = CreateObject<DeviceManager>();
+    deviceManager->SetAttribute("ScalingPolicy",
+                                PointerValue(CreateObject<UtilizationScalingPolicy>()));
+    deviceManager->SetAttribute("DeviceProtocol", PointerValue(CreateObject<GpuDeviceProtocol>()));
+    return deviceManager;
+}
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test DeviceManager dirty tracking, rate limiting and scale-down hysteresis.
+ */
+class DeviceManagerRateLimitTestCase : public TestCase
+{
+  public:
+    DeviceManagerRateLimitTestCase()
+        : TestCase("DeviceManager defers rate-limited and hysteretic scaling commands")
+    {
+    }
+
+  private:
+    void DoRun() override
+    {
+        Cluster cluster;
+        m_deviceManager = CreateTestDeviceManager(cluster);
+        m_deviceManager->SetAttribute("MinCommandInterval", TimeValue(Seconds(1)));
+        m_deviceManager->SetAttribute("ScaleDownDelay", TimeValue(MilliSeconds(500)));
+        m_deviceManager->TraceConnectWithoutContext(
+            "FrequencyChanged",
+            MakeCallback(&DeviceManagerRateLimitTestCase::FrequencyChanged, this));
+
+        m_state.Resize(cluster.GetN());
+        m_deviceManager->Start(cluster, CreateObject<NullConnectionManager>(), m_state);
+
+        // Idle at start: scale-down is held for 500 ms, but a dispatch at
+        // 200 ms cancels the request. After the completion at 300 ms it is
+        // applied at 800 ms. The scale-up at 1 s is rate-limited to 1.8 s.
+        m_deviceManager->EvaluateScaling(m_state);
+        NS_TEST_ASSERT_MSG_EQ(m_state.TakeDirtyBackends().empty(),
+                              true,
+                              "Evaluated backends should be clean");
+
+        Simulator::Schedule(MilliSeconds(200), &DeviceManagerRateLimitTestCase::Dispatch, this);
+        Simulator::Schedule(MilliSeconds(300), &DeviceManagerRateLimitTestCase::Complete, this);
+        Simulator::Schedule(Seconds(1), &DeviceManagerRateLimitTestCase::Dispatch, this);
+        Simulator::Stop(Seconds(3));
+        Simulator::Run();
+
+        NS_TEST_ASSERT_MSG_EQ(m_changeTimes.size(), 2, "Exactly two commands should be sent");
+        NS_TEST_EXPECT_MSG_EQ(m_changeTimes[0], MilliSeconds(800), "Scale-down after hysteresis");
+        NS_TEST_EXPECT_MSG_EQ_TOL(m_changeFrequencies[0], 0.5e9, 1e-3, "Down to the lowest OPP");
+        NS_TEST_EXPECT_MSG_EQ(m_changeTimes[1], MilliSeconds(1800), "Scale-up after interval");
+        NS_TEST_EXPECT_MSG_EQ_TOL(m_changeFrequencies[1], 1.5e9, 1e-3, "Up to the highest OPP");
+
+        m_deviceManager->Dispose();
+        Simulator::Destroy();
+    }
+
+    void Dispatch()
+    {
+        m_state.NotifyTaskDispatched(0);
+        m_deviceManager->EvaluateScaling(m_state);
+    }
+
+    void Complete()
+    {
+        m_state.NotifyTaskCompleted(0);
+        m_deviceManager->EvaluateScaling(m_state);
+    }
+
+    void FrequencyChanged(uint32_t, double, double newFreq)
+    {
+        m_changeTimes.push_back(Simulator::Now());
+        m_changeFrequencies.push_back(newFreq);
+    }
+
+    Ptr<DeviceManager> m_deviceManager;
+    ClusterState m_state;
+    std::vector<Time> m_changeTimes;
+    std::vector<double> m_changeFrequencies;
+};
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test DeviceManager carries dispatch-time decisions on the task message.
+ */
+class DeviceManagerPiggybackTestCase : public TestCase
+{
+  public:
+    DeviceManagerPiggybackTestCase()
+        : TestCase("DeviceManager piggybacks scaling decisions on dispatched tasks"),
+          m_changes(0)
+    {
+    }
+
+  private:
+    void DoRun() override
+    {
+        Cluster cluster;
+        ClusterState state;
+        Ptr<DeviceManager> deviceManager = CreateTestDeviceManager(cluster);
+        deviceManager->SetAttribute("PiggybackCommands", BooleanValue(true));
+        deviceManager->TraceConnectWithoutContext(
+            "FrequencyChanged",
+            MakeCallback(&DeviceManagerPiggybackTestCase::FrequencyChanged, this));
+
+        state.Resize(cluster.GetN());
+        deviceManager->Start(cluster, CreateObject<NullConnectionManager>(), state);
+        deviceManager->EvaluateScaling(state);
+        NS_TEST_ASSERT_MSG_EQ(m_changes, 1, "Idle backend should be commanded to min OPP");
+
+        Ptr<Task> task = CreateObject<SimpleTask>();
+        task->SetTaskId(7);
+        task->SetComputeDemand(1e9);
+        double idleFrequency = state.Get(0).commandedFrequency;
+        deviceManager->AttachFrequencyHint(task, 0, state);
+        NS_TEST_ASSERT_MSG_EQ(m_changes, 1, "A hint is not commanded before it is sent");
+        NS_TEST_ASSERT_MSG_EQ_TOL(state.Get(0).commandedFrequency,
+                                  idleFrequency,
+                                  1e-3,
+                                  "An unsent hint leaves the commanded frequency");
+        NS_TEST_ASSERT_MSG_EQ_TOL(task->GetTargetFrequency(), 1.5e9, 1e-3, "Hint at max OPP");
+        NS_TEST_ASSERT_MSG_EQ_TOL(task->GetTargetVoltage(), 1.0, 1e-9, "Hint carries voltage");
+
+        uint64_t consumed = 0;
+        Ptr<Task> received = SimpleTask::Deserialize(task->Serialize(false), consumed);
+        NS_TEST_ASSERT_MSG_EQ_TOL(received->GetTargetFrequency(),
+                                  1.5e9,
+                                  1e-3,
+                                  "Hint should survive serialization");
+
+        // Once sent, the decision is recorded, so no separate command follows
+        deviceManager->CommitFrequencyHint(task, 0, state);
+        NS_TEST_ASSERT_MSG_EQ(m_changes, 2, "Dispatch should raise the frequency");
+        NS_TEST_ASSERT_MSG_EQ_TOL(state.Get(0).commandedFrequency,
+                                  1.5e9,
+                                  1e-3,
+                                  "The sent hint is commanded");
+        deviceManager->CommitFrequencyHint(task, 0, state);
+        NS_TEST_ASSERT_MSG_EQ(m_changes, 2, "A repeated hint changes nothing");
+        state.NotifyTaskDispatched(0, task);
+        deviceManager->EvaluateScaling(state);
+        NS_TEST_ASSERT_MSG_EQ(m_changes, 2, "No command after a piggybacked decision");
+
+        deviceManager->Dispose();
+        Simulator::Destroy();
+    }
+
+    void FrequencyChanged(uint32_t, double, double)
+    {
+        m_changes++;
+    }
+
+    uint32_t m_changes;
+};
+
+} // namespace
+
+TestCase*
+CreateDeviceManagerRateLimitTestCase()
+{
+    return new DeviceManagerRateLimitTestCase;
+}
+
+TestCase*
+CreateDeviceManagerPiggybackTestCase()
+{
+    return new DeviceManagerPiggybackTestCase;
+}
+
+} // namespace ns3
@@ -37,11 +37,15 @@ class DeviceMetricsHeaderTestCase : public TestCase
         original.SetBusy(true);
         original.SetQueueLength(3);
         original.SetCurrentPower(150.5);
+        original.SetDeviceIndex(2);
+        original.SetDeviceCount(4);
+        original.SetTemperature(78.5);
+        original.SetThrottled(true);
 
         // Verify serialized size
         NS_TEST_ASSERT_MSG_EQ(original.GetSerializedSize(),
                               DeviceMetricsHeader::SERIALIZED_SIZE,
-                              "Serialized size should be 30 bytes");
+                              "Serialized size should be 43 bytes");
 
         // Serialize and deserialize
         Ptr<Packet> packet = Create<Packet>();
@@ -65,6 +69,13 @@ class DeviceMetricsHeaderTestCase : public TestCase
                                   150.5,
                                   1e-9,
                                   "Current power should match");
+        NS_TEST_ASSERT_MSG_EQ(deserialized.GetDeviceIndex(), 2, "Device index should match");
+        NS_TEST_ASSERT_MSG_EQ(deserialized.GetDeviceCount(), 4, "Device count should match");
+        NS_TEST_ASSERT_MSG_EQ_TOL(deserialized.GetTemperature(),
+                                  78.5,
+                                  1e-9,
+                                  "Temperature should match");
+        NS_TEST_ASSERT_MSG_EQ(deserialized.GetThrottled(), true, "Throttled should be true");
     }
 };
 
@@ -69,6 +69,56 @@ TestCase* CreateUtilizationScalingOppTestCase();
 TestCase* CreateMaxActiveTasksAdmitCapacityTestCase();
 TestCase* CreateMaxActiveTasksRejectFullTestCase();
 TestCase* CreateMaxActiveTasksAdmitEmptyTestCase();
+TestCase* CreateAcceleratorPoolLeastQueueTestCase();
+TestCase* CreateAcceleratorPoolTypeMatchTestCase();
+TestCase* CreateGpuAcceleratorModelCacheTestCase();
+TestCase* CreateLeastLoadedSchedulerWarmModelTestCase();
+TestCase* CreateGpuAcceleratorTransitionTestCase();
+TestCase* CreateAcceleratorIdleStatesTestCase();
+TestCase* CreateThermalModelRcTestCase();
+TestCase* CreateAcceleratorThermalThrottleTestCase();
+TestCase* CreateDeadlineScalingMinimumOppTestCase();
+TestCase* CreateDeadlineScalingInfeasibleTestCase();
+TestCase* CreateDeadlineScalingBackendRatesTestCase();
+TestCase* CreateDeviceManagerRateLimitTestCase();
+TestCase* CreateDeviceManagerPiggybackTestCase();
+TestCase* CreateMetricsTrailerHeaderTestCase();
+TestCase* CreateGpuDeviceProtocolTrailerTestCase();
+TestCase* CreatePowerCapThroughputTestCase();
+TestCase* CreatePowerCapDeadlineTestCase();
+TestCase* CreatePowerCapUnreachableDeadlineTestCase();
+TestCase* CreateClusterAvailabilityTestCase();
+TestCase* CreateBackendAutoscalerTestCase();
+TestCase* CreateAutoscalerQuarantineTestCase();
+TestCase* CreateLoadIndexTestCase();
+TestCase* CreateLeastLoadedSchedulerIndexedTestCase();
+TestCase* CreatePowerOfDChoicesSchedulerTestCase();
+TestCase* CreateEarliestFinishTimeSchedulerTestCase();
+TestCase* CreateEnergyAwareSchedulerTestCase();
+TestCase* CreateDeadlinePlacementTestCase();
+TestCase* CreateMaxActiveTasksReservationTestCase();
+TestCase* CreateAdmissionWindowTestCase();
+TestCase* CreateFairShareAdmissionPolicyTestCase();
+TestCase* CreateDagTaskSerializeVariantsTestCase();
+TestCase* CreateOrchestratorHeaderVariantTestCase();
+TestCase* CreateDegradedAdmissionTestCase();
+TestCase* CreateFairDispatchTestCase();
+TestCase* CreateHeadOfLineDispatchTestCase();
+TestCase* CreatePooledBackendRatesTestCase();
+TestCase* CreatePooledServerTestCase();
+TestCase* CreatePooledServerHintTestCase();
+TestCase* CreateBatchingDispatchTestCase();
+TestCase* CreateHedgedDispatchTestCase();
+TestCase* CreateTaskCancelHeaderTestCase();
+TestCase* CreateTaskStealHeaderTestCase();
+TestCase* CreateHedgedBackendCloseTestCase();
+TestCase* CreateWorkStealingTestCase();
+TestCase* CreateStolenTaskHintTestCase();
+TestCase* CreateClusterServiceTimeTestCase();
+TestCase* CreateGrayFailureTestCase();
+TestCase* CreateModelCapacityTestCase();
+TestCase* CreatePerformanceProfileTestCase();
+TestCase* CreateLearnedLatencySchedulerTestCase();
 
 class DistributedTestSuite : public TestSuite
 {
@@ -136,6 +186,56 @@ DistributedTestSuite::DistributedTestSuite()
     AddTestCase(CreateMaxActiveTasksAdmitCapacityTestCase(), TestCase::Duration::QUICK);
     AddTestCase(CreateMaxActiveTasksRejectFullTestCase(), TestCase::Duration::QUICK);
     AddTestCase(CreateMaxActiveTasksAdmitEmptyTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateAcceleratorPoolLeastQueueTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateAcceleratorPoolTypeMatchTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateGpuAcceleratorModelCacheTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateLeastLoadedSchedulerWarmModelTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateGpuAcceleratorTransitionTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateAcceleratorIdleStatesTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateThermalModelRcTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateAcceleratorThermalThrottleTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateDeadlineScalingMinimumOppTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateDeadlineScalingInfeasibleTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateDeadlineScalingBackendRatesTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateDeviceManagerRateLimitTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateDeviceManagerPiggybackTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateMetricsTrailerHeaderTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateGpuDeviceProtocolTrailerTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreatePowerCapThroughputTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreatePowerCapDeadlineTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreatePowerCapUnreachableDeadlineTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateClusterAvailabilityTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateBackendAutoscalerTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateAutoscalerQuarantineTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateLoadIndexTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateLeastLoadedSchedulerIndexedTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreatePowerOfDChoicesSchedulerTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateEarliestFinishTimeSchedulerTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateEnergyAwareSchedulerTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateDeadlinePlacementTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateMaxActiveTasksReservationTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateAdmissionWindowTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateFairShareAdmissionPolicyTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateDagTaskSerializeVariantsTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateOrchestratorHeaderVariantTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateDegradedAdmissionTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateFairDispatchTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateHeadOfLineDispatchTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreatePooledBackendRatesTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreatePooledServerTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreatePooledServerHintTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateBatchingDispatchTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateHedgedDispatchTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateTaskCancelHeaderTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateTaskStealHeaderTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateHedgedBackendCloseTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateWorkStealingTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateStolenTaskHintTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateClusterServiceTimeTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateGrayFailureTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateModelCapacityTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreatePerformanceProfileTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(CreateLearnedLatencySchedulerTestCase(), TestCase::Duration::QUICK);
 }
 
 static DistributedTestSuite sDistributedTestSuite;
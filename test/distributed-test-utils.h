@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#ifndef DISTRIBUTED_TEST_UTILS_H
+#define DISTRIBUTED_TEST_UTILS_H
+
+#include "ns3/simple-task.h"
+
+namespace ns3
+{
+
+/**
+ * @ingroup distributed-tests
+ * @brief Create a task with the given compute demand and no input or output.
+ * @param taskId The task ID.
+ * @param flops The compute demand in FLOPS.
+ * @return The task.
+ */
+inline Ptr<SimpleTask>
+MakeTask(uint64_t taskId, double flops)
+{
+    Ptr<SimpleTask> task = CreateObject<SimpleTask>();
+    task->SetTaskId(taskId);
+    task->SetComputeDemand(flops);
+    task->SetInputSize(0);
+    task->SetOutputSize(0);
+    return task;
+}
+
+} // namespace ns3
+
+#endif // DISTRIBUTED_TEST_UTILS_H
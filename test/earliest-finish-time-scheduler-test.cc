@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#include "distributed-test-utils.h"
+
+#include "ns3/cluster-state.h"
+#include "ns3/cluster.h"
+#include "ns3/earliest-finish-time-scheduler.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/simple-task.h"
+#include "ns3/test.h"
+
+namespace ns3
+{
+namespace
+{
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test EarliestFinishTimeScheduler weighs outstanding work, rates and clocks.
+ */
+class EarliestFinishTimeSchedulerTestCase : public TestCase
+{
+  public:
+    EarliestFinishTimeSchedulerTestCase()
+        : TestCase("EarliestFinishTimeScheduler picks the earliest estimated finish")
+    {
+    }
+
+  private:
+    void DoRun() override
+    {
+        NodeContainer nodes;
+        nodes.Create(3);
+        InternetStackHelper internet;
+        internet.Install(nodes);
+
+        Cluster cluster;
+        cluster.AddBackend(nodes.Get(0), InetSocketAddress(Ipv4Address("10.0.0.1"), 9000), "GPU");
+        cluster.AddBackend(nodes.Get(1), InetSocketAddress(Ipv4Address("10.0.0.2"), 9000), "GPU");
+        cluster.AddBackend(nodes.Get(2), InetSocketAddress(Ipv4Address("10.0.0.3"), 9000), "GPU");
+
+        // Backend 2 is twice as fast; the others use the scheduler's 1 TFLOPS default
+        ClusterState state;
+        state.Resize(3);
+        state.SetDeviceRates(2, 2e12, 1.5e9, 900e9, 1);
+
+        // One large task on 0, two small ones on 1, one medium one on 2
+        state.NotifyTaskDispatched(0, MakeTask(1, 100e9));
+        state.NotifyTaskDispatched(1, MakeTask(2, 1e9));
+        state.NotifyTaskDispatched(1, MakeTask(3, 1e9));
+        state.NotifyTaskDispatched(2, MakeTask(4, 50e9));
+
+        Ptr<EarliestFinishTimeScheduler> scheduler = CreateObject<EarliestFinishTimeScheduler>();
+        Ptr<SimpleTask> task = MakeTask(10, 10e9);
+        task->SetRequiredAcceleratorType("GPU");
+
+        NS_TEST_ASSERT_MSG_EQ_TOL(scheduler->EstimateFinishTime(state.Get(0), task).GetSeconds(),
+                                  0.11,
+                                  1e-9,
+                                  "110 GFLOP at 1 TFLOPS");
+        NS_TEST_ASSERT_MSG_EQ_TOL(scheduler->EstimateFinishTime(state.Get(2), task).GetSeconds(),
+                                  0.03,
+                                  1e-9,
+                                  "60 GFLOP at 2 TFLOPS");
+        NS_TEST_ASSERT_MSG_EQ(scheduler->ScheduleTask(task, cluster, state),
+                              1,
+                              "Most tasks but least work should win");
+
+        // Clocking backend 1 down to a tenth makes its 12 GFLOP take 0.12 s
+        state.SetCommandedFrequency(1, 0.15e9);
+        NS_TEST_ASSERT_MSG_EQ(scheduler->ScheduleTask(task, cluster, state),
+                              2,
+                              "Commanded frequency should slow the estimate");
+
+        // Transfers count against memory bandwidth: 90 GB at 900 GB/s adds 0.1 s
+        Ptr<SimpleTask> transfer = MakeTask(5, 0);
+        transfer->SetInputSize(90000000000);
+        state.NotifyTaskDispatched(2, transfer);
+        NS_TEST_ASSERT_MSG_EQ(state.Get(2).outstandingBytes,
+                              90000000000,
+                              "Outstanding bytes should be tracked");
+        NS_TEST_ASSERT_MSG_EQ(scheduler->ScheduleTask(task, cluster, state),
+                              0,
+                              "Outstanding transfers should delay the estimate");
+        state.NotifyTaskCompleted(2, 5);
+        NS_TEST_ASSERT_MSG_EQ(state.Get(2).outstandingBytes, 0, "Bytes released on completion");
+
+        // Two such devices drain the 50 GFLOP ahead together, but the task runs on one
+        state.SetDeviceRates(2, 2e12, 1.5e9, 900e9, 2);
+        NS_TEST_ASSERT_MSG_EQ_TOL(scheduler->EstimateFinishTime(state.Get(2), task).GetSeconds(),
+                                  0.0175,
+                                  1e-9,
+                                  "(25 + 10) GFLOP at 2 TFLOPS");
+
+        task->SetRequiredAcceleratorType("TPU");
+        NS_TEST_ASSERT_MSG_EQ(scheduler->ScheduleTask(task, cluster, state),
+                              -1,
+                              "Should return -1 for unknown type");
+    }
+};
+
+} // namespace
+
+TestCase*
+CreateEarliestFinishTimeSchedulerTestCase()
+{
+    return new EarliestFinishTimeSchedulerTestCase;
+}
+
+} // namespace ns3
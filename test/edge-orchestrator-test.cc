@@ -6,19 +6,27 @@
  * Author: John Mullan <122331816@umail.ucc.ie>
  */
 
+#include "ns3/accelerator-pool.h"
+#include "ns3/boolean.h"
 #include "ns3/always-admit-policy.h"
+#include "ns3/cluster-scheduler.h"
+#include "ns3/cluster-state.h"
 #include "ns3/cluster.h"
+#include "ns3/deadline-aware-admission-policy.h"
+#include "ns3/device-manager.h"
 #include "ns3/double.h"
 #include "ns3/edge-orchestrator.h"
 #include "ns3/fifo-queue-scheduler.h"
 #include "ns3/first-fit-scheduler.h"
 #include "ns3/fixed-ratio-processing-model.h"
 #include "ns3/gpu-accelerator.h"
+#include "ns3/gpu-device-protocol.h"
 #include "ns3/inet-socket-address.h"
 #include "ns3/internet-stack-helper.h"
 #include "ns3/ipv4-address-helper.h"
 #include "ns3/ipv4-global-routing-helper.h"
 #include "ns3/least-loaded-scheduler.h"
+#include "ns3/max-active-tasks-policy.h"
 #include "ns3/periodic-client.h"
 #include "ns3/periodic-server.h"
 #include "ns3/point-to-point-helper.h"
@@ -27,12 +35,142 @@
 #include "ns3/string.h"
 #include "ns3/test.h"
 #include "ns3/uinteger.h"
+#include "ns3/utilization-scaling-policy.h"
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
 
 namespace ns3
 {
 namespace
 {
 
+/**
+ * @brief A client, an orchestrator and its backends joined by 1 Gbps, 1 ms links.
+ *
+ * Node 0 is the client, node 1 the orchestrator and node 2 + i backend i,
+ * which the cluster reaches on port 9000.
+ */
+struct StarTopology
+{
+    NodeContainer nodes;      //!< Client, orchestrator, then backends
+    Ipv4Address orchestrator; //!< Orchestrator address on the client link
+    Cluster cluster;          //!< The backends
+};
+
+/**
+ * @brief Build a star topology and populate its routing tables.
+ * @param nBackends Number of backend nodes.
+ * @return The topology.
+ */
+StarTopology
+MakeTopology(uint32_t nBackends)
+{
+    StarTopology topology;
+    topology.nodes.Create(2 + nBackends);
+    Ptr<Node> orchNode = topology.nodes.Get(1);
+
+    PointToPointHelper p2p;
+    p2p.SetDeviceAttribute("DataRate", StringValue("1Gbps"));
+    p2p.SetChannelAttribute("Delay", StringValue("1ms"));
+
+    NetDeviceContainer devClientOrch = p2p.Install(topology.nodes.Get(0), orchNode);
+    std::vector<NetDeviceContainer> devOrchBackends;
+    for (uint32_t i = 0; i < nBackends; i++)
+    {
+        devOrchBackends.push_back(p2p.Install(orchNode, topology.nodes.Get(2 + i)));
+    }
+
+    InternetStackHelper internet;
+    internet.Install(topology.nodes);
+
+    Ipv4AddressHelper ipv4;
+    ipv4.SetBase("10.1.1.0", "255.255.255.0");
+    topology.orchestrator = ipv4.Assign(devClientOrch).GetAddress(1);
+    for (uint32_t i = 0; i < nBackends; i++)
+    {
+        ipv4.NewNetwork();
+        Ipv4Address address = ipv4.Assign(devOrchBackends[i]).GetAddress(1);
+        topology.cluster.AddBackend(topology.nodes.Get(2 + i), InetSocketAddress(address, 9000));
+    }
+
+    Ipv4GlobalRoutingHelper::PopulateRoutingTables();
+    return topology;
+}
+
+/**
+ * @brief Create a GPU with the given compute rate.
+ * @param computeRate The compute rate in FLOPS.
+ * @return The GPU.
+ */
+Ptr<GpuAccelerator>
+MakeGpu(double computeRate)
+{
+    Ptr<GpuAccelerator> gpu = CreateObject<GpuAccelerator>();
+    gpu->SetAttribute("ComputeRate", DoubleValue(computeRate));
+    gpu->SetAttribute("MemoryBandwidth", DoubleValue(1e11));
+    gpu->SetAttribute("ProcessingModel", PointerValue(CreateObject<FixedRatioProcessingModel>()));
+    gpu->SetAttribute("QueueScheduler", PointerValue(CreateObject<FifoQueueScheduler>()));
+    return gpu;
+}
+
+/**
+ * @brief Create a backend server on port 9000 of a node, running from time 0.
+ * @param node The server node.
+ * @param accelerator The accelerator or accelerator pool to aggregate to the node.
+ * @param stopTime When the server stops.
+ * @return The server.
+ */
+Ptr<PeriodicServer>
+MakeServer(Ptr<Node> node, Ptr<Object> accelerator, Time stopTime)
+{
+    node->AggregateObject(accelerator);
+
+    Ptr<PeriodicServer> server = CreateObject<PeriodicServer>();
+    server->SetAttribute("Port", UintegerValue(9000));
+    node->AddApplication(server);
+    server->SetStartTime(Seconds(0.0));
+    server->SetStopTime(stopTime);
+    return server;
+}
+
+/**
+ * @brief Create a client sending constant-size frames from 100 ms.
+ * @param node The client node.
+ * @param remote The orchestrator address.
+ * @param frameRate Frames per second.
+ * @param flops Each frame's compute demand in FLOPS.
+ * @param stopTime When the client stops.
+ * @return The client.
+ */
+Ptr<PeriodicClient>
+MakeClient(Ptr<Node> node, const Address& remote, double frameRate, double flops, Time stopTime)
+{
+    Ptr<PeriodicClient> client = CreateObject<PeriodicClient>();
+    client->SetAttribute("Remote", AddressValue(remote));
+    client->SetAttribute("FrameRate", DoubleValue(frameRate));
+
+    Ptr<ConstantRandomVariable> frameSize = CreateObject<ConstantRandomVariable>();
+    frameSize->SetAttribute("Constant", DoubleValue(1000));
+    client->SetAttribute("FrameSize", PointerValue(frameSize));
+
+    Ptr<ConstantRandomVariable> compute = CreateObject<ConstantRandomVariable>();
+    compute->SetAttribute("Constant", DoubleValue(flops));
+    client->SetAttribute("ComputeDemand", PointerValue(compute));
+
+    Ptr<ConstantRandomVariable> output = CreateObject<ConstantRandomVariable>();
+    output->SetAttribute("Constant", DoubleValue(100));
+    client->SetAttribute("OutputSize", PointerValue(output));
+
+    node->AddApplication(client);
+    client->SetStartTime(Seconds(0.1));
+    client->SetStopTime(stopTime);
+    return client;
+}
+
 /**
  * @ingroup distributed-tests
  * @brief Test single task end-to-end through EdgeOrchestrator.
@@ -355,18 +493,1402 @@ class MultiBackendTestCase : public TestCase
     std::set<uint32_t> m_backendsUsed;
 };
 
-} // namespace
+/**
+ * @ingroup distributed-tests
+ * @brief Test joint admission of simultaneous requests through an admission window.
+ *
+ * Topology: Clients A, B (n0) -> Orchestrator (n1) -> Server (n2) + GPU
+ * Both clients send one frame at the same time to a backend with room for
+ * one task. The first admission reserves the backend, so the second is
+ * rejected rather than admitted and left to miss; the window decides the
+ * cheaper frame (more utility per FLOP) first.
+ */
+class AdmissionWindowTestCase : public TestCase
+{
+  public:
+    AdmissionWindowTestCase()
+        : TestCase("EdgeOrchestrator reserves capacity for jointly admitted requests")
+    {
+    }
 
-TestCase*
-CreateSingleTaskEndToEndTestCase()
+  private:
+    void DoRun() override
+    {
+        StarTopology topology = MakeTopology(1);
+        MakeServer(topology.nodes.Get(2), MakeGpu(1e12), Seconds(10.0));
+
+        Ptr<MaxActiveTasksPolicy> policy = CreateObject<MaxActiveTasksPolicy>();
+        policy->SetAttribute("MaxActiveTasks", UintegerValue(1));
+
+        uint16_t orchPort = 8080;
+        Ptr<EdgeOrchestrator> orchestrator = CreateObject<EdgeOrchestrator>();
+        orchestrator->SetAttribute("Port", UintegerValue(orchPort));
+        orchestrator->SetAttribute("Scheduler", PointerValue(CreateObject<FirstFitScheduler>()));
+        orchestrator->SetAttribute("AdmissionPolicy", PointerValue(policy));
+        orchestrator->SetAttribute("AdmissionWindow", TimeValue(MilliSeconds(100)));
+        orchestrator->SetCluster(topology.cluster);
+        topology.nodes.Get(1)->AddApplication(orchestrator);
+        orchestrator->SetStartTime(Seconds(0.0));
+        orchestrator->SetStopTime(Seconds(10.0));
+
+        // One frame each at 1 FPS
+        Ptr<Node> clientNode = topology.nodes.Get(0);
+        Address remote = InetSocketAddress(topology.orchestrator, orchPort);
+        Ptr<PeriodicClient> heavy = MakeClient(clientNode, remote, 1.0, 1e11, Seconds(1.5));
+        Ptr<PeriodicClient> light = MakeClient(clientNode, remote, 1.0, 1e9, Seconds(1.5));
+
+        Simulator::Stop(Seconds(10.0));
+        Simulator::Run();
+        Simulator::Destroy();
+
+        NS_TEST_ASSERT_MSG_EQ(orchestrator->GetWorkloadsAdmitted(),
+                              1,
+                              "Only one frame fits on the backend");
+        NS_TEST_ASSERT_MSG_EQ(orchestrator->GetWorkloadsRejected(),
+                              1,
+                              "The reservation should reject the other frame");
+        NS_TEST_ASSERT_MSG_EQ(light->GetResponsesReceived(),
+                              1,
+                              "The frame with more utility per FLOP should be admitted");
+        NS_TEST_ASSERT_MSG_EQ(heavy->GetResponsesReceived(), 0, "The heavy frame is rejected");
+    }
+};
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test EdgeOrchestrator admits a frame as a cheaper variant instead of rejecting it.
+ *
+ * The frame takes 400 ms at the backend's rate against a 150 ms budget. Its
+ * first variant (200 ms) still misses the deadline, but its second (100 ms)
+ * meets it, so the frame is admitted and processed as the second variant.
+ */
+class DegradedAdmissionTestCase : public TestCase
 {
-    return new SingleTaskEndToEndTestCase;
-}
+  public:
+    DegradedAdmissionTestCase()
+        : TestCase("EdgeOrchestrator admits the first variant that fits"),
+          m_variant(0)
+    {
+    }
 
-TestCase*
-CreateMultiBackendTestCase()
+  private:
+    /**
+     * @brief Record the variant a workload was degraded to.
+     * @param dagId The client's DAG ID.
+     * @param variant The admitted variant.
+     */
+    void WorkloadDegraded(uint64_t dagId, uint32_t variant)
+    {
+        m_variant = variant;
+    }
+
+    void DoRun() override
+    {
+        StarTopology topology = MakeTopology(1);
+        MakeServer(topology.nodes.Get(2), MakeGpu(1e12), Seconds(10.0));
+
+        Ptr<DeadlineAwareAdmissionPolicy> policy = CreateObject<DeadlineAwareAdmissionPolicy>();
+        policy->SetAttribute("ComputeRate", DoubleValue(1e12));
+
+        uint16_t orchPort = 8080;
+        Ptr<EdgeOrchestrator> orchestrator = CreateObject<EdgeOrchestrator>();
+        orchestrator->SetAttribute("Port", UintegerValue(orchPort));
+        orchestrator->SetAttribute("Scheduler", PointerValue(CreateObject<FirstFitScheduler>()));
+        orchestrator->SetAttribute("AdmissionPolicy", PointerValue(policy));
+        orchestrator->SetCluster(topology.cluster);
+        orchestrator->TraceConnectWithoutContext(
+            "WorkloadDegraded",
+            MakeCallback(&DegradedAdmissionTestCase::WorkloadDegraded, this));
+        topology.nodes.Get(1)->AddApplication(orchestrator);
+        orchestrator->SetStartTime(Seconds(0.0));
+        orchestrator->SetStopTime(Seconds(10.0));
+
+        Ptr<PeriodicClient> client = MakeClient(topology.nodes.Get(0),
+                                                InetSocketAddress(topology.orchestrator, orchPort),
+                                                1.0,
+                                                4e11,
+                                                Seconds(0.5));
+        client->SetAttribute("DeadlineBudget", TimeValue(MilliSeconds(150)));
+        client->SetAttribute("OutputSize",
+                             StringValue("ns3::ConstantRandomVariable[Constant=400]"));
+        client->SetAttribute("Variants", UintegerValue(3));
+        client->SetAttribute("VariantScale", DoubleValue(0.5));
+
+        Simulator::Stop(Seconds(10.0));
+        Simulator::Run();
+        Simulator::Destroy();
+
+        NS_TEST_ASSERT_MSG_EQ(orchestrator->GetWorkloadsRejected(), 0, "Nothing is rejected");
+        NS_TEST_ASSERT_MSG_EQ(orchestrator->GetWorkloadsAdmitted(), 1, "The frame is admitted");
+        NS_TEST_ASSERT_MSG_EQ(m_variant, 2, "The first variant meeting the deadline is chosen");
+        NS_TEST_ASSERT_MSG_EQ(client->GetFramesDegraded(), 1, "The client degrades its frame");
+        NS_TEST_ASSERT_MSG_EQ(client->GetResponsesReceived(), 1, "The degraded frame completes");
+    }
+
+    uint32_t m_variant; //!< Variant reported by the WorkloadDegraded trace
+};
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test the dispatch stage holds ready tasks to the per-backend in-flight limit.
+ *
+ * A heavy and a light client share one backend limited to one task in
+ * flight. Without the stage both clients' frames would be queued on the
+ * backend together.
+ */
+class FairDispatchTestCase : public TestCase
 {
-    return new MultiBackendTestCase;
+  public:
+    FairDispatchTestCase()
+        : TestCase("EdgeOrchestrator releases ready tasks up to the in-flight limit"),
+          m_inFlight(0),
+          m_maxInFlight(0)
+    {
+    }
+
+  private:
+    /**
+     * @brief Count a dispatched task.
+     * @param workloadId The workload.
+     * @param taskId The task.
+     * @param backendIdx The backend.
+     */
+    void TaskDispatched(uint64_t workloadId, uint64_t taskId, uint32_t backendIdx)
+    {
+        m_maxInFlight = std::max(m_maxInFlight, ++m_inFlight);
+    }
+
+    /**
+     * @brief Count a completed task.
+     * @param workloadId The workload.
+     * @param taskId The task.
+     * @param backendIdx The backend.
+     */
+    void TaskCompleted(uint64_t workloadId, uint64_t taskId, uint32_t backendIdx)
+    {
+        m_inFlight--;
+    }
+
+    void DoRun() override
+    {
+        StarTopology topology = MakeTopology(1);
+        MakeServer(topology.nodes.Get(2), MakeGpu(1e12), Seconds(10.0));
+
+        uint16_t orchPort = 8080;
+        Ptr<EdgeOrchestrator> orchestrator = CreateObject<EdgeOrchestrator>();
+        orchestrator->SetAttribute("Port", UintegerValue(orchPort));
+        orchestrator->SetAttribute("Scheduler", PointerValue(CreateObject<FirstFitScheduler>()));
+        orchestrator->SetAttribute("MaxInFlightPerBackend", UintegerValue(1));
+        orchestrator->SetCluster(topology.cluster);
+        orchestrator->TraceConnectWithoutContext(
+            "TaskDispatched",
+            MakeCallback(&FairDispatchTestCase::TaskDispatched, this));
+        orchestrator->TraceConnectWithoutContext(
+            "TaskCompleted",
+            MakeCallback(&FairDispatchTestCase::TaskCompleted, this));
+        topology.nodes.Get(1)->AddApplication(orchestrator);
+        orchestrator->SetStartTime(Seconds(0.0));
+        orchestrator->SetStopTime(Seconds(10.0));
+
+        Ptr<Node> clientNode = topology.nodes.Get(0);
+        Address remote = InetSocketAddress(topology.orchestrator, orchPort);
+        Ptr<PeriodicClient> heavy = MakeClient(clientNode, remote, 20.0, 1e11, Seconds(1.1));
+        Ptr<PeriodicClient> light = MakeClient(clientNode, remote, 20.0, 1e9, Seconds(1.1));
+
+        Simulator::Stop(Seconds(10.0));
+        Simulator::Run();
+
+        NS_TEST_EXPECT_MSG_EQ(m_maxInFlight, 1, "The backend should never hold two tasks");
+        NS_TEST_EXPECT_MSG_EQ(orchestrator->GetQueuedTaskCount(), 0, "The stage should drain");
+        NS_TEST_EXPECT_MSG_GT(light->GetResponsesReceived(), 1, "The light client is served");
+        NS_TEST_EXPECT_MSG_GT(heavy->GetResponsesReceived(), 1, "The heavy client is served");
+
+        Simulator::Destroy();
+    }
+
+    uint32_t m_inFlight;    //!< Tasks currently dispatched
+    uint32_t m_maxInFlight; //!< Most tasks dispatched at once
+};
+
+/**
+ * @ingroup distributed-tests
+ * @brief Scheduler that places light tasks on backend 0 and heavy ones on backend 1.
+ *
+ * It also counts tasks placed more than once.
+ */
+class DemandScheduler : public ClusterScheduler
+{
+  public:
+    int32_t ScheduleTask(Ptr<Task> task, const Cluster&, const ClusterState&) override
+    {
+        m_rescheduled += m_placed.insert(PeekPointer(task)).second ? 0 : 1;
+        return task->GetComputeDemand() < 1e10 ? 0 : 1;
+    }
+
+    std::string GetName() const override
+    {
+        return "Demand";
+    }
+
+    std::set<const Task*> m_placed; //!< Tasks placed so far
+    uint32_t m_rescheduled{0};      //!< Placements of a task already placed
+};
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test a task held for a full backend does not hold up other backends.
+ *
+ * A light client's frames go to a slow backend, which falls behind, and a
+ * heavy client's frames go to a fast one. The light client's held frame has
+ * the earlier fair-queueing tag, yet the heavy client is served meanwhile,
+ * and the held frame keeps its placement instead of being placed again.
+ */
+class HeadOfLineDispatchTestCase : public TestCase
+{
+  public:
+    HeadOfLineDispatchTestCase()
+        : TestCase("EdgeOrchestrator serves other backends while a task is held")
+    {
+    }
+
+  private:
+    void DoRun() override
+    {
+        // 1 GFLOP frames take 1 s on the slow backend, 100 GFLOP frames 100 ms on the fast one
+        StarTopology topology = MakeTopology(2);
+        MakeServer(topology.nodes.Get(2), MakeGpu(1e9), Seconds(10.0));
+        MakeServer(topology.nodes.Get(3), MakeGpu(1e12), Seconds(10.0));
+
+        Ptr<DemandScheduler> scheduler = CreateObject<DemandScheduler>();
+
+        uint16_t orchPort = 8080;
+        Ptr<EdgeOrchestrator> orchestrator = CreateObject<EdgeOrchestrator>();
+        orchestrator->SetAttribute("Port", UintegerValue(orchPort));
+        orchestrator->SetAttribute("Scheduler", PointerValue(scheduler));
+        orchestrator->SetAttribute("MaxInFlightPerBackend", UintegerValue(1));
+        orchestrator->SetCluster(topology.cluster);
+        topology.nodes.Get(1)->AddApplication(orchestrator);
+        orchestrator->SetStartTime(Seconds(0.0));
+        orchestrator->SetStopTime(Seconds(10.0));
+
+        Ptr<Node> clientNode = topology.nodes.Get(0);
+        Address remote = InetSocketAddress(topology.orchestrator, orchPort);
+        Ptr<PeriodicClient> light = MakeClient(clientNode, remote, 20.0, 1e9, Seconds(1.1));
+        Ptr<PeriodicClient> heavy = MakeClient(clientNode, remote, 20.0, 1e11, Seconds(1.1));
+
+        Simulator::Stop(Seconds(10.0));
+        Simulator::Run();
+
+        NS_TEST_EXPECT_MSG_GT(light->GetResponsesReceived(), 0, "The slow backend is served");
+        NS_TEST_EXPECT_MSG_LT(light->GetResponsesReceived(),
+                              light->GetFramesSent(),
+                              "The slow backend falls behind");
+        NS_TEST_EXPECT_MSG_EQ(heavy->GetResponsesReceived(),
+                              heavy->GetFramesSent(),
+                              "The fast backend is not held up by the slow one");
+        NS_TEST_EXPECT_MSG_EQ(scheduler->m_rescheduled, 0, "A held task keeps its placement");
+
+        Simulator::Destroy();
+    }
+};
+
+/**
+ * @ingroup distributed-tests
+ * @brief Scheduler that places every task on backend 0 and records a backend's state.
+ */
+class RecordingScheduler : public ClusterScheduler
+{
+  public:
+    int32_t ScheduleTask(Ptr<Task>, const Cluster&, const ClusterState& state) override
+    {
+        m_backend = state.Get(m_recorded);
+        return 0;
+    }
+
+    std::string GetName() const override
+    {
+        return "Recording";
+    }
+
+    uint32_t m_recorded{0};               //!< Backend whose state is recorded
+    ClusterState::BackendState m_backend; //!< That backend as seen at the last placement
+};
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test the orchestrator records the rates of a backend with an accelerator pool.
+ *
+ * A task runs on one of the pool's devices, so the rates recorded are
+ * those of the mean device, along with the number of devices that drain
+ * the queue in parallel. Each device caches models in its own memory.
+ */
+class PooledBackendRatesTestCase : public TestCase
+{
+  public:
+    PooledBackendRatesTestCase()
+        : TestCase("EdgeOrchestrator records the device rates and count of an accelerator pool")
+    {
+    }
+
+  private:
+    void DoRun() override
+    {
+        StarTopology topology = MakeTopology(1);
+
+        // Two unequal devices at the default clock
+        Ptr<AcceleratorPool> pool = CreateObject<AcceleratorPool>();
+        for (double rate : {1e12, 2e12})
+        {
+            Ptr<GpuAccelerator> gpu = MakeGpu(rate);
+            gpu->SetAttribute("MemoryBandwidth", DoubleValue(rate / 10));
+            gpu->SetAttribute("MemoryCapacity", UintegerValue(static_cast<uint64_t>(rate * 4)));
+            pool->Add(gpu);
+        }
+        MakeServer(topology.nodes.Get(2), pool, Seconds(2.0));
+
+        Ptr<RecordingScheduler> scheduler = CreateObject<RecordingScheduler>();
+
+        uint16_t orchPort = 8080;
+        Ptr<EdgeOrchestrator> orchestrator = CreateObject<EdgeOrchestrator>();
+        orchestrator->SetAttribute("Port", UintegerValue(orchPort));
+        orchestrator->SetAttribute("Scheduler", PointerValue(scheduler));
+        orchestrator->SetCluster(topology.cluster);
+        topology.nodes.Get(1)->AddApplication(orchestrator);
+        orchestrator->SetStartTime(Seconds(0.0));
+        orchestrator->SetStopTime(Seconds(2.0));
+
+        Ptr<PeriodicClient> client = MakeClient(topology.nodes.Get(0),
+                                                InetSocketAddress(topology.orchestrator, orchPort),
+                                                10.0,
+                                                1e9,
+                                                Seconds(0.2));
+
+        Simulator::Stop(Seconds(2.0));
+        Simulator::Run();
+
+        double frequency = pool->Get(0)->GetFrequency();
+        NS_TEST_ASSERT_MSG_GT(client->GetResponsesReceived(), 0, "The pool serves the frame");
+        NS_TEST_EXPECT_MSG_EQ_TOL(scheduler->m_backend.computeRate,
+                                  1.5e12,
+                                  1,
+                                  "A task runs at the mean device's compute rate");
+        NS_TEST_EXPECT_MSG_EQ_TOL(scheduler->m_backend.referenceFrequency,
+                                  frequency,
+                                  1e-3,
+                                  "The rates apply at the devices' clock");
+        NS_TEST_EXPECT_MSG_EQ_TOL(scheduler->m_backend.memoryBandwidth,
+                                  1.5e11,
+                                  1,
+                                  "A task runs at the mean device's bandwidth");
+        NS_TEST_EXPECT_MSG_EQ(scheduler->m_backend.deviceCount,
+                              2,
+                              "The devices drain the queue together");
+        NS_TEST_EXPECT_MSG_EQ(scheduler->m_backend.modelCacheCapacity,
+                              static_cast<uint64_t>(4e12),
+                              "A model must fit the smallest device");
+
+        Simulator::Destroy();
+    }
+};
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test a server spreads frames over its accelerator pool and reports each device.
+ *
+ * Frames arrive every 50 ms and take 100 ms, so each finds one device busy
+ * and the pool sends it to the other. After each frame the server reports the
+ * device that ran it, then the pool as a whole.
+ */
+class PooledServerTestCase : public TestCase
+{
+  public:
+    PooledServerTestCase()
+        : TestCase("PeriodicServer dispatches over an accelerator pool and reports each device"),
+          m_completed(2, 0)
+    {
+    }
+
+  private:
+    /**
+     * @brief Count a frame completed on a device.
+     * @param context The device index.
+     * @param task The completed task.
+     * @param duration The processing time.
+     */
+    void DeviceCompleted(std::string context, Ptr<const Task> task, Time duration)
+    {
+        m_completed[std::stoul(context)]++;
+    }
+
+    void DoRun() override
+    {
+        StarTopology topology = MakeTopology(1);
+
+        Ptr<AcceleratorPool> pool = CreateObject<AcceleratorPool>();
+        for (uint32_t i = 0; i < 2; i++)
+        {
+            Ptr<GpuAccelerator> gpu = MakeGpu(1e12);
+            gpu->TraceConnect("TaskCompleted",
+                              std::to_string(i),
+                              MakeCallback(&PooledServerTestCase::DeviceCompleted, this));
+            pool->Add(gpu);
+        }
+        Ptr<PeriodicServer> server = MakeServer(topology.nodes.Get(2), pool, Seconds(2.0));
+        server->SetAttribute("DeviceProtocol", PointerValue(CreateObject<GpuDeviceProtocol>()));
+
+        // Metrics are stored but no scaling policy acts on them
+        Ptr<DeviceManager> deviceManager = CreateObject<DeviceManager>();
+        deviceManager->SetAttribute("DeviceProtocol",
+                                    PointerValue(CreateObject<GpuDeviceProtocol>()));
+        Ptr<RecordingScheduler> scheduler = CreateObject<RecordingScheduler>();
+
+        uint16_t orchPort = 8080;
+        Ptr<EdgeOrchestrator> orchestrator = CreateObject<EdgeOrchestrator>();
+        orchestrator->SetAttribute("Port", UintegerValue(orchPort));
+        orchestrator->SetAttribute("Scheduler", PointerValue(scheduler));
+        orchestrator->SetAttribute("DeviceManager", PointerValue(deviceManager));
+        orchestrator->SetCluster(topology.cluster);
+        topology.nodes.Get(1)->AddApplication(orchestrator);
+        orchestrator->SetStartTime(Seconds(0.0));
+        orchestrator->SetStopTime(Seconds(2.0));
+
+        // 100 GFLOP frames take 100 ms on either device
+        Ptr<PeriodicClient> client = MakeClient(topology.nodes.Get(0),
+                                                InetSocketAddress(topology.orchestrator, orchPort),
+                                                20.0,
+                                                1e11,
+                                                Seconds(0.6));
+
+        Simulator::Stop(Seconds(2.0));
+        Simulator::Run();
+
+        NS_TEST_ASSERT_MSG_GT(client->GetFramesSent(), 2, "Frames overlap on the backend");
+        NS_TEST_EXPECT_MSG_EQ(client->GetResponsesReceived(),
+                              client->GetFramesSent(),
+                              "Every frame is answered");
+        NS_TEST_EXPECT_MSG_GT(m_completed[0], 0, "The first device runs frames");
+        NS_TEST_EXPECT_MSG_GT(m_completed[1], 0, "The second device runs frames");
+        NS_TEST_EXPECT_MSG_EQ(m_completed[0] + m_completed[1],
+                              client->GetFramesSent(),
+                              "Each frame runs on one device");
+
+        // By the last placement both devices have reported, as has the pool
+        const ClusterState::BackendState& backend = scheduler->m_backend;
+        NS_TEST_ASSERT_MSG_EQ((backend.deviceMetrics != nullptr), true, "Pool report stored");
+        NS_TEST_EXPECT_MSG_EQ(backend.deviceMetrics->aggregate, true, "The pool report is whole");
+        NS_TEST_EXPECT_MSG_EQ(backend.deviceMetrics->deviceCount, 2, "The pool counts its devices");
+        NS_TEST_ASSERT_MSG_EQ(backend.perDeviceMetrics.size(), 2, "One report slot per device");
+        for (uint16_t i = 0; i < 2; i++)
+        {
+            Ptr<DeviceMetrics> device = backend.perDeviceMetrics[i];
+            NS_TEST_ASSERT_MSG_EQ((device != nullptr), true, "Each device has reported");
+            NS_TEST_EXPECT_MSG_EQ(device->aggregate, false, "A device report is not the pool's");
+            NS_TEST_EXPECT_MSG_EQ(device->deviceIndex, i, "Reports are stored by device");
+            NS_TEST_EXPECT_MSG_EQ_TOL(device->frequency,
+                                      backend.deviceMetrics->frequency,
+                                      1e-3,
+                                      "The devices share the pool's clock");
+        }
+
+        Simulator::Destroy();
+    }
+
+    std::vector<uint32_t> m_completed; //!< Frames completed on each device
+};
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test a piggybacked frequency hint sets the clock of every device in a pool.
+ *
+ * Both devices start at their lowest OPP. The one frame the backend is
+ * sent carries a hint to raise the clock, which the DeviceManager then
+ * records for the whole backend, so both devices must follow it even
+ * though only one runs the frame.
+ */
+class PooledServerHintTestCase : public TestCase
+{
+  public:
+    PooledServerHintTestCase()
+        : TestCase("PeriodicServer applies a frequency hint to every device of its pool")
+    {
+    }
+
+  private:
+    /**
+     * @brief Record the clock of each device of a pool.
+     * @param pool The pool.
+     */
+    void RecordClocks(Ptr<AcceleratorPool> pool)
+    {
+        for (uint32_t i = 0; i < pool->GetN(); i++)
+        {
+            m_frequencies.push_back(pool->Get(i)->GetFrequency());
+        }
+    }
+
+    void DoRun() override
+    {
+        StarTopology topology = MakeTopology(1);
+
+        Ptr<AcceleratorPool> pool = CreateObject<AcceleratorPool>();
+        for (uint32_t i = 0; i < 2; i++)
+        {
+            Ptr<GpuAccelerator> gpu = MakeGpu(1e12);
+            gpu->SetAttribute("Frequency", DoubleValue(0.5e9));
+            gpu->AddOperatingPoint(0.5e9, 0.7);
+            gpu->AddOperatingPoint(1.0e9, 0.9);
+            gpu->AddOperatingPoint(1.5e9, 1.0);
+            pool->Add(gpu);
+        }
+        Ptr<PeriodicServer> server = MakeServer(topology.nodes.Get(2), pool, Seconds(2.0));
+        server->SetAttribute("DeviceProtocol", PointerValue(CreateObject<GpuDeviceProtocol>()));
+
+        Ptr<DeviceManager> deviceManager = CreateObject<DeviceManager>();
+        deviceManager->SetAttribute("ScalingPolicy",
+                                    PointerValue(CreateObject<UtilizationScalingPolicy>()));
+        deviceManager->SetAttribute("DeviceProtocol",
+                                    PointerValue(CreateObject<GpuDeviceProtocol>()));
+        deviceManager->SetAttribute("PiggybackCommands", BooleanValue(true));
+
+        uint16_t orchPort = 8080;
+        Ptr<EdgeOrchestrator> orchestrator = CreateObject<EdgeOrchestrator>();
+        orchestrator->SetAttribute("Port", UintegerValue(orchPort));
+        orchestrator->SetAttribute("Scheduler", PointerValue(CreateObject<FirstFitScheduler>()));
+        orchestrator->SetAttribute("DeviceManager", PointerValue(deviceManager));
+        orchestrator->SetCluster(topology.cluster);
+        topology.nodes.Get(1)->AddApplication(orchestrator);
+        orchestrator->SetStartTime(Seconds(0.0));
+        orchestrator->SetStopTime(Seconds(2.0));
+
+        // One 100 GFLOP frame, still running when the clocks are read
+        Ptr<PeriodicClient> client = MakeClient(topology.nodes.Get(0),
+                                                InetSocketAddress(topology.orchestrator, orchPort),
+                                                1.0,
+                                                1e11,
+                                                Seconds(0.5));
+
+        Simulator::Schedule(Seconds(0.05), &PooledServerHintTestCase::RecordClocks, this, pool);
+        Simulator::Schedule(Seconds(0.15), &PooledServerHintTestCase::RecordClocks, this, pool);
+
+        Simulator::Stop(Seconds(2.0));
+        Simulator::Run();
+
+        NS_TEST_ASSERT_MSG_EQ(client->GetResponsesReceived(), 1, "The frame is answered");
+        NS_TEST_ASSERT_MSG_EQ(m_frequencies.size(), 4, "Both devices read twice");
+        NS_TEST_EXPECT_MSG_EQ_TOL(m_frequencies[0], 0.5e9, 1e-3, "Device 0 starts low");
+        NS_TEST_EXPECT_MSG_EQ_TOL(m_frequencies[1], 0.5e9, 1e-3, "Device 1 starts low");
+        NS_TEST_EXPECT_MSG_EQ_TOL(m_frequencies[2], 1.5e9, 1e-3, "The hint raises device 0");
+        NS_TEST_EXPECT_MSG_EQ_TOL(m_frequencies[3],
+                                  1.5e9,
+                                  1e-3,
+                                  "The hint raises the device not running the frame too");
+
+        Simulator::Destroy();
+    }
+
+    std::vector<double> m_frequencies; //!< Device clocks in order of reading
+};
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test like tasks from different clients are sent to a backend as one batch.
+ *
+ * Two clients send frames of the same task type in lockstep, so each pair
+ * of frames meets within the batch window and leaves in a single message.
+ */
+class BatchingDispatchTestCase : public TestCase
+{
+  public:
+    BatchingDispatchTestCase()
+        : TestCase("EdgeOrchestrator batches like tasks across clients"),
+          m_batches(0),
+          m_largestBatch(0)
+    {
+    }
+
+  private:
+    /**
+     * @brief Record a dispatched batch.
+     * @param backendIdx The backend.
+     * @param batchSize Tasks in the batch.
+     */
+    void BatchDispatched(uint32_t backendIdx, uint32_t batchSize)
+    {
+        m_batches++;
+        m_largestBatch = std::max(m_largestBatch, batchSize);
+    }
+
+    void DoRun() override
+    {
+        StarTopology topology = MakeTopology(1);
+        MakeServer(topology.nodes.Get(2), MakeGpu(1e12), Seconds(10.0));
+
+        uint16_t orchPort = 8080;
+        Ptr<EdgeOrchestrator> orchestrator = CreateObject<EdgeOrchestrator>();
+        orchestrator->SetAttribute("Port", UintegerValue(orchPort));
+        orchestrator->SetAttribute("Scheduler", PointerValue(CreateObject<FirstFitScheduler>()));
+        orchestrator->SetAttribute("BatchWindow", TimeValue(MilliSeconds(20)));
+        orchestrator->SetAttribute("MaxBatchSize", UintegerValue(2));
+        orchestrator->SetCluster(topology.cluster);
+        orchestrator->TraceConnectWithoutContext(
+            "BatchDispatched",
+            MakeCallback(&BatchingDispatchTestCase::BatchDispatched, this));
+        topology.nodes.Get(1)->AddApplication(orchestrator);
+        orchestrator->SetStartTime(Seconds(0.0));
+        orchestrator->SetStopTime(Seconds(10.0));
+
+        // Both clients send 1 GFLOP frames at 10 FPS
+        Ptr<Node> clientNode = topology.nodes.Get(0);
+        Address remote = InetSocketAddress(topology.orchestrator, orchPort);
+        Ptr<PeriodicClient> first = MakeClient(clientNode, remote, 10.0, 1e9, Seconds(1.1));
+        Ptr<PeriodicClient> second = MakeClient(clientNode, remote, 10.0, 1e9, Seconds(1.1));
+
+        Simulator::Stop(Seconds(10.0));
+        Simulator::Run();
+
+        NS_TEST_EXPECT_MSG_GT(m_batches, 0, "Tasks should be sent in batches");
+        NS_TEST_EXPECT_MSG_EQ(m_largestBatch, 2, "Both clients' frames should share a batch");
+        NS_TEST_EXPECT_MSG_EQ(orchestrator->GetQueuedTaskCount(), 0, "No task is left batched");
+        NS_TEST_EXPECT_MSG_GT(first->GetResponsesReceived(), 1, "The first client is served");
+        NS_TEST_EXPECT_MSG_GT(second->GetResponsesReceived(), 1, "The second client is served");
+
+        Simulator::Destroy();
+    }
+
+    uint32_t m_batches;      //!< Batches sent
+    uint32_t m_largestBatch; //!< Most tasks sent in one batch
+};
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test tasks stuck on a slow backend are hedged to another and the loser withdrawn.
+ *
+ * Frames alternate between a backend 100 times slower than the other.
+ * Once the response history is full, frames on the slow backend outlast
+ * the median response time and are copied to the fast backend, whose
+ * response wins; the slow backend is told to drop its copy.
+ */
+class HedgedDispatchTestCase : public TestCase
+{
+  public:
+    HedgedDispatchTestCase()
+        : TestCase("EdgeOrchestrator hedges slow tasks and withdraws the losing copy"),
+          m_dispatched(0),
+          m_hedged(0),
+          m_wonByCopy(0)
+    {
+    }
+
+  private:
+    /**
+     * @brief Record where a task was first sent.
+     * @param workloadId The workload.
+     * @param taskId The task.
+     * @param backendIdx The backend.
+     */
+    void TaskDispatched(uint64_t workloadId, uint64_t taskId, uint32_t backendIdx)
+    {
+        m_dispatched++;
+        m_firstBackend[{workloadId, taskId}] = backendIdx;
+    }
+
+    /**
+     * @brief Count a hedged task.
+     * @param workloadId The workload.
+     * @param taskId The task.
+     * @param backendIdx The backend the copy was sent to.
+     */
+    void TaskHedged(uint64_t workloadId, uint64_t taskId, uint32_t backendIdx)
+    {
+        m_hedged++;
+    }
+
+    /**
+     * @brief Count tasks answered by a backend other than the first.
+     * @param workloadId The workload.
+     * @param taskId The task.
+     * @param backendIdx The backend that answered.
+     */
+    void TaskCompleted(uint64_t workloadId, uint64_t taskId, uint32_t backendIdx)
+    {
+        if (m_firstBackend[{workloadId, taskId}] != backendIdx)
+        {
+            m_wonByCopy++;
+        }
+    }
+
+    void DoRun() override
+    {
+        // 1 GFLOP frames take 1 ms on the fast backend and 100 ms on the slow one
+        StarTopology topology = MakeTopology(2);
+        Ptr<PeriodicServer> slow = MakeServer(topology.nodes.Get(2), MakeGpu(1e10), Seconds(10.0));
+        Ptr<PeriodicServer> fast = MakeServer(topology.nodes.Get(3), MakeGpu(1e12), Seconds(10.0));
+
+        uint16_t orchPort = 8080;
+        Ptr<EdgeOrchestrator> orchestrator = CreateObject<EdgeOrchestrator>();
+        orchestrator->SetAttribute("Port", UintegerValue(orchPort));
+        orchestrator->SetAttribute("Scheduler", PointerValue(CreateObject<FirstFitScheduler>()));
+        orchestrator->SetAttribute("HedgePercentile", DoubleValue(0.5));
+        orchestrator->SetAttribute("HedgeHistory", UintegerValue(4));
+        orchestrator->SetAttribute("HedgeBudget", DoubleValue(1.0));
+        orchestrator->SetCluster(topology.cluster);
+        orchestrator->TraceConnectWithoutContext(
+            "TaskDispatched",
+            MakeCallback(&HedgedDispatchTestCase::TaskDispatched, this));
+        orchestrator->TraceConnectWithoutContext(
+            "TaskHedged",
+            MakeCallback(&HedgedDispatchTestCase::TaskHedged, this));
+        orchestrator->TraceConnectWithoutContext(
+            "TaskCompleted",
+            MakeCallback(&HedgedDispatchTestCase::TaskCompleted, this));
+        topology.nodes.Get(1)->AddApplication(orchestrator);
+        orchestrator->SetStartTime(Seconds(0.0));
+        orchestrator->SetStopTime(Seconds(10.0));
+
+        Ptr<PeriodicClient> client = MakeClient(topology.nodes.Get(0),
+                                                InetSocketAddress(topology.orchestrator, orchPort),
+                                                10.0,
+                                                1e9,
+                                                Seconds(2.1));
+
+        Simulator::Stop(Seconds(10.0));
+        Simulator::Run();
+
+        NS_TEST_EXPECT_MSG_GT(m_hedged, 0, "Tasks on the slow backend should be hedged");
+        NS_TEST_EXPECT_MSG_EQ(orchestrator->GetTasksHedged(), m_hedged, "Hedge count");
+        NS_TEST_EXPECT_MSG_LT_OR_EQ(m_hedged, m_dispatched, "Hedges stay within the budget");
+        NS_TEST_EXPECT_MSG_GT(m_wonByCopy, 0, "Hedged copies should answer first");
+        NS_TEST_EXPECT_MSG_GT(fast->GetFramesProcessed(),
+                              0,
+                              "The fast backend should serve the hedged copies");
+        NS_TEST_EXPECT_MSG_GT(slow->GetFramesCancelled(),
+                              0,
+                              "The slow backend should drop its losing copies");
+        NS_TEST_EXPECT_MSG_EQ(slow->GetFramesProcessed() + slow->GetFramesCancelled(),
+                              slow->GetFramesReceived(),
+                              "Every copy is answered or acknowledged as withdrawn");
+        NS_TEST_EXPECT_MSG_GT(client->GetResponsesReceived(), 0, "The client is served");
+        NS_TEST_EXPECT_MSG_EQ(client->GetResponsesReceived(),
+                              orchestrator->GetWorkloadsCompleted(),
+                              "Each frame is answered once despite its copies");
+
+        Simulator::Destroy();
+    }
+
+    uint32_t m_dispatched; //!< Tasks dispatched
+    uint32_t m_hedged;     //!< Tasks hedged
+    uint32_t m_wonByCopy;  //!< Tasks answered by their hedged copy
+    std::map<std::pair<uint64_t, uint64_t>, uint32_t>
+        m_firstBackend; //!< (workloadId, taskId) → backend first dispatched to
+};
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test a hedged copy lost with its backend does not hold up the task.
+ *
+ * Frames are placed on backend 0, which slows tenfold once the response
+ * history is full, so the next frame is hedged to backend 1. Backend 1
+ * disconnects before either copy answers. The frame is still answered by
+ * backend 0, and backend 1 is released of the lost copy.
+ */
+class HedgedBackendCloseTestCase : public TestCase
+{
+  public:
+    HedgedBackendCloseTestCase()
+        : TestCase("EdgeOrchestrator drops a hedged copy whose backend disconnects")
+    {
+    }
+
+  private:
+    /**
+     * @brief Change a backend's compute rate.
+     * @param node The backend node.
+     * @param computeRate The new compute rate in FLOPS.
+     */
+    static void SetComputeRate(Ptr<Node> node, double computeRate)
+    {
+        node->GetObject<GpuAccelerator>()->SetAttribute("ComputeRate", DoubleValue(computeRate));
+    }
+
+    void DoRun() override
+    {
+        // 1 GFLOP frames take 100 ms on backend 0 until it slows, and 1 s on backend 1
+        StarTopology topology = MakeTopology(2);
+        Ptr<Node> primaryNode = topology.nodes.Get(2);
+        MakeServer(primaryNode, MakeGpu(1e10), Seconds(10.0));
+        MakeServer(topology.nodes.Get(3), MakeGpu(1e9), Seconds(1.5));
+
+        Ptr<RecordingScheduler> scheduler = CreateObject<RecordingScheduler>();
+        scheduler->m_recorded = 1;
+
+        uint16_t orchPort = 8080;
+        Ptr<EdgeOrchestrator> orchestrator = CreateObject<EdgeOrchestrator>();
+        orchestrator->SetAttribute("Port", UintegerValue(orchPort));
+        orchestrator->SetAttribute("Scheduler", PointerValue(scheduler));
+        orchestrator->SetAttribute("HedgePercentile", DoubleValue(0.5));
+        orchestrator->SetAttribute("HedgeHistory", UintegerValue(4));
+        orchestrator->SetAttribute("HedgeBudget", DoubleValue(0.2));
+        orchestrator->SetCluster(topology.cluster);
+        topology.nodes.Get(1)->AddApplication(orchestrator);
+        orchestrator->SetStartTime(Seconds(0.0));
+        orchestrator->SetStopTime(Seconds(10.0));
+
+        // Five frames, the last sent after the slowdown, then one more placement once all
+        // is done; the budget allows only one hedge
+        Ptr<Node> clientNode = topology.nodes.Get(0);
+        Address remote = InetSocketAddress(topology.orchestrator, orchPort);
+        Ptr<PeriodicClient> client = MakeClient(clientNode, remote, 5.0, 1e9, Seconds(0.95));
+        Ptr<PeriodicClient> late = MakeClient(clientNode, remote, 1.0, 1e9, Seconds(3.5));
+        late->SetStartTime(Seconds(3.0));
+
+        Simulator::Schedule(Seconds(0.85),
+                            &HedgedBackendCloseTestCase::SetComputeRate,
+                            primaryNode,
+                            1e9);
+
+        Simulator::Stop(Seconds(10.0));
+        Simulator::Run();
+
+        NS_TEST_ASSERT_MSG_EQ(orchestrator->GetTasksHedged(), 1, "The slowed frame is hedged");
+        NS_TEST_EXPECT_MSG_EQ(orchestrator->GetWorkloadsCancelled(),
+                              0,
+                              "Losing the hedged copy does not cancel the frame");
+        NS_TEST_EXPECT_MSG_EQ(client->GetResponsesReceived(),
+                              client->GetFramesSent(),
+                              "The primary copy answers every frame");
+        NS_TEST_EXPECT_MSG_EQ(scheduler->m_backend.activeTasks,
+                              0,
+                              "The closed backend no longer holds the lost copy");
+        NS_TEST_EXPECT_MSG_EQ_TOL(scheduler->m_backend.outstandingFlops,
+                                  0,
+                                  1e-6,
+                                  "The lost copy's work is released");
+
+        Simulator::Destroy();
+    }
+};
+
+/**
+ * @ingroup distributed-tests
+ * @brief Scheduler that places every task on the first backend.
+ */
+class PinnedScheduler : public ClusterScheduler
+{
+  public:
+    int32_t ScheduleTask(Ptr<Task>, const Cluster&, const ClusterState&) override
+    {
+        return 0;
+    }
+
+    std::string GetName() const override
+    {
+        return "Pinned";
+    }
+};
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test an idle backend steals queued tasks from an overloaded one.
+ *
+ * Every frame is placed on backend 0, which takes 100 ms per frame while
+ * frames arrive every 67 ms, so its queue grows. Backend 1 is identical
+ * but receives no frames of its own; with work stealing it takes queued
+ * frames from backend 0 and answers them in its place.
+ */
+class WorkStealingTestCase : public TestCase
+{
+  public:
+    WorkStealingTestCase()
+        : TestCase("EdgeOrchestrator moves queued tasks from a busy backend to an idle one"),
+          m_stolen(0),
+          m_answeredByThief(0)
+    {
+    }
+
+  private:
+    /**
+     * @brief Count a stolen task.
+     * @param workloadId The workload.
+     * @param taskId The task.
+     * @param fromBackend The backend that gave it up.
+     * @param toBackend The backend it moved to.
+     */
+    void TaskStolen(uint64_t workloadId, uint64_t taskId, uint32_t fromBackend, uint32_t toBackend)
+    {
+        NS_TEST_EXPECT_MSG_EQ(fromBackend, 0, "Only the pinned backend has work to give");
+        NS_TEST_EXPECT_MSG_EQ(toBackend, 1, "The idle backend takes the work");
+        m_stolen++;
+    }
+
+    /**
+     * @brief Count tasks answered by the idle backend.
+     * @param workloadId The workload.
+     * @param taskId The task.
+     * @param backendIdx The backend that answered.
+     */
+    void TaskCompleted(uint64_t workloadId, uint64_t taskId, uint32_t backendIdx)
+    {
+        m_answeredByThief += backendIdx == 1 ? 1 : 0;
+    }
+
+    void DoRun() override
+    {
+        // 1 GFLOP frames take 100 ms on either backend
+        StarTopology topology = MakeTopology(2);
+        Ptr<PeriodicServer> busy = MakeServer(topology.nodes.Get(2), MakeGpu(1e10), Seconds(10.0));
+        Ptr<PeriodicServer> idle = MakeServer(topology.nodes.Get(3), MakeGpu(1e10), Seconds(10.0));
+
+        uint16_t orchPort = 8080;
+        Ptr<EdgeOrchestrator> orchestrator = CreateObject<EdgeOrchestrator>();
+        orchestrator->SetAttribute("Port", UintegerValue(orchPort));
+        orchestrator->SetAttribute("Scheduler", PointerValue(CreateObject<PinnedScheduler>()));
+        orchestrator->SetAttribute("StealThreshold", UintegerValue(2));
+        orchestrator->SetCluster(topology.cluster);
+        orchestrator->TraceConnectWithoutContext(
+            "TaskStolen",
+            MakeCallback(&WorkStealingTestCase::TaskStolen, this));
+        orchestrator->TraceConnectWithoutContext(
+            "TaskCompleted",
+            MakeCallback(&WorkStealingTestCase::TaskCompleted, this));
+        topology.nodes.Get(1)->AddApplication(orchestrator);
+        orchestrator->SetStartTime(Seconds(0.0));
+        orchestrator->SetStopTime(Seconds(10.0));
+
+        Ptr<PeriodicClient> client = MakeClient(topology.nodes.Get(0),
+                                                InetSocketAddress(topology.orchestrator, orchPort),
+                                                15.0,
+                                                1e9,
+                                                Seconds(2.1));
+
+        Simulator::Stop(Seconds(10.0));
+        Simulator::Run();
+
+        NS_TEST_EXPECT_MSG_GT(m_stolen, 0, "The idle backend should steal queued frames");
+        NS_TEST_EXPECT_MSG_EQ(orchestrator->GetTasksStolen(), m_stolen, "Steal count");
+        NS_TEST_EXPECT_MSG_EQ(busy->GetFramesStolen(),
+                              m_stolen,
+                              "Each frame given up is forwarded to the idle backend");
+        NS_TEST_EXPECT_MSG_EQ(idle->GetFramesReceived(),
+                              m_stolen,
+                              "The idle backend only runs stolen frames");
+        NS_TEST_EXPECT_MSG_EQ(m_answeredByThief,
+                              m_stolen,
+                              "Stolen frames are answered by the thief");
+        NS_TEST_EXPECT_MSG_GT(client->GetResponsesReceived(), 0, "The client is served");
+        NS_TEST_EXPECT_MSG_EQ(client->GetResponsesReceived(),
+                              client->GetFramesSent(),
+                              "Every frame is answered once");
+        NS_TEST_EXPECT_MSG_EQ(client->GetResponsesReceived(),
+                              orchestrator->GetWorkloadsCompleted(),
+                              "Each frame completes its workload");
+
+        Simulator::Destroy();
+    }
+
+    uint32_t m_stolen;          //!< Tasks stolen
+    uint32_t m_answeredByThief; //!< Tasks answered by the idle backend
+};
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test a stolen task carries a frequency hint for the thief, not the victim.
+ *
+ * As in WorkStealingTestCase, frames are pinned to backend 0 and backend 1
+ * steals them, with scaling commands piggybacked on tasks. The busy
+ * backend's hint is its top operating point of 1.5 GHz, which backend 1
+ * cannot run at: its own points end at 1.2 GHz. Every stolen frame must
+ * start on backend 1 at one of its own clocks.
+ */
+class StolenTaskHintTestCase : public TestCase
+{
+  public:
+    StolenTaskHintTestCase()
+        : TestCase("EdgeOrchestrator sends a stolen task with the thief's frequency hint"),
+          m_stolen(0)
+    {
+    }
+
+  private:
+    /**
+     * @brief Count a stolen task.
+     * @param workloadId The workload.
+     * @param taskId The task.
+     * @param fromBackend The backend that gave it up.
+     * @param toBackend The backend it moved to.
+     */
+    void TaskStolen(uint64_t workloadId, uint64_t taskId, uint32_t fromBackend, uint32_t toBackend)
+    {
+        m_stolen++;
+    }
+
+    /**
+     * @brief Record the thief's clock as a task starts on it.
+     * @param task The task.
+     */
+    void ThiefTaskStarted(Ptr<const Task> task)
+    {
+        m_thiefFrequencies.push_back(m_thief->GetFrequency());
+    }
+
+    void DoRun() override
+    {
+        StarTopology topology = MakeTopology(2);
+
+        Ptr<GpuAccelerator> victim = MakeGpu(1e10);
+        victim->AddOperatingPoint(0.5e9, 0.7);
+        victim->AddOperatingPoint(1.0e9, 0.9);
+        victim->AddOperatingPoint(1.5e9, 1.0);
+        MakeServer(topology.nodes.Get(2), victim, Seconds(10.0));
+
+        m_thief = MakeGpu(1e10);
+        m_thief->SetAttribute("Frequency", DoubleValue(1.2e9));
+        m_thief->AddOperatingPoint(0.4e9, 0.7);
+        m_thief->AddOperatingPoint(0.8e9, 0.8);
+        m_thief->AddOperatingPoint(1.2e9, 0.9);
+        m_thief->TraceConnectWithoutContext(
+            "TaskStarted",
+            MakeCallback(&StolenTaskHintTestCase::ThiefTaskStarted, this));
+        MakeServer(topology.nodes.Get(3), m_thief, Seconds(10.0));
+
+        Ptr<DeviceManager> deviceManager = CreateObject<DeviceManager>();
+        deviceManager->SetAttribute("ScalingPolicy",
+                                    PointerValue(CreateObject<UtilizationScalingPolicy>()));
+        deviceManager->SetAttribute("DeviceProtocol",
+                                    PointerValue(CreateObject<GpuDeviceProtocol>()));
+        deviceManager->SetAttribute("PiggybackCommands", BooleanValue(true));
+
+        uint16_t orchPort = 8080;
+        Ptr<EdgeOrchestrator> orchestrator = CreateObject<EdgeOrchestrator>();
+        orchestrator->SetAttribute("Port", UintegerValue(orchPort));
+        orchestrator->SetAttribute("Scheduler", PointerValue(CreateObject<PinnedScheduler>()));
+        orchestrator->SetAttribute("StealThreshold", UintegerValue(2));
+        orchestrator->SetAttribute("DeviceManager", PointerValue(deviceManager));
+        orchestrator->SetCluster(topology.cluster);
+        orchestrator->TraceConnectWithoutContext(
+            "TaskStolen",
+            MakeCallback(&StolenTaskHintTestCase::TaskStolen, this));
+        topology.nodes.Get(1)->AddApplication(orchestrator);
+        orchestrator->SetStartTime(Seconds(0.0));
+        orchestrator->SetStopTime(Seconds(10.0));
+
+        Ptr<PeriodicClient> client = MakeClient(topology.nodes.Get(0),
+                                                InetSocketAddress(topology.orchestrator, orchPort),
+                                                15.0,
+                                                1e9,
+                                                Seconds(2.1));
+
+        Simulator::Stop(Seconds(10.0));
+        Simulator::Run();
+
+        NS_TEST_ASSERT_MSG_GT(m_stolen, 0, "The idle backend should steal queued frames");
+        NS_TEST_EXPECT_MSG_EQ(m_thiefFrequencies.size(),
+                              m_stolen,
+                              "The thief only runs stolen frames");
+        for (double frequency : m_thiefFrequencies)
+        {
+            NS_TEST_EXPECT_MSG_LT_OR_EQ(frequency,
+                                        1.2e9,
+                                        "A stolen frame runs at one of the thief's own clocks");
+        }
+        NS_TEST_EXPECT_MSG_EQ(client->GetResponsesReceived(),
+                              client->GetFramesSent(),
+                              "Every frame is answered once");
+
+        Simulator::Destroy();
+    }
+
+    Ptr<GpuAccelerator> m_thief;            //!< The idle backend's device
+    uint32_t m_stolen;                      //!< Tasks stolen
+    std::vector<double> m_thiefFrequencies; //!< Thief clock at each task start
+};
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test a backend that turns slow is quarantined and restored once it recovers.
+ *
+ * Frames alternate between two identical backends. Between 1 s and 4.5 s
+ * backend 0 runs ten times slower without failing. After three slow
+ * responses in a row it is quarantined and frames go to backend 1 only;
+ * once it has recovered, a probe frame is answered at its healthy speed
+ * and the quarantine is lifted.
+ */
+class GrayFailureTestCase : public TestCase
+{
+  public:
+    GrayFailureTestCase()
+        : TestCase("EdgeOrchestrator quarantines a slow backend and restores it after a probe"),
+          m_quarantined(false),
+          m_dispatchedInQuarantine(0)
+    {
+    }
+
+  private:
+    /**
+     * @brief Record a quarantine change.
+     * @param backendIdx The backend.
+     * @param quarantined Whether it was quarantined or restored.
+     */
+    void BackendQuarantined(uint32_t backendIdx, bool quarantined)
+    {
+        NS_TEST_EXPECT_MSG_EQ(backendIdx, 0, "Only the slow backend is quarantined");
+        m_quarantined = quarantined;
+        m_events.push_back(quarantined);
+    }
+
+    /**
+     * @brief Count tasks sent to the slow backend while it is quarantined.
+     * @param workloadId The workload.
+     * @param taskId The task.
+     * @param backendIdx The backend.
+     */
+    void TaskDispatched(uint64_t workloadId, uint64_t taskId, uint32_t backendIdx)
+    {
+        m_dispatchedInQuarantine += (m_quarantined && backendIdx == 0) ? 1 : 0;
+    }
+
+    /**
+     * @brief Change a backend's compute rate.
+     * @param node The backend node.
+     * @param computeRate The new compute rate in FLOPS.
+     */
+    static void SetComputeRate(Ptr<Node> node, double computeRate)
+    {
+        node->GetObject<GpuAccelerator>()->SetAttribute("ComputeRate", DoubleValue(computeRate));
+    }
+
+    void DoRun() override
+    {
+        StarTopology topology = MakeTopology(2);
+        Ptr<Node> slowNode = topology.nodes.Get(2);
+        MakeServer(slowNode, MakeGpu(1e10), Seconds(20.0));
+        MakeServer(topology.nodes.Get(3), MakeGpu(1e10), Seconds(20.0));
+
+        uint16_t orchPort = 8080;
+        Ptr<EdgeOrchestrator> orchestrator = CreateObject<EdgeOrchestrator>();
+        orchestrator->SetAttribute("Port", UintegerValue(orchPort));
+        orchestrator->SetAttribute("Scheduler", PointerValue(CreateObject<FirstFitScheduler>()));
+        orchestrator->SetAttribute("QuarantineAfter", UintegerValue(3));
+        orchestrator->SetAttribute("ProbeInterval", TimeValue(Seconds(1)));
+        orchestrator->SetCluster(topology.cluster);
+        orchestrator->TraceConnectWithoutContext(
+            "BackendQuarantined",
+            MakeCallback(&GrayFailureTestCase::BackendQuarantined, this));
+        orchestrator->TraceConnectWithoutContext(
+            "TaskDispatched",
+            MakeCallback(&GrayFailureTestCase::TaskDispatched, this));
+        topology.nodes.Get(1)->AddApplication(orchestrator);
+        orchestrator->SetStartTime(Seconds(0.0));
+        orchestrator->SetStopTime(Seconds(20.0));
+
+        // 1 GFLOP frames take 100 ms, or 1 s while backend 0 is slow
+        Ptr<PeriodicClient> client = MakeClient(topology.nodes.Get(0),
+                                                InetSocketAddress(topology.orchestrator, orchPort),
+                                                5.0,
+                                                1e9,
+                                                Seconds(8.1));
+
+        Simulator::Schedule(Seconds(1.0), &GrayFailureTestCase::SetComputeRate, slowNode, 1e9);
+        Simulator::Schedule(Seconds(4.5), &GrayFailureTestCase::SetComputeRate, slowNode, 1e10);
+
+        Simulator::Stop(Seconds(20.0));
+        Simulator::Run();
+
+        NS_TEST_ASSERT_MSG_EQ(m_events.size(), 2, "Quarantined once and restored once");
+        NS_TEST_EXPECT_MSG_EQ(m_events[0], true, "The slow backend is quarantined first");
+        NS_TEST_EXPECT_MSG_EQ(m_events[1], false, "The recovered backend is restored");
+        NS_TEST_EXPECT_MSG_EQ(orchestrator->GetQuarantines(), 1, "Quarantine count");
+        NS_TEST_EXPECT_MSG_EQ(m_dispatchedInQuarantine,
+                              1,
+                              "Only the probe reaches a quarantined backend");
+        NS_TEST_EXPECT_MSG_GT(client->GetResponsesReceived(), 0, "The client is served");
+        NS_TEST_EXPECT_MSG_EQ(client->GetResponsesReceived(),
+                              client->GetFramesSent(),
+                              "Every frame is answered");
+
+        Simulator::Destroy();
+    }
+
+    bool m_quarantined;                //!< Whether backend 0 is quarantined
+    uint32_t m_dispatchedInQuarantine; //!< Tasks sent to backend 0 while quarantined
+    std::vector<bool> m_events;        //!< Quarantine changes in order
+};
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test EdgeOrchestrator places a task only on a backend that can hold its model.
+ *
+ * Backend 0 holds 1 GB of weights and backend 1 holds 4 GB, and first-fit
+ * placement prefers backend 0. Frames needing a 500 MB model run there.
+ * Frames needing a 2 GB model are placed again on backend 1, which can
+ * hold it. Frames needing an 8 GB model would fail on either device
+ * without a response, so their workloads are cancelled at dispatch.
+ */
+class ModelCapacityTestCase : public TestCase
+{
+  public:
+    ModelCapacityTestCase()
+        : TestCase("EdgeOrchestrator places tasks on backends that can hold their model")
+    {
+    }
+
+  private:
+    void DoRun() override
+    {
+        StarTopology topology = MakeTopology(2);
+        Ptr<GpuAccelerator> smallGpu = MakeGpu(1e12);
+        smallGpu->SetAttribute("MemoryCapacity", UintegerValue(1000000000));
+        Ptr<PeriodicServer> small = MakeServer(topology.nodes.Get(2), smallGpu, Seconds(10.0));
+        Ptr<GpuAccelerator> largeGpu = MakeGpu(1e12);
+        largeGpu->SetAttribute("MemoryCapacity", UintegerValue(4000000000));
+        Ptr<PeriodicServer> large = MakeServer(topology.nodes.Get(3), largeGpu, Seconds(10.0));
+
+        uint16_t orchPort = 8080;
+        Ptr<EdgeOrchestrator> orchestrator = CreateObject<EdgeOrchestrator>();
+        orchestrator->SetAttribute("Port", UintegerValue(orchPort));
+        orchestrator->SetAttribute("Scheduler", PointerValue(CreateObject<FirstFitScheduler>()));
+        orchestrator->SetCluster(topology.cluster);
+        topology.nodes.Get(1)->AddApplication(orchestrator);
+        orchestrator->SetStartTime(Seconds(0.0));
+        orchestrator->SetStopTime(Seconds(10.0));
+
+        Ptr<Node> clientNode = topology.nodes.Get(0);
+        Address remote = InetSocketAddress(topology.orchestrator, orchPort);
+        Ptr<PeriodicClient> fitsBoth = MakeClient(clientNode, remote, 2.0, 1e9, Seconds(1.1));
+        fitsBoth->SetAttribute("ModelId", StringValue("small"));
+        fitsBoth->SetAttribute("ModelSize", UintegerValue(500000000));
+        Ptr<PeriodicClient> fitsLarge = MakeClient(clientNode, remote, 2.0, 1e9, Seconds(1.1));
+        fitsLarge->SetAttribute("ModelId", StringValue("large"));
+        fitsLarge->SetAttribute("ModelSize", UintegerValue(2000000000));
+        Ptr<PeriodicClient> oversized = MakeClient(clientNode, remote, 2.0, 1e9, Seconds(1.1));
+        oversized->SetAttribute("ModelId", StringValue("huge"));
+        oversized->SetAttribute("ModelSize", UintegerValue(8000000000));
+
+        Simulator::Stop(Seconds(10.0));
+        Simulator::Run();
+
+        NS_TEST_ASSERT_MSG_GT(fitsBoth->GetFramesSent(), 0, "Frames with a small model are sent");
+        NS_TEST_EXPECT_MSG_EQ(fitsBoth->GetResponsesReceived(),
+                              fitsBoth->GetFramesSent(),
+                              "Every frame with a model that fits backend 0 is answered");
+        NS_TEST_EXPECT_MSG_EQ(small->GetFramesReceived(),
+                              fitsBoth->GetFramesSent(),
+                              "Only frames whose model fits reach the small backend");
+        NS_TEST_EXPECT_MSG_EQ(fitsLarge->GetResponsesReceived(),
+                              fitsLarge->GetFramesSent(),
+                              "Frames too large for backend 0 are answered by backend 1");
+        NS_TEST_EXPECT_MSG_EQ(large->GetFramesReceived(),
+                              fitsLarge->GetFramesSent(),
+                              "The large backend serves the frames only it can hold");
+        NS_TEST_EXPECT_MSG_EQ(oversized->GetResponsesReceived(),
+                              0,
+                              "No frame with a model too large for every backend is answered");
+        NS_TEST_EXPECT_MSG_EQ(orchestrator->GetWorkloadsCancelled(),
+                              oversized->GetFramesSent(),
+                              "Only frames that fit no backend are cancelled at dispatch");
+        NS_TEST_EXPECT_MSG_EQ(orchestrator->GetActiveWorkloadCount(),
+                              0,
+                              "No workload is left waiting for a response");
+
+        Simulator::Destroy();
+    }
+};
+
+} // namespace
+
+TestCase*
+CreateSingleTaskEndToEndTestCase()
+{
+    return new SingleTaskEndToEndTestCase;
+}
+
+TestCase*
+CreateMultiBackendTestCase()
+{
+    return new MultiBackendTestCase;
+}
+
+TestCase*
+CreateAdmissionWindowTestCase()
+{
+    return new AdmissionWindowTestCase;
+}
+
+TestCase*
+CreateDegradedAdmissionTestCase()
+{
+    return new DegradedAdmissionTestCase;
+}
+
+TestCase*
+CreateFairDispatchTestCase()
+{
+    return new FairDispatchTestCase;
+}
+
+TestCase*
+CreateHeadOfLineDispatchTestCase()
+{
+    return new HeadOfLineDispatchTestCase;
+}
+
+TestCase*
+CreatePooledBackendRatesTestCase()
+{
+    return new PooledBackendRatesTestCase;
+}
+
+TestCase*
+CreatePooledServerTestCase()
+{
+    return new PooledServerTestCase;
+}
+
+TestCase*
+CreatePooledServerHintTestCase()
+{
+    return new PooledServerHintTestCase;
+}
+
+TestCase*
+CreateBatchingDispatchTestCase()
+{
+    return new BatchingDispatchTestCase;
+}
+
+TestCase*
+CreateHedgedDispatchTestCase()
+{
+    return new HedgedDispatchTestCase;
+}
+
+TestCase*
+CreateHedgedBackendCloseTestCase()
+{
+    return new HedgedBackendCloseTestCase;
+}
+
+TestCase*
+CreateWorkStealingTestCase()
+{
+    return new WorkStealingTestCase;
+}
+
+TestCase*
+CreateStolenTaskHintTestCase()
+{
+    return new StolenTaskHintTestCase;
+}
+
+TestCase*
+CreateGrayFailureTestCase()
+{
+    return new GrayFailureTestCase;
+}
+
+TestCase*
+CreateModelCapacityTestCase()
+{
+    return new ModelCapacityTestCase;
 }
 
 } // namespace ns3
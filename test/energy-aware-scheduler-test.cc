@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#include "distributed-test-utils.h"
+
+#include "ns3/cluster-state.h"
+#include "ns3/cluster.h"
+#include "ns3/double.h"
+#include "ns3/dvfs-energy-model.h"
+#include "ns3/energy-aware-scheduler.h"
+#include "ns3/fifo-queue-scheduler.h"
+#include "ns3/fixed-ratio-processing-model.h"
+#include "ns3/gpu-accelerator.h"
+#include "ns3/inet-socket-address.h"
+#include "ns3/ipv4-address.h"
+#include "ns3/node.h"
+#include "ns3/pointer.h"
+#include "ns3/simple-task.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+namespace
+{
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test EnergyAwareScheduler trades energy against deadlines and reports accuracy
+ */
+class EnergyAwareSchedulerTestCase : public TestCase
+{
+  public:
+    EnergyAwareSchedulerTestCase()
+        : TestCase("Test EnergyAwareScheduler placement and energy traces"),
+          m_outcomes(0),
+          m_actual(0)
+    {
+    }
+
+  private:
+    void DoRun() override
+    {
+        // Backend 1 draws a third of backend 0's dynamic power at the same speed
+        Cluster cluster;
+        std::vector<Ptr<GpuAccelerator>> gpus;
+        for (uint32_t i = 0; i < 2; i++)
+        {
+            Ptr<GpuAccelerator> gpu = CreateObject<GpuAccelerator>();
+            gpu->SetAttribute("ComputeRate", DoubleValue(1e12));
+            gpu->SetAttribute("MemoryBandwidth", DoubleValue(1e12));
+            gpu->SetAttribute("Frequency", DoubleValue(1.5e9));
+            gpu->SetAttribute("Voltage", DoubleValue(1.0));
+            gpu->SetAttribute("ProcessingModel",
+                              PointerValue(CreateObject<FixedRatioProcessingModel>()));
+            gpu->SetAttribute("QueueScheduler",
+                              PointerValue(CreateObject<FifoQueueScheduler>()));
+            gpu->AddOperatingPoint(1.0e9, 0.8);
+            gpu->AddOperatingPoint(1.5e9, 1.0);
+            Ptr<DvfsEnergyModel> energy = CreateObject<DvfsEnergyModel>();
+            energy->SetAttribute("StaticPower", DoubleValue(10.0));
+            energy->SetAttribute("EffectiveCapacitance", DoubleValue(i == 0 ? 60e-9 : 20e-9));
+            gpu->SetAttribute("EnergyModel", PointerValue(energy));
+
+            Ptr<Node> node = CreateObject<Node>();
+            node->AggregateObject(gpu);
+            gpus.push_back(gpu);
+            std::string ip = "10.1." + std::to_string(i) + ".1";
+            cluster.AddBackend(node, InetSocketAddress(Ipv4Address(ip.c_str()), 9000));
+        }
+
+        ClusterState state;
+        state.Resize(2);
+        for (uint32_t i = 0; i < 2; i++)
+        {
+            state.SetDeviceRates(i, 1e12, 1.5e9, 1e12, 1);
+            state.SetCommandedFrequency(i, 1.5e9);
+        }
+
+        Ptr<EnergyAwareScheduler> scheduler = CreateObject<EnergyAwareScheduler>();
+        scheduler->TraceConnectWithoutContext(
+            "EnergyEstimate",
+            MakeCallback(&EnergyAwareSchedulerTestCase::EnergyEstimate, this));
+        scheduler->TraceConnectWithoutContext(
+            "EnergyOutcome",
+            MakeCallback(&EnergyAwareSchedulerTestCase::EnergyOutcome, this));
+
+        // 1 TFLOP takes 1 s on either: 90 J dynamic on backend 0, 30 J on backend 1
+        Ptr<SimpleTask> task = MakeTask(1, 1e12);
+        NS_TEST_ASSERT_MSG_EQ(scheduler->ScheduleTask(task, cluster, state),
+                              1,
+                              "Without a deadline the cheaper backend should win");
+        NS_TEST_ASSERT_MSG_EQ(m_estimates.size(), 1, "One estimate traced");
+        NS_TEST_ASSERT_MSG_EQ_TOL(m_estimates[0], 40.0, 1e-6, "10 W static plus 30 W dynamic");
+
+        // Backend 1 now finishes at 4 s, too late for a 2 s deadline
+        state.NotifyTaskDispatched(1, MakeTask(2, 3e12));
+        Ptr<SimpleTask> urgent = MakeTask(3, 1e12);
+        urgent->SetDeadline(Seconds(2));
+        NS_TEST_ASSERT_MSG_EQ(scheduler->ScheduleTask(urgent, cluster, state),
+                              0,
+                              "The cheaper backend cannot meet the deadline");
+
+        // Nobody meets 0.5 s, so the earliest finish wins
+        urgent = MakeTask(4, 1e12);
+        urgent->SetDeadline(MilliSeconds(500));
+        NS_TEST_ASSERT_MSG_EQ(scheduler->ScheduleTask(urgent, cluster, state),
+                              0,
+                              "Infeasible deadlines fall back to earliest finish");
+
+        // Running the first task on backend 1 reports the device's energy against the estimate
+        gpus[1]->SubmitTask(task);
+        Simulator::Run();
+        NS_TEST_ASSERT_MSG_EQ(m_outcomes, 1, "One outcome traced");
+        NS_TEST_ASSERT_MSG_EQ_TOL(m_actual, m_estimates[0], 1e-3, "Estimate matches the device");
+
+        scheduler->Dispose();
+        Simulator::Destroy();
+    }
+
+    void EnergyEstimate(uint64_t, uint32_t, double expected)
+    {
+        m_estimates.push_back(expected);
+    }
+
+    void EnergyOutcome(uint64_t taskId, uint32_t backendIdx, double expected, double actual)
+    {
+        NS_TEST_EXPECT_MSG_EQ(taskId, 1, "Only the first task ran");
+        NS_TEST_EXPECT_MSG_EQ(backendIdx, 1, "It ran on backend 1");
+        NS_TEST_EXPECT_MSG_EQ_TOL(expected, 40.0, 1e-6, "Expected energy carried through");
+        m_outcomes++;
+        m_actual = actual;
+    }
+
+    std::vector<double> m_estimates;
+    uint32_t m_outcomes;
+    double m_actual;
+};
+
+} // namespace
+
+TestCase*
+CreateEnergyAwareSchedulerTestCase()
+{
+    return new EnergyAwareSchedulerTestCase;
+}
+
+} // namespace ns3
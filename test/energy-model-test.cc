@@ -17,6 +17,9 @@
 #include "ns3/simulator.h"
 #include "ns3/test.h"
 
+#include <utility>
+#include <vector>
+
 namespace ns3
 {
 namespace
@@ -267,6 +270,106 @@ class EnergyModelNotConfiguredTestCase : public TestCase
     uint32_t m_taskCompletedCount;
 };
 
+/**
+ * @ingroup distributed-tests
+ * @brief Test deep idle states, wake latency and residency tracing
+ */
+class AcceleratorIdleStatesTestCase : public TestCase
+{
+  public:
+    AcceleratorIdleStatesTestCase()
+        : TestCase("Test Accelerator deep idle states and wake latency")
+    {
+    }
+
+  private:
+    void DoRun() override
+    {
+        Ptr<GpuAccelerator> gpu = CreateObject<GpuAccelerator>();
+        gpu->SetAttribute("ComputeRate", DoubleValue(1e12));
+        gpu->SetAttribute("MemoryBandwidth", DoubleValue(1e12));
+        gpu->SetAttribute("ProcessingModel",
+                          PointerValue(CreateObject<FixedRatioProcessingModel>()));
+        gpu->SetAttribute("QueueScheduler", PointerValue(CreateObject<FifoQueueScheduler>()));
+
+        // No dynamic power, so active and shallow idle both draw 10 W
+        Ptr<DvfsEnergyModel> energy = CreateObject<DvfsEnergyModel>();
+        energy->SetAttribute("EffectiveCapacitance", DoubleValue(0.0));
+        energy->SetAttribute("StaticPower", DoubleValue(10.0));
+        energy->AddIdleState(MilliSeconds(100), 2.0, MilliSeconds(5));
+        gpu->SetAttribute("EnergyModel", PointerValue(energy));
+
+        NS_TEST_ASSERT_MSG_EQ(energy->GetNIdleStates(), 2, "Shallow idle plus one deep state");
+
+        gpu->TraceConnectWithoutContext(
+            "TaskStarted",
+            MakeCallback(&AcceleratorIdleStatesTestCase::TaskStarted, this));
+        gpu->TraceConnectWithoutContext(
+            "IdleStateResidency",
+            MakeCallback(&AcceleratorIdleStatesTestCase::IdleStateResidency, this));
+
+        // 10 ms tasks at t=0 and t=1 s; the device enters deep idle at 110 ms
+        gpu->SubmitTask(CreateTask());
+        Simulator::Schedule(MilliSeconds(500),
+                            &AcceleratorIdleStatesTestCase::CheckDeepIdle,
+                            this,
+                            gpu);
+        Simulator::Schedule(Seconds(1), &GpuAccelerator::SubmitTask, gpu, CreateTask());
+
+        Simulator::Run();
+
+        NS_TEST_ASSERT_MSG_EQ(m_startTimes.size(), 2, "Both tasks should start");
+        NS_TEST_ASSERT_MSG_EQ(m_startTimes[0], Seconds(0), "First task starts immediately");
+        NS_TEST_ASSERT_MSG_EQ(m_startTimes[1],
+                              MilliSeconds(1005),
+                              "Second task should pay the 5 ms wake latency");
+
+        // Shallow 100 ms, deep 890 ms, shallow 100 ms after the second task
+        NS_TEST_ASSERT_MSG_EQ(m_residencies.size(), 3, "Three idle periods should be recorded");
+        NS_TEST_ASSERT_MSG_EQ(m_residencies[0].first, 0, "First residency is shallow idle");
+        NS_TEST_ASSERT_MSG_EQ(m_residencies[0].second, MilliSeconds(100), "Shallow residency");
+        NS_TEST_ASSERT_MSG_EQ(m_residencies[1].first, 1, "Second residency is deep idle");
+        NS_TEST_ASSERT_MSG_EQ(m_residencies[1].second, MilliSeconds(890), "Deep residency");
+
+        // 1.105 s at 10 W, 0.89 s at 2 W and a 10 W wake, up to deep idle at 1.115 s
+        NS_TEST_ASSERT_MSG_EQ_TOL(gpu->GetTotalEnergy(),
+                                  4.03,
+                                  1e-9,
+                                  "Deep idle should reduce idle energy");
+        NS_TEST_ASSERT_MSG_EQ(gpu->GetIdleState(), 1, "GPU should end in deep idle");
+
+        Simulator::Destroy();
+    }
+
+    static Ptr<Task> CreateTask()
+    {
+        Ptr<Task> task = CreateObject<SimpleTask>();
+        task->SetComputeDemand(1e10);
+        task->SetInputSize(0);
+        task->SetOutputSize(0);
+        return task;
+    }
+
+    void CheckDeepIdle(Ptr<GpuAccelerator> gpu)
+    {
+        NS_TEST_EXPECT_MSG_EQ(gpu->GetIdleState(), 1, "GPU should be in deep idle");
+        NS_TEST_EXPECT_MSG_EQ_TOL(gpu->GetCurrentPower(), 2.0, 1e-9, "Deep idle power");
+    }
+
+    void TaskStarted(Ptr<const Task>)
+    {
+        m_startTimes.push_back(Simulator::Now());
+    }
+
+    void IdleStateResidency(uint32_t state, Time residency)
+    {
+        m_residencies.emplace_back(state, residency);
+    }
+
+    std::vector<Time> m_startTimes;
+    std::vector<std::pair<uint32_t, Time>> m_residencies;
+};
+
 } // namespace
 
 // Factory functions for test registration
@@ -294,4 +397,10 @@ CreateEnergyModelNotConfiguredTestCase()
     return new EnergyModelNotConfiguredTestCase;
 }
 
+TestCase*
+CreateAcceleratorIdleStatesTestCase()
+{
+    return new AcceleratorIdleStatesTestCase;
+}
+
 } // namespace ns3
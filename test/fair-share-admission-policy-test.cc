@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#include "ns3/cluster-state.h"
+#include "ns3/cluster.h"
+#include "ns3/dag-task.h"
+#include "ns3/double.h"
+#include "ns3/fair-share-admission-policy.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/max-active-tasks-policy.h"
+#include "ns3/pointer.h"
+#include "ns3/simple-task.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+#include "ns3/uinteger.h"
+
+namespace ns3
+{
+namespace
+{
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test FairShareAdmissionPolicy rate-limits clients to weighted shares.
+ */
+class FairShareAdmissionPolicyTestCase : public TestCase
+{
+  public:
+    FairShareAdmissionPolicyTestCase()
+        : TestCase("FairShareAdmissionPolicy limits each client to its weighted share"),
+          m_clientA(InetSocketAddress(Ipv4Address("10.1.1.1"), 5000)),
+          m_clientB(InetSocketAddress(Ipv4Address("10.1.1.2"), 5000)),
+          m_clientC(InetSocketAddress(Ipv4Address("10.1.1.3"), 5000)),
+          m_throttled(0)
+    {
+    }
+
+  private:
+    /**
+     * @brief Create a DAG of independent tasks.
+     * @param tasks Number of tasks.
+     * @return The DAG.
+     */
+    static Ptr<DagTask> MakeDag(uint32_t tasks)
+    {
+        Ptr<DagTask> dag = CreateObject<DagTask>();
+        for (uint32_t i = 0; i < tasks; i++)
+        {
+            Ptr<SimpleTask> task = CreateObject<SimpleTask>();
+            task->SetTaskId(i + 1);
+            dag->AddTask(task);
+        }
+        return dag;
+    }
+
+    /**
+     * @brief Request admission as the orchestrator does.
+     * @param client The client address.
+     * @param dag The workload.
+     * @return true if admitted.
+     */
+    bool Request(const Address& client, Ptr<DagTask> dag)
+    {
+        if (!m_policy->CheckClient(client, dag) ||
+            !m_policy->ShouldAdmitFrom(client, dag, m_cluster, m_state))
+        {
+            return false;
+        }
+        m_policy->NotifyAdmitted(client, dag);
+        return true;
+    }
+
+    /**
+     * @brief Submit single-task workloads from a client.
+     * @param client The client address.
+     * @param count Number of workloads.
+     * @return Number admitted.
+     */
+    uint32_t Submit(const Address& client, uint32_t count)
+    {
+        uint32_t admitted = 0;
+        for (uint32_t i = 0; i < count; i++)
+        {
+            admitted += Request(client, MakeDag(1)) ? 1 : 0;
+        }
+        return admitted;
+    }
+
+    /**
+     * @brief Both clients burst at once, each limited to its bucket.
+     */
+    void Burst()
+    {
+        NS_TEST_EXPECT_MSG_EQ(Submit(m_clientA, 10), 6, "A's bucket holds 2 tasks x weight 3");
+        NS_TEST_EXPECT_MSG_EQ(Submit(m_clientB, 1), 1, "B keeps its share during A's burst");
+        NS_TEST_EXPECT_MSG_EQ(m_throttled, 4, "A's excess should be throttled");
+    }
+
+    /**
+     * @brief One second later, the 4 tasks/s have refilled the buckets 3:1.
+     */
+    void Refill()
+    {
+        NS_TEST_EXPECT_MSG_EQ_TOL(m_policy->GetTokens(m_clientA), 0, 1e-9, "A emptied its bucket");
+        NS_TEST_EXPECT_MSG_EQ(Submit(m_clientA, 10), 3, "A refills at 3 tasks/s");
+        NS_TEST_EXPECT_MSG_EQ(Submit(m_clientB, 10), 2, "B refills at 1 task/s up to its depth");
+
+        // The inner policy rejects without taking tokens, however often it is asked
+        m_state.NotifyTaskDispatched(0);
+        uint32_t throttled = m_throttled;
+        NS_TEST_EXPECT_MSG_EQ(Request(m_clientC, MakeDag(1)),
+                              false,
+                              "The inner policy's rejection should stand");
+        for (uint32_t variant = 0; variant < 3; variant++)
+        {
+            m_policy->ShouldAdmitFrom(m_clientC, MakeDag(1), m_cluster, m_state);
+        }
+        NS_TEST_EXPECT_MSG_EQ_TOL(m_policy->GetTokens(m_clientC),
+                                  2,
+                                  1e-9,
+                                  "Inner rejection should not take tokens");
+        NS_TEST_EXPECT_MSG_EQ(m_throttled, throttled, "Only CheckClient throttles");
+        NS_TEST_EXPECT_MSG_EQ(m_policy->ShouldAdmit(MakeDag(1), m_cluster, m_state),
+                              false,
+                              "Anonymous admission defers to the inner policy");
+        m_state.NotifyTaskCompleted(0);
+
+        // A workload larger than the bucket is admitted from a full one, leaving debt
+        NS_TEST_EXPECT_MSG_EQ(Request(m_clientC, MakeDag(5)),
+                              true,
+                              "An oversized workload fits a full bucket");
+        NS_TEST_EXPECT_MSG_EQ(Submit(m_clientC, 1), 0, "The bucket is in debt");
+    }
+
+    /**
+     * @brief Count throttled workloads.
+     * @param client The throttled client.
+     * @param tokens Tokens left in its bucket.
+     */
+    void Throttled(const Address& client, double tokens)
+    {
+        m_throttled++;
+    }
+
+    void DoRun() override
+    {
+        NodeContainer nodes;
+        nodes.Create(1);
+        InternetStackHelper internet;
+        internet.Install(nodes);
+        m_cluster.AddBackend(nodes.Get(0), InetSocketAddress(Ipv4Address("10.0.0.1"), 9000));
+        m_state.Resize(1);
+
+        Ptr<MaxActiveTasksPolicy> inner = CreateObject<MaxActiveTasksPolicy>();
+        inner->SetAttribute("MaxActiveTasks", UintegerValue(1));
+
+        m_policy = CreateObject<FairShareAdmissionPolicy>();
+        m_policy->SetAttribute("InnerPolicy", PointerValue(inner));
+        m_policy->SetAttribute("Rate", DoubleValue(4));
+        m_policy->SetAttribute("Burst", DoubleValue(2));
+        m_policy->SetAttribute("ActiveWindow", TimeValue(Seconds(2)));
+        m_policy->SetWeight(m_clientA, 3);
+        m_policy->TraceConnectWithoutContext(
+            "Throttled",
+            MakeCallback(&FairShareAdmissionPolicyTestCase::Throttled, this));
+        NS_TEST_ASSERT_MSG_EQ(m_policy->GetName(), "FairShare", "Policy name");
+        NS_TEST_ASSERT_MSG_EQ(m_policy->GetWeight(m_clientB), 1, "Default weight");
+
+        Simulator::Schedule(Seconds(0), &FairShareAdmissionPolicyTestCase::Burst, this);
+        Simulator::Schedule(Seconds(1), &FairShareAdmissionPolicyTestCase::Refill, this);
+        Simulator::Run();
+        Simulator::Destroy();
+    }
+
+    Cluster m_cluster;                      //!< One backend
+    ClusterState m_state;                   //!< Backend load
+    Ptr<FairShareAdmissionPolicy> m_policy; //!< Policy under test
+    Address m_clientA;                      //!< Client with weight 3
+    Address m_clientB;                      //!< Client with weight 1
+    Address m_clientC;                      //!< Client arriving later
+    uint32_t m_throttled;                   //!< Throttled workloads
+};
+
+} // namespace
+
+TestCase*
+CreateFairShareAdmissionPolicyTestCase()
+{
+    return new FairShareAdmissionPolicyTestCase;
+}
+
+} // namespace ns3
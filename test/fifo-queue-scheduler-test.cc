@@ -131,6 +131,10 @@ class FifoQueueSchedulerEmptyTestCase : public TestCase
         task = scheduler->Peek();
         NS_TEST_ASSERT_MSG_EQ((task == nullptr), true, "Peek on empty should return nullptr");
 
+        // RemoveLast from empty queue should return nullptr
+        task = scheduler->RemoveLast();
+        NS_TEST_ASSERT_MSG_EQ((task == nullptr), true, "RemoveLast on empty should return nullptr");
+
         // Clear on empty queue should not crash
         scheduler->Clear();
         NS_TEST_ASSERT_MSG_EQ(scheduler->IsEmpty(), true, "Clear should leave queue empty");
@@ -173,6 +177,22 @@ class FifoQueueSchedulerPeekTestCase : public TestCase
         peeked = scheduler->Peek();
         NS_TEST_ASSERT_MSG_EQ(peeked->GetTaskId(), 1, "Second peek should return same task");
 
+        // RemoveLast takes the tail, leaving the head in place
+        Ptr<Task> task3 = CreateObject<SimpleTask>();
+        task3->SetTaskId(3);
+        scheduler->Enqueue(task3);
+        NS_TEST_ASSERT_MSG_EQ(scheduler->RemoveLast()->GetTaskId(), 3, "RemoveLast takes task 3");
+        NS_TEST_ASSERT_MSG_EQ(scheduler->Peek()->GetTaskId(), 1, "Head should be unchanged");
+        NS_TEST_ASSERT_MSG_EQ(scheduler->GetLength(), 2, "RemoveLast should remove one task");
+
+        // Remove takes a task by ID from anywhere in the queue
+        scheduler->Enqueue(task3);
+        NS_TEST_ASSERT_MSG_EQ(scheduler->Remove(2)->GetTaskId(), 2, "Remove takes task 2");
+        NS_TEST_ASSERT_MSG_EQ((scheduler->Remove(2) == nullptr), true, "Task 2 is gone");
+        NS_TEST_ASSERT_MSG_EQ(scheduler->Peek()->GetTaskId(), 1, "Head should be unchanged");
+        NS_TEST_ASSERT_MSG_EQ(scheduler->RemoveLast()->GetTaskId(), 3, "Tail should be task 3");
+        scheduler->Enqueue(task2);
+
         // After dequeue, peek should return next task
         scheduler->Dequeue();
         peeked = scheduler->Peek();
@@ -7,6 +7,7 @@
  */
 
 #include "ns3/double.h"
+#include "ns3/enum.h"
 #include "ns3/dvfs-energy-model.h"
 #include "ns3/fifo-queue-scheduler.h"
 #include "ns3/fixed-ratio-processing-model.h"
@@ -16,6 +17,9 @@
 #include "ns3/simulator.h"
 #include "ns3/task.h"
 #include "ns3/test.h"
+#include "ns3/uinteger.h"
+
+#include <vector>
 
 namespace ns3
 {
@@ -223,6 +227,218 @@ class GpuAcceleratorFrequencyScalingTestCase : public TestCase
     }
 };
 
+/**
+ * @ingroup distributed-tests
+ * @brief Test GpuAccelerator model cache cold starts, hits and LRU eviction
+ */
+class GpuAcceleratorModelCacheTestCase : public TestCase
+{
+  public:
+    GpuAcceleratorModelCacheTestCase()
+        : TestCase("Test GpuAccelerator model weight cache"),
+          m_evictedCount(0)
+    {
+    }
+
+  private:
+    void DoRun() override
+    {
+        Ptr<GpuAccelerator> gpu = CreateObject<GpuAccelerator>();
+        gpu->SetAttribute("ComputeRate", DoubleValue(1e12));
+        gpu->SetAttribute("MemoryBandwidth", DoubleValue(1e11));
+        gpu->SetAttribute("MemoryCapacity", UintegerValue(3000000000));
+        gpu->SetAttribute("WeightLoadBandwidth", DoubleValue(1e9));
+        gpu->SetAttribute("ProcessingModel",
+                          PointerValue(CreateObject<FixedRatioProcessingModel>()));
+        gpu->SetAttribute("QueueScheduler", PointerValue(CreateObject<FifoQueueScheduler>()));
+
+        gpu->TraceConnectWithoutContext(
+            "TaskCompleted",
+            MakeCallback(&GpuAcceleratorModelCacheTestCase::TaskCompleted, this));
+        gpu->TraceConnectWithoutContext(
+            "ModelEvicted",
+            MakeCallback(&GpuAcceleratorModelCacheTestCase::ModelEvicted, this));
+
+        // A (cold), A (warm), B (cold, evicts A), C (exceeds capacity)
+        gpu->SubmitTask(CreateModelTask(1, "A", 2000000000));
+        gpu->SubmitTask(CreateModelTask(2, "A", 2000000000));
+        gpu->SubmitTask(CreateModelTask(3, "B", 2000000000));
+        gpu->SubmitTask(CreateModelTask(4, "C", 4000000000));
+
+        Simulator::Run();
+
+        NS_TEST_ASSERT_MSG_EQ(m_durations.size(), 3, "Three tasks should complete");
+        NS_TEST_ASSERT_MSG_EQ_TOL(m_durations[0].GetSeconds(),
+                                  2.001,
+                                  1e-9,
+                                  "Cold start should include the 2 s weight load");
+        NS_TEST_ASSERT_MSG_EQ_TOL(m_durations[1].GetSeconds(),
+                                  0.001,
+                                  1e-9,
+                                  "Warm start should only pay compute time");
+        NS_TEST_ASSERT_MSG_EQ_TOL(m_durations[2].GetSeconds(),
+                                  2.001,
+                                  1e-9,
+                                  "Evicting model should pay a cold start");
+        NS_TEST_ASSERT_MSG_EQ(m_evictedCount, 1, "Loading B should evict A");
+        NS_TEST_ASSERT_MSG_EQ(gpu->GetResidentModelCount(), 1, "Only B should be resident");
+        NS_TEST_ASSERT_MSG_EQ(gpu->IsModelResident("B"), true, "B should be resident");
+        NS_TEST_ASSERT_MSG_EQ(gpu->IsModelResident("A"), false, "A should be evicted");
+        NS_TEST_ASSERT_MSG_EQ(gpu->GetMemoryUsed(), 2000000000, "Memory used should be B's size");
+
+        Simulator::Destroy();
+    }
+
+    static Ptr<Task> CreateModelTask(uint64_t taskId, const std::string& modelId, uint64_t size)
+    {
+        Ptr<Task> task = CreateObject<SimpleTask>();
+        task->SetTaskId(taskId);
+        task->SetComputeDemand(1e9); // 1 ms at 1 TFLOPS
+        task->SetInputSize(0);
+        task->SetOutputSize(0);
+        task->SetModelId(modelId);
+        task->SetModelSize(size);
+        return task;
+    }
+
+    void TaskCompleted(Ptr<const Task>, Time duration)
+    {
+        m_durations.push_back(duration);
+    }
+
+    void ModelEvicted(const std::string&)
+    {
+        m_evictedCount++;
+    }
+
+    std::vector<Time> m_durations;
+    uint32_t m_evictedCount;
+};
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test GpuAccelerator DVFS transition latency and energy overhead
+ */
+class GpuAcceleratorTransitionTestCase : public TestCase
+{
+  public:
+    GpuAcceleratorTransitionTestCase()
+        : TestCase("Test GpuAccelerator DVFS transition latency and energy")
+    {
+    }
+
+  private:
+    void DoRun() override
+    {
+        // 20 ms of compute at 1 TFLOPS, retuned 5 ms in with a 10 ms transition
+        Ptr<GpuAccelerator> stallGpu = CreateTransitionGpu(GpuAccelerator::STALL);
+        Ptr<GpuAccelerator> lowerGpu = CreateTransitionGpu(GpuAccelerator::LOWER_CLOCK);
+
+        stallGpu->TraceConnectWithoutContext(
+            "TaskCompleted",
+            MakeCallback(&GpuAcceleratorTransitionTestCase::StallCompleted, this));
+        lowerGpu->TraceConnectWithoutContext(
+            "TaskCompleted",
+            MakeCallback(&GpuAcceleratorTransitionTestCase::LowerCompleted, this));
+
+        stallGpu->SubmitTask(CreateComputeTask());
+        lowerGpu->SubmitTask(CreateComputeTask());
+
+        // Stall: halve the clock, no progress for 10 ms, then the remaining 15 ms at half rate
+        Simulator::Schedule(MilliSeconds(5), &GpuAccelerator::SetFrequency, stallGpu, 0.75e9);
+        // Lower clock: double the clock, run at the old rate until the switch settles
+        Simulator::Schedule(MilliSeconds(5), &GpuAccelerator::SetFrequency, lowerGpu, 3.0e9);
+        Simulator::Schedule(MilliSeconds(10),
+                            &GpuAcceleratorTransitionTestCase::CheckMidway,
+                            this,
+                            stallGpu,
+                            lowerGpu);
+
+        Simulator::Run();
+
+        NS_TEST_ASSERT_MSG_EQ_TOL(m_stallDuration.GetSeconds(),
+                                  0.045,
+                                  1e-9,
+                                  "Stalling transition should pause execution for its latency");
+        NS_TEST_ASSERT_MSG_EQ_TOL(m_lowerDuration.GetSeconds(),
+                                  0.0175,
+                                  1e-9,
+                                  "Speed-up should only apply once the transition settles");
+        NS_TEST_ASSERT_MSG_EQ_TOL(stallGpu->GetFrequency(),
+                                  0.75e9,
+                                  1e-9,
+                                  "Stalled GPU should settle at the target frequency");
+        NS_TEST_ASSERT_MSG_EQ_TOL(lowerGpu->GetFrequency(),
+                                  3.0e9,
+                                  1e-9,
+                                  "Lower-clock GPU should settle at the target frequency");
+
+        Simulator::Destroy();
+
+        // Transition energy is charged once per frequency change, even when idle
+        Ptr<DvfsEnergyModel> energyModel = CreateObject<DvfsEnergyModel>();
+        energyModel->SetAttribute("StaticPower", DoubleValue(10.0));
+        Ptr<GpuAccelerator> gpu = CreateTransitionGpu(GpuAccelerator::STALL);
+        gpu->SetAttribute("EnergyModel", PointerValue(energyModel));
+        gpu->SetAttribute("TransitionEnergy", DoubleValue(1.0));
+
+        Simulator::Schedule(Seconds(1), &GpuAccelerator::SetFrequency, gpu, 1.0e9);
+        Simulator::Run();
+
+        NS_TEST_ASSERT_MSG_EQ_TOL(gpu->GetTotalEnergy(),
+                                  11.0,
+                                  1e-9,
+                                  "Energy should be 1 s of idle power plus one transition");
+
+        Simulator::Destroy();
+    }
+
+    static Ptr<GpuAccelerator> CreateTransitionGpu(GpuAccelerator::TransitionMode mode)
+    {
+        Ptr<GpuAccelerator> gpu = CreateObject<GpuAccelerator>();
+        gpu->SetAttribute("ComputeRate", DoubleValue(1e12));
+        gpu->SetAttribute("MemoryBandwidth", DoubleValue(1e11));
+        gpu->SetAttribute("Frequency", DoubleValue(1.5e9));
+        gpu->SetAttribute("TransitionLatency", TimeValue(MilliSeconds(10)));
+        gpu->SetAttribute("TransitionMode", EnumValue(mode));
+        gpu->SetAttribute("ProcessingModel",
+                          PointerValue(CreateObject<FixedRatioProcessingModel>()));
+        gpu->SetAttribute("QueueScheduler", PointerValue(CreateObject<FifoQueueScheduler>()));
+        return gpu;
+    }
+
+    static Ptr<Task> CreateComputeTask()
+    {
+        Ptr<Task> task = CreateObject<SimpleTask>();
+        task->SetComputeDemand(2e10);
+        task->SetInputSize(0);
+        task->SetOutputSize(0);
+        return task;
+    }
+
+    void CheckMidway(Ptr<GpuAccelerator> stallGpu, Ptr<GpuAccelerator> lowerGpu)
+    {
+        NS_TEST_EXPECT_MSG_EQ(stallGpu->IsTransitioning(), true, "Stall GPU mid-transition");
+        NS_TEST_EXPECT_MSG_EQ_TOL(lowerGpu->GetFrequency(),
+                                  1.5e9,
+                                  1e-9,
+                                  "Lower-clock GPU should still run at the old clock");
+    }
+
+    void StallCompleted(Ptr<const Task>, Time duration)
+    {
+        m_stallDuration = duration;
+    }
+
+    void LowerCompleted(Ptr<const Task>, Time duration)
+    {
+        m_lowerDuration = duration;
+    }
+
+    Time m_stallDuration;
+    Time m_lowerDuration;
+};
+
 } // namespace
 
 TestCase*
@@ -243,4 +459,16 @@ CreateGpuAcceleratorNoSchedulerTestCase()
     return new GpuAcceleratorNoSchedulerTestCase;
 }
 
+TestCase*
+CreateGpuAcceleratorModelCacheTestCase()
+{
+    return new GpuAcceleratorModelCacheTestCase;
+}
+
+TestCase*
+CreateGpuAcceleratorTransitionTestCase()
+{
+    return new GpuAcceleratorTransitionTestCase;
+}
+
 } // namespace ns3
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#include "distributed-test-utils.h"
+
+#include "ns3/cluster-state.h"
+#include "ns3/cluster.h"
+#include "ns3/double.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/learned-latency-scheduler.h"
+#include "ns3/simple-task.h"
+#include "ns3/test.h"
+
+#include <vector>
+
+namespace ns3
+{
+namespace
+{
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test LearnedLatencyScheduler learns backend speeds and explores uncertain ones.
+ */
+class LearnedLatencySchedulerTestCase : public TestCase
+{
+  public:
+    LearnedLatencySchedulerTestCase()
+        : TestCase("LearnedLatencyScheduler places tasks by learned latency")
+    {
+    }
+
+  private:
+    /**
+     * @brief Record a prediction outcome.
+     * @param taskId The completed task.
+     * @param backendIdx The backend that ran it.
+     * @param predicted Latency predicted at placement.
+     * @param observed Observed backend time.
+     */
+    void PredictionOutcome(uint64_t taskId, uint32_t backendIdx, Time predicted, Time observed)
+    {
+        m_predicted.push_back(predicted);
+        m_observed.push_back(observed);
+    }
+
+    /**
+     * @brief Complete a task on a backend as if it had been served in the given time.
+     * @param scheduler The scheduler.
+     * @param backendIdx The backend.
+     * @param task The task.
+     * @param computeTime Service time of the task.
+     */
+    static void Complete(Ptr<LearnedLatencyScheduler> scheduler,
+                         uint32_t backendIdx,
+                         Ptr<SimpleTask> task,
+                         Time computeTime)
+    {
+        task->SetComputeTime(computeTime);
+        task->SetBackendTime(computeTime);
+        scheduler->NotifyTaskCompleted(backendIdx, task);
+    }
+
+    void DoRun() override
+    {
+        NodeContainer nodes;
+        nodes.Create(3);
+        InternetStackHelper internet;
+        internet.Install(nodes);
+
+        // Identical on paper; backend 1 is in fact five times faster than backend 0
+        Cluster cluster;
+        cluster.AddBackend(nodes.Get(0), InetSocketAddress(Ipv4Address("10.0.0.1"), 9000), "GPU");
+        cluster.AddBackend(nodes.Get(1), InetSocketAddress(Ipv4Address("10.0.0.2"), 9000), "GPU");
+        cluster.AddBackend(nodes.Get(2), InetSocketAddress(Ipv4Address("10.0.0.3"), 9000), "GPU");
+        cluster.SetAvailable(2, false);
+
+        ClusterState state;
+        state.Resize(3);
+
+        Ptr<LearnedLatencyScheduler> scheduler = CreateObject<LearnedLatencyScheduler>();
+        scheduler->TraceConnectWithoutContext(
+            "PredictionOutcome",
+            MakeCallback(&LearnedLatencySchedulerTestCase::PredictionOutcome, this));
+        NS_TEST_ASSERT_MSG_EQ(scheduler->GetName(), "LearnedLatency", "Scheduler name");
+
+        // Backends look alike until measured; teach each its speed
+        uint64_t taskId = 1;
+        Ptr<SimpleTask> task = MakeTask(taskId++, 1e9);
+        int32_t first = scheduler->ScheduleTask(task, cluster, state);
+        NS_TEST_ASSERT_MSG_EQ((first == 0 || first == 1), true, "An available backend is chosen");
+        uint32_t other = 1 - first;
+        Complete(scheduler, first, task, MilliSeconds(first == 0 ? 10 : 2));
+        Complete(scheduler, other, MakeTask(taskId++, 1e9), MilliSeconds(other == 0 ? 10 : 2));
+        NS_TEST_ASSERT_MSG_EQ(scheduler->GetProfile().GetSamples(0), 2, "One sample each");
+
+        // Unmeasured backends are predicted from the 1 TFLOPS default
+        NS_TEST_ASSERT_MSG_EQ(m_predicted.size(), 1, "Only the placed task is traced");
+        NS_TEST_EXPECT_MSG_EQ_TOL(m_predicted[0].GetSeconds(), 1e-3, 1e-9, "Modelled latency");
+
+        task = MakeTask(taskId++, 1e9);
+        NS_TEST_ASSERT_MSG_EQ(scheduler->ScheduleTask(task, cluster, state),
+                              1,
+                              "The faster backend should win");
+        Complete(scheduler, 1, task, MilliSeconds(2));
+        NS_TEST_ASSERT_MSG_EQ(m_predicted.size(), 2, "Second outcome traced");
+        NS_TEST_EXPECT_MSG_EQ_TOL(m_predicted[1].GetSeconds(), 2e-3, 1e-9, "Learned latency");
+        NS_TEST_EXPECT_MSG_EQ(m_observed[1], MilliSeconds(2), "Observed backend time");
+
+        // 100 GFLOP queued on backend 1 take 200 ms, longer than 10 ms on backend 0
+        state.NotifyTaskDispatched(1, MakeTask(100, 100e9));
+        NS_TEST_ASSERT_MSG_EQ(scheduler->ScheduleTask(MakeTask(taskId++, 1e9), cluster, state),
+                              0,
+                              "Queued work on the faster backend should count");
+        state.NotifyTaskCompleted(1, 100);
+
+        // A new clock is learned afresh, falling back to the model meanwhile
+        state.SetCommandedFrequency(1, 1.0e9);
+        Time latency = scheduler->PredictLatency(1, state.Get(1), MakeTask(taskId++, 1e9), 3);
+        NS_TEST_EXPECT_MSG_EQ_TOL(latency.GetSeconds(), 1.5e-3, 1e-9, "Modelled at 1 GHz");
+        state.SetCommandedFrequency(1, 0);
+
+        // A task is learned at the clock it was placed at, even if the clock has since changed
+        task = MakeTask(taskId++, 1e9);
+        NS_TEST_ASSERT_MSG_EQ(scheduler->ScheduleTask(task, cluster, state),
+                              1,
+                              "Placed at the 1.5 GHz default");
+        state.SetCommandedFrequency(1, 1.0e9);
+        scheduler->ScheduleTask(MakeTask(taskId++, 1e9), cluster, state);
+        Complete(scheduler, 1, task, MilliSeconds(2));
+        const PerformanceProfile& profile = scheduler->GetProfile();
+        NS_TEST_EXPECT_MSG_EQ(profile.Find(1, SimpleTask::TASK_TYPE, 1.5e9)->samples,
+                              3,
+                              "Learned at the placement clock");
+        NS_TEST_EXPECT_MSG_EQ((profile.Find(1, SimpleTask::TASK_TYPE, 1.0e9) == nullptr),
+                              true,
+                              "Nothing learned at the new clock");
+        state.SetCommandedFrequency(1, 0);
+
+        // A cancelled task is forgotten, so a late completion is not traced
+        std::size_t traced = m_predicted.size();
+        task = MakeTask(taskId++, 1e9);
+        scheduler->ScheduleTask(task, cluster, state);
+        scheduler->NotifyTaskCancelled(task);
+        Complete(scheduler, 1, task, MilliSeconds(2));
+        NS_TEST_EXPECT_MSG_EQ(m_predicted.size(), traced, "Cancelled placement forgotten");
+
+        // Backend 0 measured once at 5 ms loses to a well-known 3 ms until exploration is on
+        scheduler = CreateObject<LearnedLatencyScheduler>();
+        task = MakeTask(taskId++, 1e9);
+        scheduler->ScheduleTask(task, cluster, state);
+        Complete(scheduler, 0, task, MilliSeconds(5));
+        for (uint32_t i = 0; i < 4; i++)
+        {
+            task = MakeTask(taskId++, 1e9);
+            scheduler->ScheduleTask(task, cluster, state);
+            Complete(scheduler, 1, task, MilliSeconds(3));
+        }
+        NS_TEST_EXPECT_MSG_EQ(scheduler->ScheduleTask(MakeTask(taskId++, 1e9), cluster, state),
+                              1,
+                              "Without exploration the lower mean wins");
+
+        // With N = 5: 5 ms * (1 - 0.5 sqrt(ln 5)) = 1.83 ms < 3 ms * (1 - 0.5 sqrt(ln 5 / 4))
+        scheduler->SetAttribute("Exploration", DoubleValue(0.5));
+        NS_TEST_EXPECT_MSG_EQ(scheduler->ScheduleTask(MakeTask(taskId++, 1e9), cluster, state),
+                              0,
+                              "The uncertain backend is explored");
+
+        // Equal means and counts: the backend whose service time varies is explored first.
+        // Backend 0 steady at 2.5 ms; backend 1 at 2 then 4 ms has mean 2.5 and s = 0.87 ms
+        scheduler = CreateObject<LearnedLatencyScheduler>();
+        scheduler->SetAttribute("Exploration", DoubleValue(0.5));
+        for (Time computeTime : {MilliSeconds(2), MilliSeconds(4)})
+        {
+            task = MakeTask(taskId++, 1e9);
+            scheduler->ScheduleTask(task, cluster, state);
+            Complete(scheduler, 1, task, computeTime);
+            task = MakeTask(taskId++, 1e9);
+            scheduler->ScheduleTask(task, cluster, state);
+            Complete(scheduler, 0, task, MicroSeconds(2500));
+        }
+        const PerformanceProfile::Estimate* varying =
+            scheduler->GetProfile().Find(1, SimpleTask::TASK_TYPE, 1.5e9);
+        NS_TEST_ASSERT_MSG_EQ((varying != nullptr), true, "Backend 1 learned");
+        NS_TEST_EXPECT_MSG_EQ_TOL(varying->mean, 2.5e-12, 1e-18, "Same mean as the steady one");
+        // With N = 4, n = 2: 2.5 - 0.5 * 2.5 * 0.83 = 1.46 ms > 2.5 - 0.5 * 3.37 * 0.83 = 1.10 ms
+        NS_TEST_EXPECT_MSG_EQ(scheduler->ScheduleTask(MakeTask(taskId++, 1e9), cluster, state),
+                              1,
+                              "The varying backend is explored");
+
+        // A new backend is tried while idle, and modelled once busy
+        cluster.SetAvailable(2, true);
+        NS_TEST_EXPECT_MSG_EQ(scheduler->ScheduleTask(MakeTask(taskId++, 1e9), cluster, state),
+                              2,
+                              "An idle unmeasured backend is tried first");
+        state.NotifyTaskDispatched(2, MakeTask(101, 1e12));
+        NS_TEST_EXPECT_MSG_NE(scheduler->ScheduleTask(MakeTask(taskId++, 1e9), cluster, state),
+                              2,
+                              "A busy unmeasured backend is modelled");
+
+        scheduler->Dispose();
+        Simulator::Destroy();
+    }
+
+    std::vector<Time> m_predicted; //!< Predicted latencies traced
+    std::vector<Time> m_observed;  //!< Observed latencies traced
+};
+
+} // namespace
+
+TestCase*
+CreateLearnedLatencySchedulerTestCase()
+{
+    return new LearnedLatencySchedulerTestCase;
+}
+
+} // namespace ns3
@@ -135,6 +135,175 @@ class LeastLoadedSchedulerTypeFilterTestCase : public TestCase
     }
 };
 
+/**
+ * @ingroup distributed-tests
+ * @brief Test LeastLoadedScheduler prefers backends holding the task's model.
+ */
+class LeastLoadedSchedulerWarmModelTestCase : public TestCase
+{
+  public:
+    LeastLoadedSchedulerWarmModelTestCase()
+        : TestCase("LeastLoadedScheduler prefers warm backends within slack")
+    {
+    }
+
+  private:
+    void DoRun() override
+    {
+        NodeContainer nodes;
+        nodes.Create(2);
+        InternetStackHelper internet;
+        internet.Install(nodes);
+
+        Cluster cluster;
+        cluster.AddBackend(nodes.Get(0), InetSocketAddress(Ipv4Address("10.0.0.1"), 9000));
+        cluster.AddBackend(nodes.Get(1), InetSocketAddress(Ipv4Address("10.0.0.2"), 9000));
+
+        ClusterState state;
+        state.Resize(2);
+        state.SetModelCacheCapacity(0, 4000000000);
+        state.SetModelCacheCapacity(1, 4000000000);
+
+        Ptr<LeastLoadedScheduler> scheduler = CreateObject<LeastLoadedScheduler>();
+
+        // Backend 0 holds the model and has one more active task than backend 1
+        state.NotifyTaskDispatched(0);
+        state.NotifyModelUsed(0, "yolo", 1000000000);
+        NS_TEST_ASSERT_MSG_EQ(state.IsModelWarm(0, "yolo"), true, "Backend 0 should be warm");
+        NS_TEST_ASSERT_MSG_EQ(state.IsModelWarm(1, "yolo"), false, "Backend 1 should be cold");
+
+        Ptr<SimpleTask> task1 = CreateObject<SimpleTask>();
+        task1->SetTaskId(1);
+        task1->SetModelId("yolo");
+        NS_TEST_ASSERT_MSG_EQ(scheduler->ScheduleTask(task1, cluster, state),
+                              0,
+                              "Warm backend within slack should be preferred");
+
+        // Beyond the slack the less-loaded cold backend wins
+        state.NotifyTaskDispatched(0);
+        NS_TEST_ASSERT_MSG_EQ(scheduler->ScheduleTask(task1, cluster, state),
+                              1,
+                              "Cold backend should be chosen when the warm one is too busy");
+
+        // Filling backend 0's cache evicts the least recently used model
+        state.NotifyModelUsed(0, "bert", 2000000000);
+        state.NotifyModelUsed(0, "llama", 2000000000);
+        NS_TEST_ASSERT_MSG_EQ(state.IsModelWarm(0, "yolo"), false, "yolo should be evicted");
+        NS_TEST_ASSERT_MSG_EQ(state.IsModelWarm(0, "llama"), true, "llama should be resident");
+    }
+};
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test LeastLoadedScheduler decisions from ClusterState's load index.
+ */
+class LeastLoadedSchedulerIndexedTestCase : public TestCase
+{
+  public:
+    LeastLoadedSchedulerIndexedTestCase()
+        : TestCase("LeastLoadedScheduler schedules from the load index")
+    {
+    }
+
+  private:
+    void DoRun() override
+    {
+        NodeContainer nodes;
+        nodes.Create(4);
+        InternetStackHelper internet;
+        internet.Install(nodes);
+
+        Cluster cluster;
+        cluster.AddBackend(nodes.Get(0), InetSocketAddress(Ipv4Address("10.0.0.1"), 9000), "GPU");
+        cluster.AddBackend(nodes.Get(1), InetSocketAddress(Ipv4Address("10.0.0.2"), 9000), "TPU");
+        cluster.AddBackend(nodes.Get(2), InetSocketAddress(Ipv4Address("10.0.0.3"), 9000), "GPU");
+        cluster.AddBackend(nodes.Get(3), InetSocketAddress(Ipv4Address("10.0.0.4"), 9000), "GPU");
+
+        // Backend 3 does not track models, so it is warm for every model
+        ClusterState state;
+        state.Resize(4);
+        state.SetModelCacheCapacity(0, 4000000000);
+        state.SetModelCacheCapacity(1, 4000000000);
+        state.SetModelCacheCapacity(2, 4000000000);
+        NS_TEST_ASSERT_MSG_EQ(state.IsLoadIndexed(cluster), false, "Not indexed before IndexLoad");
+
+        state.IndexLoad(cluster);
+        NS_TEST_ASSERT_MSG_EQ(state.IsLoadIndexed(cluster), true, "Indexed after IndexLoad");
+        const ClusterState::LoadGroup* gpus = state.GetLoadGroup("GPU");
+        NS_TEST_ASSERT_MSG_NE(gpus, nullptr, "GPU group should exist");
+        NS_TEST_ASSERT_MSG_EQ(gpus->backends.GetSize(), 3, "Three GPU backends");
+        NS_TEST_ASSERT_MSG_EQ(gpus->untracked.GetSize(), 1, "One untracked GPU backend");
+        NS_TEST_ASSERT_MSG_EQ(state.GetLoadGroup("FPGA"), nullptr, "No FPGA group");
+
+        Ptr<LeastLoadedScheduler> scheduler = CreateObject<LeastLoadedScheduler>();
+
+        Ptr<SimpleTask> gpuTask = CreateObject<SimpleTask>();
+        gpuTask->SetTaskId(1);
+        gpuTask->SetRequiredAcceleratorType("GPU");
+        Ptr<SimpleTask> yoloTask = CreateObject<SimpleTask>();
+        yoloTask->SetTaskId(2);
+        yoloTask->SetRequiredAcceleratorType("GPU");
+        yoloTask->SetModelId("yolo");
+
+        // Loads: 0 -> 1, 2 -> 1, 3 -> 2
+        state.NotifyTaskDispatched(0);
+        state.NotifyTaskDispatched(2);
+        state.NotifyTaskDispatched(3);
+        state.NotifyTaskDispatched(3);
+        state.NotifyModelUsed(0, "yolo", 1000000000);
+        NS_TEST_ASSERT_MSG_EQ(gpus->backends.GetMinLoad(), 1, "Index should follow dispatches");
+
+        int32_t idx = scheduler->ScheduleTask(gpuTask, cluster, state);
+        NS_TEST_ASSERT_MSG_EQ((idx == 0 || idx == 2), true, "Should pick a least-loaded GPU");
+        NS_TEST_ASSERT_MSG_EQ(scheduler->ScheduleTask(yoloTask, cluster, state),
+                              0,
+                              "The least-loaded backend holding the model should win the tie");
+
+        // Loads: 0 -> 3, 2 -> 1, 3 -> 2; the untracked backend is warm within slack
+        state.NotifyTaskDispatched(0);
+        state.NotifyTaskDispatched(0);
+        NS_TEST_ASSERT_MSG_EQ(scheduler->ScheduleTask(yoloTask, cluster, state),
+                              3,
+                              "Untracked backends count as warm");
+
+        // Loads: 0 -> 3, 2 -> 1, 3 -> 3; no warm backend within slack
+        state.NotifyTaskDispatched(3);
+        NS_TEST_ASSERT_MSG_EQ(scheduler->ScheduleTask(yoloTask, cluster, state),
+                              2,
+                              "Cold backend should be chosen when warm ones are too busy");
+
+        // Eviction removes the backend from the model's index
+        state.NotifyModelUsed(0, "bert", 2000000000);
+        state.NotifyModelUsed(0, "llama", 2000000000);
+        NS_TEST_ASSERT_MSG_EQ(gpus->models.count("yolo"), 0, "yolo should no longer be indexed");
+        NS_TEST_ASSERT_MSG_EQ(gpus->models.at("llama").GetLoad(0), 3, "llama indexed at load 3");
+
+        // Availability changes invalidate the index until it is rebuilt
+        cluster.SetAvailable(2, false);
+        NS_TEST_ASSERT_MSG_EQ(state.IsLoadIndexed(cluster), false, "Stale after availability");
+        state.IndexLoad(cluster);
+        gpus = state.GetLoadGroup("GPU");
+        NS_TEST_ASSERT_MSG_EQ(gpus->backends.Contains(2), false, "Unavailable backend excluded");
+
+        // Loads: 0 -> 2, 3 -> 3
+        state.NotifyTaskCompleted(0);
+        NS_TEST_ASSERT_MSG_EQ(scheduler->ScheduleTask(gpuTask, cluster, state),
+                              0,
+                              "Completions should lower a backend's load");
+
+        Ptr<SimpleTask> anyTask = CreateObject<SimpleTask>();
+        anyTask->SetTaskId(3);
+        NS_TEST_ASSERT_MSG_EQ(scheduler->ScheduleTask(anyTask, cluster, state),
+                              1,
+                              "Untyped tasks should consider every available backend");
+
+        gpuTask->SetRequiredAcceleratorType("FPGA");
+        NS_TEST_ASSERT_MSG_EQ(scheduler->ScheduleTask(gpuTask, cluster, state),
+                              -1,
+                              "Should return -1 for unknown type");
+    }
+};
+
 } // namespace
 
 TestCase*
@@ -149,4 +318,16 @@ CreateLeastLoadedSchedulerTypeFilterTestCase()
     return new LeastLoadedSchedulerTypeFilterTestCase;
 }
 
+TestCase*
+CreateLeastLoadedSchedulerWarmModelTestCase()
+{
+    return new LeastLoadedSchedulerWarmModelTestCase;
+}
+
+TestCase*
+CreateLeastLoadedSchedulerIndexedTestCase()
+{
+    return new LeastLoadedSchedulerIndexedTestCase;
+}
+
 } // namespace ns3
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#include "ns3/load-index.h"
+#include "ns3/test.h"
+
+namespace ns3
+{
+namespace
+{
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test LoadIndex tracks the minimum load across updates and removals.
+ */
+class LoadIndexTestCase : public TestCase
+{
+  public:
+    LoadIndexTestCase()
+        : TestCase("LoadIndex tracks least-loaded backends")
+    {
+    }
+
+  private:
+    void DoRun() override
+    {
+        LoadIndex index;
+        NS_TEST_ASSERT_MSG_EQ(index.IsEmpty(), true, "New index should be empty");
+
+        index.Insert(4, 2);
+        index.Insert(1, 0);
+        index.Insert(7, 0);
+        NS_TEST_ASSERT_MSG_EQ(index.GetSize(), 3, "Three backends indexed");
+        NS_TEST_ASSERT_MSG_EQ(index.GetMinLoad(), 0, "Minimum load should be 0");
+        NS_TEST_ASSERT_MSG_EQ(index.GetBucket(0).size(), 2, "Two idle backends");
+        NS_TEST_ASSERT_MSG_EQ(index.Contains(3), false, "Backend 3 was never inserted");
+        NS_TEST_ASSERT_MSG_EQ(index.GetBucket(9).empty(), true, "Unused levels are empty");
+
+        // Dispatching to both idle backends raises the minimum
+        index.Update(1, 1);
+        NS_TEST_ASSERT_MSG_EQ(index.GetMinLoad(), 0, "Backend 7 is still idle");
+        index.Update(7, 1);
+        NS_TEST_ASSERT_MSG_EQ(index.GetMinLoad(), 1, "Minimum should follow dispatches");
+        NS_TEST_ASSERT_MSG_EQ(index.GetBucket(1).size(), 2, "Both backends at load 1");
+
+        // Skipping levels when the only minimum backend jumps
+        index.Update(1, 3);
+        index.Update(7, 5);
+        NS_TEST_ASSERT_MSG_EQ(index.GetMinLoad(), 2, "Backend 4 is now least loaded");
+        NS_TEST_ASSERT_MSG_EQ(index.GetLoad(7), 5, "Backend 7 at load 5");
+
+        // Completions lower the minimum immediately
+        index.Update(7, 0);
+        NS_TEST_ASSERT_MSG_EQ(index.GetMinLoad(), 0, "Minimum should follow completions");
+        NS_TEST_ASSERT_MSG_EQ(index.GetBucket(0)[0], 7, "Backend 7 is idle");
+
+        index.Remove(7);
+        NS_TEST_ASSERT_MSG_EQ(index.Contains(7), false, "Backend 7 removed");
+        NS_TEST_ASSERT_MSG_EQ(index.GetMinLoad(), 2, "Minimum should skip removed backends");
+
+        index.Remove(4);
+        index.Remove(1);
+        NS_TEST_ASSERT_MSG_EQ(index.IsEmpty(), true, "Index should be empty again");
+
+        index.Insert(1, 6);
+        NS_TEST_ASSERT_MSG_EQ(index.GetMinLoad(), 6, "Reinserted backend sets the minimum");
+    }
+};
+
+} // namespace
+
+TestCase*
+CreateLoadIndexTestCase()
+{
+    return new LoadIndexTestCase;
+}
+
+} // namespace ns3
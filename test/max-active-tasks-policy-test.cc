@@ -172,6 +172,83 @@ class MaxActiveTasksAdmitEmptyTestCase : public TestCase
     }
 };
 
+/**
+ * @ingroup distributed-tests
+ * @brief Test that capacity reserved for pending admissions counts as active.
+ */
+class MaxActiveTasksReservationTestCase : public TestCase
+{
+  public:
+    MaxActiveTasksReservationTestCase()
+        : TestCase("MaxActiveTasksPolicy counts capacity reserved for pending admissions")
+    {
+    }
+
+  private:
+    void DoRun() override
+    {
+        NodeContainer nodes;
+        nodes.Create(2);
+        InternetStackHelper internet;
+        internet.Install(nodes);
+
+        Cluster cluster;
+        cluster.AddBackend(nodes.Get(0), InetSocketAddress(Ipv4Address("10.0.0.1"), 9000));
+        cluster.AddBackend(nodes.Get(1), InetSocketAddress(Ipv4Address("10.0.0.2"), 9000));
+
+        ClusterState state;
+        state.Resize(2);
+        state.NotifyTaskDispatched(0);
+        state.NotifyTaskDispatched(1);
+
+        Ptr<MaxActiveTasksPolicy> policy = CreateObject<MaxActiveTasksPolicy>();
+        policy->SetAttribute("MaxActiveTasks", UintegerValue(2));
+
+        Ptr<DagTask> pending = CreateObject<DagTask>();
+        for (uint64_t id = 1; id <= 2; id++)
+        {
+            Ptr<SimpleTask> task = CreateObject<SimpleTask>();
+            task->SetTaskId(id);
+            task->SetComputeDemand(1e9);
+            pending->AddTask(task);
+        }
+
+        Ptr<SimpleTask> task = CreateObject<SimpleTask>();
+        task->SetTaskId(3);
+        Ptr<DagTask> dag = CreateObject<DagTask>();
+        dag->AddTask(task);
+        NS_TEST_ASSERT_MSG_EQ(policy->ShouldAdmit(dag, cluster, state),
+                              true,
+                              "Both backends have capacity before the reservation");
+
+        // Without a planned placement, each task goes to the least-loaded backend
+        state.Reserve(7, pending, cluster, {});
+        NS_TEST_ASSERT_MSG_EQ(state.GetReservationCount(), 1, "One reservation outstanding");
+        NS_TEST_ASSERT_MSG_EQ(state.Get(0).reservedTasks, 1, "First task reserved on backend 0");
+        NS_TEST_ASSERT_MSG_EQ(state.Get(1).reservedTasks, 1, "Second task spread to backend 1");
+        NS_TEST_ASSERT_MSG_EQ_TOL(state.Get(1).reservedFlops, 1e9, 1e-3, "Reserved demand");
+        NS_TEST_ASSERT_MSG_EQ(policy->ShouldAdmit(dag, cluster, state),
+                              false,
+                              "Reserved tasks should fill the remaining capacity");
+
+        state.Release(7);
+        state.Release(7);
+        NS_TEST_ASSERT_MSG_EQ(state.GetReservationCount(), 0, "Reservation released once");
+        NS_TEST_ASSERT_MSG_EQ(state.Get(0).reservedTasks, 0, "Backend 0 released");
+        NS_TEST_ASSERT_MSG_EQ(state.Get(1).reservedFlops, 0, "Backend 1 released");
+
+        // A planned placement is honoured
+        state.Reserve(8, pending, cluster, {1, 1});
+        NS_TEST_ASSERT_MSG_EQ(state.Get(0).reservedTasks, 0, "Nothing planned on backend 0");
+        NS_TEST_ASSERT_MSG_EQ(state.Get(1).reservedTasks, 2, "Both tasks planned on backend 1");
+        NS_TEST_ASSERT_MSG_EQ(policy->ShouldAdmit(dag, cluster, state),
+                              true,
+                              "Backend 0 still has capacity");
+
+        Simulator::Destroy();
+    }
+};
+
 } // namespace
 
 TestCase*
@@ -192,4 +269,10 @@ CreateMaxActiveTasksAdmitEmptyTestCase()
     return new MaxActiveTasksAdmitEmptyTestCase;
 }
 
+TestCase*
+CreateMaxActiveTasksReservationTestCase()
+{
+    return new MaxActiveTasksReservationTestCase;
+}
+
 } // namespace ns3
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#include "ns3/double.h"
+#include "ns3/fifo-queue-scheduler.h"
+#include "ns3/fixed-ratio-processing-model.h"
+#include "ns3/gpu-accelerator.h"
+#include "ns3/gpu-device-protocol.h"
+#include "ns3/metrics-trailer-header.h"
+#include "ns3/packet.h"
+#include "ns3/pointer.h"
+#include "ns3/simple-task.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+
+namespace ns3
+{
+namespace
+{
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test MetricsTrailerHeader serialization roundtrip
+ */
+class MetricsTrailerHeaderTestCase : public TestCase
+{
+  public:
+    MetricsTrailerHeaderTestCase()
+        : TestCase("Test MetricsTrailerHeader serialization roundtrip")
+    {
+    }
+
+  private:
+    void DoRun() override
+    {
+        MetricsTrailerHeader original;
+        original.SetQueueLength(5);
+        original.SetFrequency(1.2e9);
+        original.SetCurrentPower(87.5);
+        original.SetBusyTimeNs(123456789);
+
+        NS_TEST_ASSERT_MSG_EQ(original.GetSerializedSize(),
+                              MetricsTrailerHeader::SERIALIZED_SIZE,
+                              "Serialized size should be 29 bytes");
+
+        Ptr<Packet> packet = Create<Packet>();
+        packet->AddHeader(original);
+
+        MetricsTrailerHeader deserialized;
+        packet->RemoveHeader(deserialized);
+
+        NS_TEST_ASSERT_MSG_EQ(deserialized.GetMessageType(),
+                              MetricsTrailerHeader::METRICS_TRAILER,
+                              "Message type should be METRICS_TRAILER");
+        NS_TEST_ASSERT_MSG_EQ(deserialized.GetQueueLength(), 5, "Queue length should match");
+        NS_TEST_ASSERT_MSG_EQ_TOL(deserialized.GetFrequency(), 1.2e9, 1e-9, "Frequency match");
+        NS_TEST_ASSERT_MSG_EQ_TOL(deserialized.GetCurrentPower(),
+                                  87.5,
+                                  1e-9,
+                                  "Current power should match");
+        NS_TEST_ASSERT_MSG_EQ(deserialized.GetBusyTimeNs(), 123456789, "Busy time should match");
+    }
+};
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test GpuDeviceProtocol trailers carry accumulated busy time
+ */
+class GpuDeviceProtocolTrailerTestCase : public TestCase
+{
+  public:
+    GpuDeviceProtocolTrailerTestCase()
+        : TestCase("Test GpuDeviceProtocol metrics trailer")
+    {
+    }
+
+  private:
+    void DoRun() override
+    {
+        Ptr<GpuAccelerator> gpu = CreateObject<GpuAccelerator>();
+        gpu->SetAttribute("ComputeRate", DoubleValue(1e12));
+        gpu->SetAttribute("MemoryBandwidth", DoubleValue(1e12));
+        gpu->SetAttribute("Frequency", DoubleValue(1.0e9));
+        gpu->SetAttribute("ProcessingModel",
+                          PointerValue(CreateObject<FixedRatioProcessingModel>()));
+        gpu->SetAttribute("QueueScheduler", PointerValue(CreateObject<FifoQueueScheduler>()));
+
+        // 1 TFLOP at 1 TFLOPS keeps the device busy for exactly one second
+        Ptr<Task> task = CreateObject<SimpleTask>();
+        task->SetComputeDemand(1e12);
+        task->SetInputSize(0);
+        task->SetOutputSize(0);
+        Simulator::Schedule(Seconds(1), &GpuAccelerator::SubmitTask, gpu, task);
+
+        Simulator::Schedule(Seconds(1.5),
+                            &GpuDeviceProtocolTrailerTestCase::CheckTrailer,
+                            this,
+                            gpu,
+                            Seconds(0.5));
+        Simulator::Schedule(Seconds(3),
+                            &GpuDeviceProtocolTrailerTestCase::CheckTrailer,
+                            this,
+                            gpu,
+                            Seconds(1));
+        Simulator::Run();
+        Simulator::Destroy();
+    }
+
+    void CheckTrailer(Ptr<GpuAccelerator> gpu, Time expectedBusy)
+    {
+        Ptr<GpuDeviceProtocol> protocol = CreateObject<GpuDeviceProtocol>();
+        Ptr<Packet> trailer = protocol->CreateMetricsTrailer(gpu);
+        NS_TEST_EXPECT_MSG_EQ(trailer->GetSize(),
+                              MetricsTrailerHeader::SERIALIZED_SIZE,
+                              "Trailer should be compact");
+
+        Ptr<DeviceMetrics> metrics = protocol->ParseMetrics(trailer);
+        NS_TEST_ASSERT_MSG_NE(metrics, nullptr, "Trailer should parse");
+        NS_TEST_EXPECT_MSG_EQ_TOL(metrics->frequency, 1.0e9, 1e-3, "Frequency should match");
+        NS_TEST_EXPECT_MSG_EQ(metrics->busyTime, expectedBusy, "Busy time should accumulate");
+        NS_TEST_EXPECT_MSG_EQ(metrics->busy, gpu->IsBusy(), "Busy flag should follow the queue");
+    }
+};
+
+} // namespace
+
+TestCase*
+CreateMetricsTrailerHeaderTestCase()
+{
+    return new MetricsTrailerHeaderTestCase;
+}
+
+TestCase*
+CreateGpuDeviceProtocolTrailerTestCase()
+{
+    return new GpuDeviceProtocolTrailerTestCase;
+}
+
+} // namespace ns3
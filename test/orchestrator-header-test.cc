@@ -97,6 +97,49 @@ class OrchestratorHeaderResponseTestCase : public TestCase
     }
 };
 
+/**
+ * @ingroup distributed-tests
+ * @brief Test OrchestratorHeader carries the admitted variant in the admitted byte
+ */
+class OrchestratorHeaderVariantTestCase : public TestCase
+{
+  public:
+    OrchestratorHeaderVariantTestCase()
+        : TestCase("Test OrchestratorHeader ADMISSION_RESPONSE variant roundtrip")
+    {
+    }
+
+  private:
+    void DoRun() override
+    {
+        OrchestratorHeader original;
+        original.SetMessageType(OrchestratorHeader::ADMISSION_RESPONSE);
+        original.SetTaskId(7);
+        original.SetAdmitted(true);
+        original.SetVariant(3);
+
+        NS_TEST_ASSERT_MSG_EQ(original.GetSerializedSize(),
+                              OrchestratorHeader::SERIALIZED_SIZE,
+                              "The variant should not change the header size");
+
+        Ptr<Packet> packet = Create<Packet>();
+        packet->AddHeader(original);
+
+        OrchestratorHeader deserialized;
+        packet->RemoveHeader(deserialized);
+        NS_TEST_ASSERT_MSG_EQ(deserialized.IsAdmitted(), true, "Should be admitted");
+        NS_TEST_ASSERT_MSG_EQ(deserialized.GetVariant(), 3, "Variant should match");
+
+        // A rejection carries no variant
+        original.SetAdmitted(false);
+        packet = Create<Packet>();
+        packet->AddHeader(original);
+        packet->RemoveHeader(deserialized);
+        NS_TEST_ASSERT_MSG_EQ(deserialized.IsAdmitted(), false, "Should be rejected");
+        NS_TEST_ASSERT_MSG_EQ(deserialized.GetVariant(), 0, "Rejection has no variant");
+    }
+};
+
 } // namespace
 
 TestCase*
@@ -111,4 +154,10 @@ CreateOrchestratorHeaderResponseTestCase()
     return new OrchestratorHeaderResponseTestCase;
 }
 
+TestCase*
+CreateOrchestratorHeaderVariantTestCase()
+{
+    return new OrchestratorHeaderVariantTestCase;
+}
+
 } // namespace ns3
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#include "ns3/performance-profile.h"
+#include "ns3/test.h"
+
+namespace ns3
+{
+namespace
+{
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test PerformanceProfile keeps a moving mean and variance per key.
+ */
+class PerformanceProfileTestCase : public TestCase
+{
+  public:
+    PerformanceProfileTestCase()
+        : TestCase("PerformanceProfile learns a moving mean and variance per key")
+    {
+    }
+
+  private:
+    void DoRun() override
+    {
+        PerformanceProfile profile;
+        NS_TEST_ASSERT_MSG_EQ((profile.Find(0, 1, 1.5e9) == nullptr), true, "Nothing learned");
+
+        // 2, then 4 and 4 with half weight: means 2, 3, 3.5; variances 0, 1, 0.75
+        profile.Record(0, 1, 1.5e9, 2, 0.5);
+        const PerformanceProfile::Estimate* estimate = profile.Find(0, 1, 1.5e9);
+        NS_TEST_ASSERT_MSG_EQ((estimate != nullptr), true, "First sample learned");
+        NS_TEST_EXPECT_MSG_EQ_TOL(estimate->mean, 2, 1e-12, "The first sample sets the mean");
+        NS_TEST_EXPECT_MSG_EQ_TOL(estimate->variance, 0, 1e-12, "One sample has no spread");
+
+        profile.Record(0, 1, 1.5e9, 4, 0.5);
+        profile.Record(0, 1, 1.5e9, 4, 0.5);
+        estimate = profile.Find(0, 1, 1.5e9);
+        NS_TEST_EXPECT_MSG_EQ(estimate->samples, 3, "Samples counted");
+        NS_TEST_EXPECT_MSG_EQ_TOL(estimate->mean, 3.5, 1e-12, "Moving mean");
+        NS_TEST_EXPECT_MSG_EQ_TOL(estimate->variance, 0.75, 1e-12, "Moving variance");
+
+        // Other backends, task types and clocks are learned apart
+        profile.Record(1, 1, 1.5e9, 10, 0.5);
+        profile.Record(0, 2, 1.5e9, 10, 0.5);
+        profile.Record(0, 1, 1.0e9, 10, 0.5);
+        NS_TEST_EXPECT_MSG_EQ_TOL(profile.Find(0, 1, 1.5e9)->mean, 3.5, 1e-12, "Keys kept apart");
+        NS_TEST_EXPECT_MSG_EQ_TOL(profile.Find(0, 1, 1.0e9)->mean, 10, 1e-12, "Per clock");
+        NS_TEST_EXPECT_MSG_EQ(profile.GetSamples(1), 5, "Samples of type 1 on any backend");
+        NS_TEST_EXPECT_MSG_EQ(profile.GetSamples(2), 1, "Samples of type 2");
+        NS_TEST_EXPECT_MSG_EQ(profile.GetSamples(3), 0, "Unseen task type");
+
+        profile.Clear();
+        NS_TEST_EXPECT_MSG_EQ((profile.Find(0, 1, 1.5e9) == nullptr), true, "Cleared");
+        NS_TEST_EXPECT_MSG_EQ(profile.GetSamples(1), 0, "Counts cleared");
+    }
+};
+
+} // namespace
+
+TestCase*
+CreatePerformanceProfileTestCase()
+{
+    return new PerformanceProfileTestCase;
+}
+
+} // namespace ns3
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#include "ns3/cluster-state.h"
+#include "ns3/deadline-scaling-policy.h"
+#include "ns3/double.h"
+#include "ns3/dvfs-energy-model.h"
+#include "ns3/pointer.h"
+#include "ns3/power-cap-scaling-policy.h"
+#include "ns3/simple-task.h"
+#include "ns3/test.h"
+
+#include <vector>
+
+namespace ns3
+{
+namespace
+{
+
+/**
+ * Three identical backends whose devices draw 24.7 W, 58.6 W and 100 W when
+ * busy at 0.5, 1.0 and 1.5 GHz, and 10 W when idle.
+ */
+std::vector<ClusterScalingPolicy::BackendProfile>
+MakeTestProfiles()
+{
+    Ptr<DvfsEnergyModel> energy = CreateObject<DvfsEnergyModel>();
+    energy->SetAttribute("StaticPower", DoubleValue(10.0));
+    energy->SetAttribute("EffectiveCapacitance", DoubleValue(60e-9));
+
+    ClusterScalingPolicy::BackendProfile profile;
+    profile.operatingPoints = {{0.5e9, 0.7}, {1.0e9, 0.9}, {1.5e9, 1.0}};
+    profile.energyModel = energy;
+    return std::vector<ClusterScalingPolicy::BackendProfile>(3, profile);
+}
+
+/**
+ * Backend 0 with three active tasks, backend 1 with one, backend 2 idle,
+ * all commanded at 1 GHz.
+ */
+void
+InitTestState(ClusterState& state)
+{
+    state.Resize(3);
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        state.SetCommandedFrequency(i, 1.0e9);
+    }
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        state.NotifyTaskDispatched(0);
+    }
+}
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test PowerCapScalingPolicy spends the budget on the most loaded backend.
+ */
+class PowerCapThroughputTestCase : public TestCase
+{
+  public:
+    PowerCapThroughputTestCase()
+        : TestCase("PowerCapScalingPolicy divides the budget by load")
+    {
+    }
+
+  private:
+    void DoRun() override
+    {
+        Ptr<PowerCapScalingPolicy> policy = CreateObject<PowerCapScalingPolicy>();
+        policy->SetAttribute("PowerBudget", DoubleValue(140.0));
+
+        ClusterState state;
+        InitTestState(state);
+        state.NotifyTaskDispatched(1);
+
+        // Minimum 59.4 W; both of backend 0's steps give more throughput per
+        // Watt than backend 1's first, which then no longer fits
+        std::vector<Ptr<ScalingDecision>> decisions = policy->Decide(state, MakeTestProfiles());
+        NS_TEST_ASSERT_MSG_EQ(decisions.size(), 3, "One decision slot per backend");
+        NS_TEST_ASSERT_MSG_NE(decisions[0], nullptr, "Loaded backend should change");
+        NS_TEST_EXPECT_MSG_EQ_TOL(decisions[0]->targetFrequency, 1.5e9, 1, "Most loaded to max");
+        NS_TEST_EXPECT_MSG_EQ_TOL(decisions[0]->targetVoltage, 1.0, 1e-9, "Voltage of the OPP");
+        NS_TEST_ASSERT_MSG_NE(decisions[1], nullptr, "Lightly loaded backend should change");
+        NS_TEST_EXPECT_MSG_EQ_TOL(decisions[1]->targetFrequency, 0.5e9, 1, "Budget exhausted");
+        NS_TEST_ASSERT_MSG_NE(decisions[2], nullptr, "Idle backend should change");
+        NS_TEST_EXPECT_MSG_EQ_TOL(decisions[2]->targetFrequency, 0.5e9, 1, "Idle to min");
+        NS_TEST_EXPECT_MSG_EQ_TOL(policy->GetPredictedPower(),
+                                  134.7,
+                                  1e-6,
+                                  "Prediction should stay within the budget");
+    }
+};
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test PowerCapScalingPolicy funds deadline floors before load.
+ */
+class PowerCapDeadlineTestCase : public TestCase
+{
+  public:
+    PowerCapDeadlineTestCase()
+        : TestCase("PowerCapScalingPolicy funds deadlines first")
+    {
+    }
+
+  private:
+    void DoRun() override
+    {
+        Ptr<DeadlineScalingPolicy> deadlines = CreateObject<DeadlineScalingPolicy>();
+        deadlines->SetAttribute("ComputeRate", DoubleValue(1e12));
+        deadlines->SetAttribute("ReferenceFrequency", DoubleValue(1.5e9));
+
+        Ptr<PowerCapScalingPolicy> policy = CreateObject<PowerCapScalingPolicy>();
+        policy->SetAttribute("PowerBudget", DoubleValue(140.0));
+        policy->SetAttribute("DeadlinePolicy", PointerValue(deadlines));
+
+        // 0.2 TFLOP due at 0.5 s needs 0.6 GHz, so backend 1 needs 1 GHz
+        ClusterState state;
+        InitTestState(state);
+        Ptr<Task> task = CreateObject<SimpleTask>();
+        task->SetTaskId(1);
+        task->SetComputeDemand(2e11);
+        task->SetDeadline(Seconds(0.5));
+        state.NotifyTaskDispatched(1, task);
+
+        // 93.3 W with the floor; backend 0 then only affords one step
+        std::vector<Ptr<ScalingDecision>> decisions = policy->Decide(state, MakeTestProfiles());
+        NS_TEST_EXPECT_MSG_EQ(decisions[0], nullptr, "Backend 0 should stay at 1 GHz");
+        NS_TEST_EXPECT_MSG_EQ(decisions[1], nullptr, "Deadline floor keeps backend 1 at 1 GHz");
+        NS_TEST_ASSERT_MSG_NE(decisions[2], nullptr, "Idle backend should change");
+        NS_TEST_EXPECT_MSG_EQ_TOL(decisions[2]->targetFrequency, 0.5e9, 1, "Idle to min");
+        NS_TEST_EXPECT_MSG_EQ_TOL(policy->GetPredictedPower(),
+                                  127.2,
+                                  1e-6,
+                                  "Prediction should stay within the budget");
+    }
+};
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test PowerCapScalingPolicy floors a backend whose deadline no OPP meets at the top OPP.
+ */
+class PowerCapUnreachableDeadlineTestCase : public TestCase
+{
+  public:
+    PowerCapUnreachableDeadlineTestCase()
+        : TestCase("PowerCapScalingPolicy funds the top OPP for deadlines beyond it")
+    {
+    }
+
+  private:
+    void DoRun() override
+    {
+        Ptr<DeadlineScalingPolicy> deadlines = CreateObject<DeadlineScalingPolicy>();
+        deadlines->SetAttribute("ComputeRate", DoubleValue(1e12));
+        deadlines->SetAttribute("ReferenceFrequency", DoubleValue(1.5e9));
+
+        Ptr<PowerCapScalingPolicy> policy = CreateObject<PowerCapScalingPolicy>();
+        policy->SetAttribute("PowerBudget", DoubleValue(140.0));
+        policy->SetAttribute("DeadlinePolicy", PointerValue(deadlines));
+
+        // 0.2 TFLOP due at 0.1 s needs 3 GHz, above every OPP
+        ClusterState state;
+        InitTestState(state);
+        Ptr<Task> task = CreateObject<SimpleTask>();
+        task->SetTaskId(1);
+        task->SetComputeDemand(2e11);
+        task->SetDeadline(Seconds(0.1));
+        state.NotifyTaskDispatched(1, task);
+
+        // 134.7 W with backend 1 at the top; backend 0 cannot afford a step
+        std::vector<Ptr<ScalingDecision>> decisions = policy->Decide(state, MakeTestProfiles());
+        NS_TEST_ASSERT_MSG_NE(decisions[0], nullptr, "Backend 0 should change");
+        NS_TEST_EXPECT_MSG_EQ_TOL(decisions[0]->targetFrequency, 0.5e9, 1, "Budget exhausted");
+        NS_TEST_ASSERT_MSG_NE(decisions[1], nullptr, "Backend 1 should change");
+        NS_TEST_EXPECT_MSG_EQ_TOL(decisions[1]->targetFrequency,
+                                  1.5e9,
+                                  1,
+                                  "Unreachable deadline floored at the top OPP");
+        NS_TEST_EXPECT_MSG_EQ_TOL(policy->GetPredictedPower(),
+                                  134.7,
+                                  1e-6,
+                                  "Prediction should stay within the budget");
+    }
+};
+
+} // namespace
+
+TestCase*
+CreatePowerCapThroughputTestCase()
+{
+    return new PowerCapThroughputTestCase;
+}
+
+TestCase*
+CreatePowerCapDeadlineTestCase()
+{
+    return new PowerCapDeadlineTestCase;
+}
+
+TestCase*
+CreatePowerCapUnreachableDeadlineTestCase()
+{
+    return new PowerCapUnreachableDeadlineTestCase;
+}
+
+} // namespace ns3
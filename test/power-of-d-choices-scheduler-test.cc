@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#include "ns3/cluster-state.h"
+#include "ns3/cluster.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/power-of-d-choices-scheduler.h"
+#include "ns3/simple-task.h"
+#include "ns3/test.h"
+#include "ns3/uinteger.h"
+
+#include <string>
+
+namespace ns3
+{
+namespace
+{
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test PowerOfDChoicesScheduler sampling, filtering and reproducibility.
+ */
+class PowerOfDChoicesSchedulerTestCase : public TestCase
+{
+  public:
+    PowerOfDChoicesSchedulerTestCase()
+        : TestCase("PowerOfDChoicesScheduler picks the least loaded of d samples")
+    {
+    }
+
+  private:
+    void DoRun() override
+    {
+        NodeContainer nodes;
+        nodes.Create(10);
+        InternetStackHelper internet;
+        internet.Install(nodes);
+
+        // Backends 0-7 are GPUs, 8-9 are TPUs; backend i has i active tasks
+        Cluster cluster;
+        ClusterState state;
+        state.Resize(10);
+        for (uint32_t i = 0; i < 10; i++)
+        {
+            std::string addr = "10.0.0." + std::to_string(i + 1);
+            cluster.AddBackend(nodes.Get(i),
+                               InetSocketAddress(Ipv4Address(addr.c_str()), 9000),
+                               i < 8 ? "GPU" : "TPU");
+            for (uint32_t t = 0; t < i; t++)
+            {
+                state.NotifyTaskDispatched(i);
+            }
+        }
+
+        Ptr<PowerOfDChoicesScheduler> scheduler = CreateObject<PowerOfDChoicesScheduler>();
+        scheduler->AssignStreams(1);
+        NS_TEST_ASSERT_MSG_EQ(scheduler->GetName(), "PowerOfDChoices", "Scheduler name");
+
+        Ptr<SimpleTask> task = CreateObject<SimpleTask>();
+        task->SetTaskId(1);
+
+        // With two distinct samples the most loaded backend can never win
+        bool pickedMax = false;
+        for (uint32_t k = 0; k < 200; k++)
+        {
+            pickedMax |= scheduler->ScheduleTask(task, cluster, state) == 9;
+        }
+        NS_TEST_ASSERT_MSG_EQ(pickedMax, false, "Most loaded backend should never be chosen");
+
+        // Type filtering draws only from matching backends
+        task->SetRequiredAcceleratorType("TPU");
+        for (uint32_t k = 0; k < 20; k++)
+        {
+            NS_TEST_ASSERT_MSG_EQ(scheduler->ScheduleTask(task, cluster, state),
+                                  8,
+                                  "Both TPUs are sampled, the less loaded wins");
+        }
+        task->SetRequiredAcceleratorType("FPGA");
+        NS_TEST_ASSERT_MSG_EQ(scheduler->ScheduleTask(task, cluster, state),
+                              -1,
+                              "Should return -1 for unknown type");
+
+        // Choices covering the whole pool reduce to least-loaded, skipping unavailable backends
+        task->SetRequiredAcceleratorType("GPU");
+        scheduler->SetAttribute("Choices", UintegerValue(16));
+        cluster.SetAvailable(0, false);
+        NS_TEST_ASSERT_MSG_EQ(scheduler->ScheduleTask(task, cluster, state),
+                              1,
+                              "Least-loaded available GPU should be chosen");
+
+        // The same stream reproduces the same decisions
+        task->SetRequiredAcceleratorType("");
+        Ptr<PowerOfDChoicesScheduler> a = CreateObject<PowerOfDChoicesScheduler>();
+        Ptr<PowerOfDChoicesScheduler> b = CreateObject<PowerOfDChoicesScheduler>();
+        a->AssignStreams(7);
+        b->AssignStreams(7);
+        for (uint32_t k = 0; k < 50; k++)
+        {
+            NS_TEST_ASSERT_MSG_EQ(a->ScheduleTask(task, cluster, state),
+                                  b->ScheduleTask(task, cluster, state),
+                                  "Decisions should be reproducible");
+        }
+    }
+};
+
+} // namespace
+
+TestCase*
+CreatePowerOfDChoicesSchedulerTestCase()
+{
+    return new PowerOfDChoicesSchedulerTestCase;
+}
+
+} // namespace ns3
@@ -39,18 +39,28 @@ class SimpleTaskHeaderTestCase : public TestCase
         original.SetOutputSize(512 * 1024);
         original.SetDeadlineNs(1000000000); // 1 second deadline
         original.SetAcceleratorType("GPU");
+        original.SetModelId("resnet50");
+        original.SetModelSize(100000000);
+        original.SetTargetFrequency(1.2e9);
+        original.SetTargetVoltage(0.9);
 
         // Verify serialized size
-        uint32_t expectedSize = sizeof(uint8_t) +                  // messageType
-                                sizeof(uint64_t) +                 // taskId
-                                sizeof(uint64_t) +                 // computeDemand (as double)
-                                sizeof(uint64_t) +                 // inputSize
-                                sizeof(uint64_t) +                 // outputSize
-                                sizeof(int64_t) +                  // deadline
-                                SimpleTaskHeader::ACCEL_TYPE_SIZE; // acceleratorType
+        uint32_t expectedSize = sizeof(uint8_t) +                   // messageType
+                                sizeof(uint64_t) +                  // taskId
+                                sizeof(uint64_t) +                  // computeDemand (as double)
+                                sizeof(uint64_t) +                  // inputSize
+                                sizeof(uint64_t) +                  // outputSize
+                                sizeof(int64_t) +                   // deadline
+                                SimpleTaskHeader::ACCEL_TYPE_SIZE + // acceleratorType
+                                SimpleTaskHeader::MODEL_ID_SIZE +   // modelId
+                                sizeof(uint64_t) +                  // modelSize
+                                sizeof(uint64_t) +                  // targetFrequency
+                                sizeof(uint64_t) +                  // targetVoltage
+                                sizeof(int64_t) +                   // computeTime
+                                sizeof(int64_t);                    // backendTime
         NS_TEST_ASSERT_MSG_EQ(original.GetSerializedSize(),
                               expectedSize,
-                              "Serialized size should be 57 bytes");
+                              "Serialized size should be 113 bytes");
 
         // Create packet with header
         Ptr<Packet> packet = Create<Packet>();
@@ -76,6 +86,16 @@ class SimpleTaskHeaderTestCase : public TestCase
         NS_TEST_ASSERT_MSG_EQ(deserialized.GetAcceleratorType(),
                               "GPU",
                               "Accelerator type should match");
+        NS_TEST_ASSERT_MSG_EQ(deserialized.GetModelId(), "resnet50", "Model ID should match");
+        NS_TEST_ASSERT_MSG_EQ(deserialized.GetModelSize(), 100000000, "Model size should match");
+        NS_TEST_ASSERT_MSG_EQ_TOL(deserialized.GetTargetFrequency(),
+                                  1.2e9,
+                                  1e-6,
+                                  "Target frequency should match");
+        NS_TEST_ASSERT_MSG_EQ_TOL(deserialized.GetTargetVoltage(),
+                                  0.9,
+                                  1e-9,
+                                  "Target voltage should match");
     }
 };
 
@@ -100,6 +120,8 @@ class SimpleTaskHeaderResponseTestCase : public TestCase
         original.SetComputeDemand(1e12);
         original.SetInputSize(0);
         original.SetOutputSize(2048);
+        original.SetComputeTimeNs(4000000);
+        original.SetBackendTimeNs(7000000);
 
         Ptr<Packet> packet = Create<Packet>();
         packet->AddHeader(original);
@@ -111,6 +133,12 @@ class SimpleTaskHeaderResponseTestCase : public TestCase
                               SimpleTaskHeader::TASK_RESPONSE,
                               "Message type should be TASK_RESPONSE");
         NS_TEST_ASSERT_MSG_EQ(deserialized.GetTaskId(), 999, "Task ID should match");
+        NS_TEST_ASSERT_MSG_EQ(deserialized.GetComputeTimeNs(),
+                              4000000,
+                              "Compute time should match");
+        NS_TEST_ASSERT_MSG_EQ(deserialized.GetBackendTimeNs(),
+                              7000000,
+                              "Backend time should match");
     }
 };
 
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#include "ns3/packet.h"
+#include "ns3/task-cancel-header.h"
+#include "ns3/test.h"
+
+namespace ns3
+{
+namespace
+{
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test TaskCancelHeader serialization roundtrip
+ */
+class TaskCancelHeaderTestCase : public TestCase
+{
+  public:
+    TaskCancelHeaderTestCase()
+        : TestCase("Test TaskCancelHeader serialization roundtrip")
+    {
+    }
+
+  private:
+    void DoRun() override
+    {
+        TaskCancelHeader original;
+        original.SetTaskId(0x0102030405060708ULL);
+
+        NS_TEST_ASSERT_MSG_EQ(original.GetSerializedSize(),
+                              TaskCancelHeader::SERIALIZED_SIZE,
+                              "Serialized size should be 9 bytes");
+
+        Ptr<Packet> packet = Create<Packet>();
+        packet->AddHeader(original);
+
+        // The message type leads, as for every message on the backend connection
+        uint8_t firstByte;
+        packet->CopyData(&firstByte, 1);
+        NS_TEST_ASSERT_MSG_EQ(firstByte, TaskCancelHeader::TASK_CANCEL, "Leading type byte");
+
+        TaskCancelHeader deserialized;
+        packet->RemoveHeader(deserialized);
+
+        NS_TEST_ASSERT_MSG_EQ(deserialized.GetMessageType(),
+                              TaskCancelHeader::TASK_CANCEL,
+                              "Message type should be TASK_CANCEL");
+        NS_TEST_ASSERT_MSG_EQ(deserialized.GetTaskId(),
+                              0x0102030405060708ULL,
+                              "Task ID should match");
+        NS_TEST_ASSERT_MSG_EQ(packet->GetSize(), 0, "Whole header should be consumed");
+    }
+};
+
+} // namespace
+
+TestCase*
+CreateTaskCancelHeaderTestCase()
+{
+    return new TaskCancelHeaderTestCase;
+}
+
+} // namespace ns3
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#include "ns3/packet.h"
+#include "ns3/task-steal-header.h"
+#include "ns3/test.h"
+
+namespace ns3
+{
+namespace
+{
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test TaskStealHeader serialization roundtrip
+ */
+class TaskStealHeaderTestCase : public TestCase
+{
+  public:
+    TaskStealHeaderTestCase()
+        : TestCase("Test TaskStealHeader serialization roundtrip")
+    {
+    }
+
+  private:
+    void DoRun() override
+    {
+        TaskStealHeader request;
+        NS_TEST_ASSERT_MSG_EQ(request.GetMessageType(),
+                              TaskStealHeader::STEAL_REQUEST,
+                              "Default should be a request");
+        NS_TEST_ASSERT_MSG_EQ(request.GetSerializedSize(),
+                              TaskStealHeader::SERIALIZED_SIZE,
+                              "Serialized size should be 13 bytes");
+
+        TaskStealHeader original;
+        original.SetMessageType(TaskStealHeader::STEAL_RESPONSE);
+        original.SetTaskId(0x0102030405060708ULL);
+        original.SetPayloadSize(0xA0B0C0D0);
+
+        Ptr<Packet> packet = Create<Packet>();
+        packet->AddHeader(original);
+
+        // The message type leads, as for every message on the backend connection
+        uint8_t firstByte;
+        packet->CopyData(&firstByte, 1);
+        NS_TEST_ASSERT_MSG_EQ(firstByte, TaskStealHeader::STEAL_RESPONSE, "Leading type byte");
+
+        TaskStealHeader deserialized;
+        packet->RemoveHeader(deserialized);
+
+        NS_TEST_ASSERT_MSG_EQ(deserialized.GetMessageType(),
+                              TaskStealHeader::STEAL_RESPONSE,
+                              "Message type should be STEAL_RESPONSE");
+        NS_TEST_ASSERT_MSG_EQ(deserialized.GetTaskId(),
+                              0x0102030405060708ULL,
+                              "Task ID should match");
+        NS_TEST_ASSERT_MSG_EQ(deserialized.GetPayloadSize(),
+                              0xA0B0C0D0,
+                              "Payload size should match");
+        NS_TEST_ASSERT_MSG_EQ(packet->GetSize(), 0, "Whole header should be consumed");
+    }
+};
+
+} // namespace
+
+TestCase*
+CreateTaskStealHeaderTestCase()
+{
+    return new TaskStealHeaderTestCase;
+}
+
+} // namespace ns3
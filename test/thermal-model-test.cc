@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2025 UCC
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Author: John Mullan <122331816@umail.ucc.ie>
+ */
+
+#include "ns3/double.h"
+#include "ns3/dvfs-energy-model.h"
+#include "ns3/fifo-queue-scheduler.h"
+#include "ns3/fixed-ratio-processing-model.h"
+#include "ns3/gpu-accelerator.h"
+#include "ns3/pointer.h"
+#include "ns3/simple-task.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+#include "ns3/thermal-model.h"
+
+#include <cmath>
+
+namespace ns3
+{
+namespace
+{
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test ThermalModel RC step response and crossing prediction
+ */
+class ThermalModelRcTestCase : public TestCase
+{
+  public:
+    ThermalModelRcTestCase()
+        : TestCase("Test ThermalModel RC step response")
+    {
+    }
+
+  private:
+    void DoRun() override
+    {
+        // tau = R * C = 1 s, steady state at 100 W = 25 + 0.5 * 100 = 75 C
+        Ptr<ThermalModel> thermal = CreateObject<ThermalModel>();
+        thermal->SetAttribute("AmbientTemperature", DoubleValue(25.0));
+        thermal->SetAttribute("ThermalResistance", DoubleValue(0.5));
+        thermal->SetAttribute("ThermalCapacitance", DoubleValue(2.0));
+
+        NS_TEST_ASSERT_MSG_EQ_TOL(thermal->GetTemperature(), 25.0, 1e-9, "Start at ambient");
+        NS_TEST_ASSERT_MSG_EQ_TOL(thermal->GetTimeToReach(100.0, 50.0).GetSeconds(),
+                                  std::log(2.0),
+                                  1e-6,
+                                  "Half-way to steady state takes tau * ln 2");
+        NS_TEST_ASSERT_MSG_EQ(thermal->GetTimeToReach(100.0, 80.0),
+                              Time::Max(),
+                              "Temperatures beyond steady state are never reached");
+
+        thermal->Update(100.0, Seconds(1));
+        NS_TEST_ASSERT_MSG_EQ_TOL(thermal->GetTemperature(),
+                                  75.0 - 50.0 * std::exp(-1.0),
+                                  1e-6,
+                                  "One time constant of heating");
+
+        thermal->Update(0.0, Seconds(100));
+        NS_TEST_ASSERT_MSG_EQ_TOL(thermal->GetTemperature(),
+                                  25.0,
+                                  1e-6,
+                                  "Device should cool back to ambient");
+    }
+};
+
+/**
+ * @ingroup distributed-tests
+ * @brief Test GpuAccelerator steps down its OPP table when hot
+ */
+class AcceleratorThermalThrottleTestCase : public TestCase
+{
+  public:
+    AcceleratorThermalThrottleTestCase()
+        : TestCase("Test Accelerator thermal throttling"),
+          m_throttleCount(0)
+    {
+    }
+
+  private:
+    void DoRun() override
+    {
+        Ptr<GpuAccelerator> gpu = CreateObject<GpuAccelerator>();
+        gpu->SetAttribute("ComputeRate", DoubleValue(1e12));
+        gpu->SetAttribute("MemoryBandwidth", DoubleValue(1e12));
+        gpu->SetAttribute("Frequency", DoubleValue(1.5e9));
+        gpu->SetAttribute("Voltage", DoubleValue(1.0));
+        gpu->SetAttribute("ProcessingModel",
+                          PointerValue(CreateObject<FixedRatioProcessingModel>()));
+        gpu->SetAttribute("QueueScheduler", PointerValue(CreateObject<FifoQueueScheduler>()));
+        gpu->AddOperatingPoint(0.5e9, 0.7);
+        gpu->AddOperatingPoint(1.0e9, 0.9);
+        gpu->AddOperatingPoint(1.5e9, 1.0);
+
+        // 100 W at the top OPP, 58.6 W one step down
+        Ptr<DvfsEnergyModel> energy = CreateObject<DvfsEnergyModel>();
+        energy->SetAttribute("StaticPower", DoubleValue(10.0));
+        energy->SetAttribute("EffectiveCapacitance", DoubleValue(60e-9));
+        gpu->SetAttribute("EnergyModel", PointerValue(energy));
+
+        // Steady state 75 C at full power, 54.3 C one step down
+        Ptr<ThermalModel> thermal = CreateObject<ThermalModel>();
+        thermal->SetAttribute("ThermalResistance", DoubleValue(0.5));
+        thermal->SetAttribute("ThermalCapacitance", DoubleValue(2.0));
+        thermal->SetAttribute("ThrottleTemperature", DoubleValue(60.0));
+        thermal->SetAttribute("ThrottleHysteresis", DoubleValue(5.0));
+        gpu->SetAttribute("ThermalModel", PointerValue(thermal));
+
+        gpu->TraceConnectWithoutContext(
+            "ThermalThrottle",
+            MakeCallback(&AcceleratorThermalThrottleTestCase::ThermalThrottle, this));
+
+        Ptr<Task> task = CreateObject<SimpleTask>();
+        task->SetComputeDemand(1e13);
+        task->SetInputSize(0);
+        task->SetOutputSize(0);
+        gpu->SubmitTask(task);
+
+        Simulator::Schedule(Seconds(1.3),
+                            &AcceleratorThermalThrottleTestCase::CheckThrottled,
+                            this,
+                            gpu);
+        Simulator::Stop(Seconds(2));
+        Simulator::Run();
+
+        // 60 C is reached after tau * ln((75 - 25) / (75 - 60))
+        NS_TEST_ASSERT_MSG_EQ_TOL(m_firstThrottle.GetSeconds(),
+                                  std::log(50.0 / 15.0),
+                                  1e-6,
+                                  "Throttling should engage at the predicted crossing");
+        NS_TEST_ASSERT_MSG_EQ(m_throttleCount, 1, "One throttle step should suffice");
+
+        Simulator::Destroy();
+    }
+
+    void CheckThrottled(Ptr<GpuAccelerator> gpu)
+    {
+        NS_TEST_EXPECT_MSG_EQ(gpu->IsThrottled(), true, "GPU should be throttled");
+        NS_TEST_EXPECT_MSG_EQ_TOL(gpu->GetFrequency(), 1.0e9, 1e-3, "Clock one OPP down");
+        NS_TEST_EXPECT_MSG_EQ_TOL(gpu->GetVoltage(), 0.9, 1e-9, "Voltage follows the OPP");
+        NS_TEST_EXPECT_MSG_LT(gpu->GetTemperature(), 60.0, "Device should be cooling");
+
+        // Commands above the cap are clamped
+        gpu->SetFrequency(1.5e9);
+        NS_TEST_EXPECT_MSG_EQ_TOL(gpu->GetFrequency(), 1.0e9, 1e-3, "Cap should hold");
+    }
+
+    void ThermalThrottle(bool throttled, double, double)
+    {
+        if (throttled && m_throttleCount++ == 0)
+        {
+            m_firstThrottle = Simulator::Now();
+        }
+    }
+
+    uint32_t m_throttleCount;
+    Time m_firstThrottle;
+};
+
+} // namespace
+
+TestCase*
+CreateThermalModelRcTestCase()
+{
+    return new ThermalModelRcTestCase;
+}
+
+TestCase*
+CreateAcceleratorThermalThrottleTestCase()
+{
+    return new AcceleratorThermalThrottleTestCase;
+}
+
+} // namespace ns3